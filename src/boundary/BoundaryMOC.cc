@@ -88,6 +88,29 @@ BoundaryMOC<D>::Create(SP_input       input,
 }
 
 
+//---------------------------------------------------------------------------//
+template<class D>
+void BoundaryMOC<D>::set_tracks(SP_trackdb tracks)
+{
+  Require(tracks);
+  size_t na = d_quadrature->number_azimuths_octant();
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    for (size_t o = 0; o < 4; ++o)
+    {
+      for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
+      {
+        size_t azimuth = d_quadrature->azimuth(a);
+        if (o == 1 || o == 3) azimuth += na;
+        size_t angle = d_quadrature->index(o, a);
+        size_t nt = tracks->number_tracks(azimuth);
+        d_boundary_flux[g][angle][IN].assign(nt, 0.0);
+        d_boundary_flux[g][angle][OUT].assign(nt, 0.0);
+      }
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION
 //---------------------------------------------------------------------------//
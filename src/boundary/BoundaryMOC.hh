@@ -13,6 +13,7 @@
 #include "boundary/BoundaryBase.hh"
 #include "boundary/BoundaryConditionMOC.hh"
 #include "geometry/Mesh.hh"
+#include "geometry/TrackDB.hh"
 #include "angle/ProductQuadrature.hh"
 
 namespace detran
@@ -46,6 +47,7 @@ public:
   typedef Mesh::SP_mesh                         SP_mesh;
   typedef detran_angle::ProductQuadrature       QuadratureMOC;
   typedef detran_utilities::SP<QuadratureMOC>   SP_quadrature;
+  typedef detran_geometry::TrackDB::SP_trackdb  SP_trackdb;
   typedef BoundaryConditionMOC<D>               BC_T;
   typedef typename BC_T::SP_bc                  SP_bc;
   typedef detran_utilities::size_t              size_t;
@@ -159,6 +161,14 @@ public:
   void feed_from(const size_t o1, const size_t a1, const size_t t1,
                  size_t &o2, size_t &a2, size_t &t2);
 
+  /**
+   *  @brief Size the track boundary fluxes for a track database.
+   *
+   *  Angles in octants 1 and 3 use the tracks of the azimuths that
+   *  follow those of octant 0, as in the sweep.  All fluxes are zeroed.
+   */
+  void set_tracks(SP_trackdb tracks);
+
   /// Return vector of octant, azimuth, track triplets for a side.
   const vec2_int& side_indices(const size_t side) const
   {
@@ -21,6 +21,7 @@ Matrix::Matrix()
   , d_diagonals(NULL)
   , d_nnz(0)
   , d_allocated(false)
+  , d_values_only(false)
 {
   /* ... */
 }
@@ -34,6 +35,7 @@ Matrix::Matrix(const int m, const int n)
   , d_diagonals(NULL)
   , d_nnz(0)
   , d_allocated(false)
+  , d_values_only(false)
 {
   /* ... */
 }
@@ -41,7 +43,13 @@ Matrix::Matrix(const int m, const int n)
 //----------------------------------------------------------------------------//
 Matrix::Matrix(const int m, const int n, const int nnzrow)
   : MatrixBase(m, n)
+  , d_values(NULL)
+  , d_columns(NULL)
+  , d_rows(NULL)
+  , d_diagonals(NULL)
+  , d_nnz(0)
   , d_allocated(false)
+  , d_values_only(false)
 {
   preallocate(nnzrow);
 }
@@ -49,6 +57,7 @@ Matrix::Matrix(const int m, const int n, const int nnzrow)
 //----------------------------------------------------------------------------//
 Matrix::Matrix(Matrix &A)
   : MatrixBase(A.number_rows(), A.number_columns())
+  , d_values_only(false)
 {
   d_nnz = A.number_nonzeros();
   d_rows      = new int[d_m + 1];
@@ -78,7 +87,7 @@ Matrix::Matrix(Matrix &A)
 //----------------------------------------------------------------------------//
 Matrix::~Matrix()
 {
-  if (d_is_ready)
+  if (d_is_ready || d_values_only)
   {
     delete [] d_values;
     delete [] d_columns;
@@ -129,12 +138,6 @@ void Matrix::preallocate(int* nnzrows)
   d_allocated = true;
 }
 
-//#define db_print_row(i, c)                  \
-//  std::cout << c << std::endl;              \
-//  for (int j = 0; j < d_aij[i].size(); ++j) \
-//    std::cout << d_aij[i][j] << std::endl;
-#define db_print_row(i, c) void(0);
-
 //----------------------------------------------------------------------------//
 void Matrix::assemble()
 {
@@ -143,81 +146,63 @@ void Matrix::assemble()
    *  We construct in COO format, ie with (i,j,v) triplets.  This makes
    *  adding entries much easier.  Now, we need to order everything
    *  so that the resulting CSR storage has for all i-->j, with j in
-   *  order.  The diagonal pointer is also set.  If (i,i,v) doesn't exist,
-   *  we insert it, since that's needed for Gauss-Seidel, preconditioning,
-   *  and other things.
+   *  order.  Repeated (i,j) entries are summed.  The diagonal pointer is
+   *  also set.  If (i,i,v) doesn't exist, we insert it, since that's
+   *  needed for Gauss-Seidel, preconditioning, and other things.
    */
 
+  // refilling an existing pattern leaves nothing to do
+  if (d_values_only)
+  {
+    d_values_only = false;
+    d_is_ready = true;
+    return;
+  }
+
   Insist(!d_is_ready, "This matrix must not have been assembled already.");
   Insist(d_allocated, "This matrix must be allocated before assembling.");
 
   typedef std::vector<triplet_T>::iterator it_T;
 
-  // sort the coo structure
-  d_nnz = 0;
+  // allocate the row pointers, which temporarily hold the row sizes
+  d_rows = new int[d_m + 1];
+  d_rows[0] = 0;
+
+  // sort and merge the coo rows, each of which is independent
+  #pragma omp parallel for schedule(static) if (d_m > OMP_MINIMUM_ROWS)
   for (int i = 0; i < d_m; i++)
   {
-    db_print_row(i, "before sort")
-
-    // do the sort
-    std::sort(d_aij[i].begin(), d_aij[i].end(), compare_triplet);
-
-    db_print_row(i, "after sort")
-
-    // remove empty entries (if not entered, i,j==-1)
-    while ((d_aij[i].end()-1)->j == -1)
-      d_aij[i].pop_back();
-
-    db_print_row(i, "after pop")
-
+    merge_row(i);
+    // remove empty entries
+    d_aij[i].resize(d_counter[i]);
     // find and/or insert the diagonal
-    Assert(d_aij[i].size());
     if (i < d_n)
     {
-      int d = 0;
-      while(d < d_aij[i].size())
-      {
-
-        if (d_aij[i][d].j == d_aij[i][d].i)
-        {
-          d = 0;
-          break;
-        }
-        else if (d_aij[i][d].j > d_aij[i][d].i)
-        {
-          d = d + 1;
-          break;
-        }
-        ++d;
-      }
-      --d;
-      if (d >= 0 && i < d_n)
-      {
-        d_aij[i].insert(d_aij[i].begin()+d, triplet_T(i, i, 0.0));
-        std::sort(d_aij[i].begin(), d_aij[i].end(), compare_triplet);
-
-      }
+      it_T d = std::lower_bound(d_aij[i].begin(), d_aij[i].end(),
+                                triplet_T(i, i, 0.0), compare_triplet);
+      if (d == d_aij[i].end() || d->j != i)
+        d_aij[i].insert(d, triplet_T(i, i, 0.0));
     }
-
-    db_print_row(i, "after diag")
-
-    // update the total nonzero count
-    d_nnz += d_aij[i].size();
+    Assert(d_aij[i].size());
+    d_rows[i + 1] = d_aij[i].size();
   }
 
+  // convert row sizes to row pointers
+  for (int i = 0; i < d_m; i++)
+    d_rows[i + 1] += d_rows[i];
+  d_nnz = d_rows[d_m];
+
   // allocate
-  d_rows = new int[d_m + 1];
   d_columns = new int[d_nnz];
   d_values = new double[d_nnz];
   d_diagonals = new int[d_m];
 
   // fill the csr storage
-  d_rows[0] = 0;
-  // pointer to value index
-  int p = 0;
-  // for all rows
+  #pragma omp parallel for schedule(static) if (d_m > OMP_MINIMUM_ROWS)
   for (int i = 0; i < d_m; i++)
   {
+    d_diagonals[i] = -1;
+    int p = d_rows[i];
     // for all columns in the row
     for (size_t j = 0; j < d_aij[i].size(); ++j, ++p)
     {
@@ -226,9 +211,8 @@ void Matrix::assemble()
       // store diagonal index
       if (d_columns[p] == i) d_diagonals[i] = p;
     }
-    d_rows[i + 1] = p;
     // delete this row of coo storage
-    d_aij[i].clear();
+    std::vector<triplet_T>().swap(d_aij[i]);
   }
   // delete the coo storage and specify the matrix is set to use
   d_aij.clear();
@@ -242,6 +226,38 @@ void Matrix::assemble()
   d_is_ready = true;
 }
 
+//----------------------------------------------------------------------------//
+void Matrix::reset_values()
+{
+  Insist(d_is_ready, "Only an assembled matrix can have its values reset.");
+  for (int p = 0; p < d_nnz; ++p)
+    d_values[p] = 0.0;
+  d_values_only = true;
+  d_is_ready = false;
+}
+
+//----------------------------------------------------------------------------//
+bool Matrix::merge_row(const int i)
+{
+  typedef std::vector<triplet_T>::iterator it_T;
+  it_T begin = d_aij[i].begin();
+  int n = d_counter[i];
+  std::sort(begin, begin + n, compare_triplet);
+  // sum runs of a repeated column into their first entry
+  int k = 0;
+  for (int p = 0; p < n; ++p)
+  {
+    if (k > 0 && d_aij[i][k - 1].j == d_aij[i][p].j)
+      d_aij[i][k - 1].v += d_aij[i][p].v;
+    else
+      d_aij[i][k++] = d_aij[i][p];
+  }
+  for (int p = k; p < n; ++p)
+    d_aij[i][p] = triplet_T();
+  d_counter[i] = k;
+  return k < n;
+}
+
 //----------------------------------------------------------------------------//
 void Matrix::display(bool forceprint) const
 {
@@ -295,6 +311,13 @@ void Matrix::clear()
 {
   // save the memory used and reallocate
 
+  // a partial refill still owns the assembled storage
+  if (d_values_only)
+  {
+    d_values_only = false;
+    d_is_ready = true;
+  }
+
 //  if (!d_allocated) return;
 //  d_allocated = false;
 
@@ -42,17 +42,14 @@ namespace callow
  *  array of values for each row.  The reason the row storage is needed rather
  *  than say the total number of nonzero entries is to make construction
  *  easier.  During construction, the matrix is stored (temporarily) in
- *  coordinate (COO) format, i.e. a list of (i, j, value) triplets.  If
- *  this were stored in one monolithic array, the construction of the CSR
- *  structure would require we sort all the triplets by  row and then by
- *  column (since we want explicit access to L, D, and U).  Initial testing
- *  proved that sorting is just too time consuming, even with an n*log(n)
- *  methodlike quicksort.
+ *  coordinate (COO) format, i.e. a list of (i, j, value) triplets, kept
+ *  by row.  For now, the size of a row can not be increased.
  *
- *  Consequently, we do keep (i, j, value) triplets, but they are stored by
- *  row, and to store by row, we need an initial guess of how many entries
- *  there are.  For now, the size can not be increased, but that would not be
- *  too difficult.
+ *  Inserting never searches a row.  Entries are appended, and at assembly
+ *  each row is sorted by column and repeated (i, j) entries are summed.
+ *  Hence, ADD is just an append.  A row that fills up is merged in place,
+ *  which either makes room or leaves a sorted row that can be searched.
+ *  The rows are independent, so assembly is threaded over rows.
  *
  *  Using the COO format during construction allows the user to add entries
  *  one at a time, a row at a time, a column at a time, or several triplets
@@ -60,6 +57,12 @@ namespace callow
  *  and column and that a diagonal entry exists.  That latter is required for
  *  things like the @ref Jacobi or @ref GaussSeidel solvers, along with certain
  *  preconditioner types.
+ *
+ *  When only the coefficients change (e.g. a loss operator rebuilt for a
+ *  new keff), call reset_values() on the assembled matrix.  This zeros the
+ *  values but keeps the CSR structure, so subsequent inserts are added
+ *  directly into place, and assemble() only marks the matrix ready again.
+ *  Inserting an entry outside of the existing pattern fails.
  */
 /**
  *  @example callow/test/test_Matrix.cc
@@ -81,6 +84,9 @@ public:
     INSERT, ADD, END_INSERT_TYPE
   };
 
+  /// Minimum number of rows for which assembly is threaded
+  enum {OMP_MINIMUM_ROWS = 1000};
+
   //--------------------------------------------------------------------------//
   // TYPEDEFS
   //--------------------------------------------------------------------------//
@@ -126,6 +132,11 @@ public:
   /// add n triplets  (return false if can't add)
   bool insert(int *i, int *j, double *v, int n, const int type = INSERT);
 
+  /// zero the values of an assembled matrix to refill its existing pattern
+  void reset_values();
+  /// is the matrix being refilled within its existing pattern?
+  bool values_only() const {return d_values_only;}
+
   /// starting index for a row
   int start(const int i) const;
   /// diagonal index for a row
@@ -192,6 +203,8 @@ protected:
   std::vector<std::vector<triplet> > d_aij;
   // counts entries added per row
   detran_utilities::vec_int d_counter;
+  /// are values being inserted into an existing pattern?
+  bool d_values_only;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -199,6 +212,10 @@ protected:
 
   /// internal preallocation
   void preallocate();
+  /// sort a coo row by column and sum repeats (return true if space freed)
+  bool merge_row(const int i);
+  /// add a value into the existing pattern (return false if not present)
+  bool insert_values_only(const int i, const int j, const double v);
 
 };
 
@@ -71,19 +71,11 @@ inline double Matrix::operator()(const int i, const int j) const
   Require(d_is_ready);
   Require(i >= 0 && i < d_m);
   Require(j >= 0 && j < d_n);
-  // loop through elements in this row
-  if (i == j)
-    return d_values[d_diagonals[i]];
-  else if (i < j)
-  {
-    for (int k = d_rows[i]; k < d_diagonals[i]; k++)
-      if (d_columns[k] == j) return d_values[k];
-  }
-  else
-  {
-    for (int k = d_diagonals[i] + 1; k < d_rows[i + 1]; k++)
-      if (d_columns[k] == j) return d_values[k];
-  }
+  // columns are sorted within a row
+  const int *begin = d_columns + d_rows[i];
+  const int *end   = d_columns + d_rows[i + 1];
+  const int *p = std::lower_bound(begin, end, j);
+  if (p != end && *p == j) return d_values[p - d_columns];
   // otherwise, this is a zeros
   return 0.0;
 }
@@ -133,18 +125,22 @@ inline void Matrix::multiply_transpose(const Vector &x, Vector &y)
                    const_cast<Vector* >(&x)->petsc_vector(),
                    y.petsc_vector());
 #else
-  // clear the output vector
-  y.scale(0);
-  // for all rows (now columns)
-  for (int i = 0; i < d_m; i++)
+  // each thread scatters its rows (now columns) into its own copy of y
+  std::vector<double> work;
+  int number_threads = 1;
+  #pragma omp parallel if (d_m > OMP_MINIMUM_ROWS)
   {
-    // for all columns (now rows)
-    for (int p = d_rows[i]; p < d_rows[i + 1]; p++)
+    double *w = transpose_work(work, number_threads);
+    #pragma omp for schedule(static)
+    for (int i = 0; i < d_m; i++)
     {
-      int j = d_columns[p];
-      y[j] += x[i] * d_values[p];
+      double x_i = x[i];
+      // for all columns (now rows)
+      for (int p = d_rows[i]; p < d_rows[i + 1]; p++)
+        w[d_columns[p]] += x_i * d_values[p];
     }
   }
+  reduce_transpose_work(work, number_threads, y);
 #endif
 }
 
@@ -155,25 +151,27 @@ inline void Matrix::multiply_transpose(const Vector &x, Vector &y)
 //----------------------------------------------------------------------------//
 inline bool Matrix::insert(int i, int j, double v, const int type)
 {
-  Require(!d_is_ready);
   Require(d_allocated);
   Require(i >= 0 && i < d_m);
   Require(j >= 0 && j < d_n);
-  // add to a current entry if found
-  if (type == ADD)
+  if (d_values_only) return insert_values_only(i, j, v);
+  Require(!d_is_ready);
+  // repeated entries are summed at assembly, so ADD simply appends.  if
+  // the row is full, its repeats are merged, which either makes room or
+  // leaves a sorted row in which to find the entry.
+  if (d_counter[i] >= d_aij[i].size())
   {
-    for (size_t p = 0; p < d_aij[i].size(); ++p)
+    if (type != ADD) return false;
+    if (!merge_row(i))
     {
-      if (d_aij[i][p].j == j)
-      {
-        d_aij[i][p].v += v;
-        return true;
-      }
+      std::vector<triplet_T>::iterator p =
+        std::lower_bound(d_aij[i].begin(), d_aij[i].begin() + d_counter[i],
+                         triplet_T(i, j, 0.0), compare_triplet);
+      if (p == d_aij[i].begin() + d_counter[i] || p->j != j) return false;
+      p->v += v;
+      return true;
     }
   }
-  // otherwise it didn't exist and return if storage unavailable
-  if (d_counter[i] >= d_aij[i].size()) return false;
-  // otherwise, add the entry
   d_aij[i][d_counter[i]].i = i;
   d_aij[i][d_counter[i]].j = j;
   d_aij[i][d_counter[i]].v = v;
@@ -184,31 +182,15 @@ inline bool Matrix::insert(int i, int j, double v, const int type)
 //----------------------------------------------------------------------------//
 inline bool Matrix::insert(int i, int *j, double *v, int n, const int type)
 {
-  Require(!d_is_ready);
   Require(d_allocated);
   Require(i >= 0 && i < d_m);
-  if (type == ADD)
+  if (type == ADD || d_values_only)
   {
-    // loop through all columns given
     for (int jj = 0; jj < n; ++jj)
-    {
-      bool flag = false;
-      for (size_t p = 0; p < d_aij[i].size(); ++p)
-      {
-        if (d_aij[i][p].j == j[jj])
-        {
-          d_aij[i][p].v += v[jj];
-          flag = true;
-          break;
-        }
-      }
-      if (!flag) // insert if not present
-        flag = insert(i, j[jj], v[jj], INSERT);
-      if (!flag) return false; // fail if we can't insert
-    }
+      if (!insert(i, j[jj], v[jj], type)) return false;
     return true;
   }
-  // otherwise it didn't exist and return if storage unavailable
+  Require(!d_is_ready);
   // return if storage unavailable
   if (d_counter[i] + n >  d_aij[i].size()) return false;
   // otherwise, add the entries
@@ -226,10 +208,15 @@ inline bool Matrix::insert(int i, int *j, double *v, int n, const int type)
 //----------------------------------------------------------------------------//
 inline bool Matrix::insert(int *i, int j, double *v, int n, const int type)
 {
-  Require(!d_is_ready);
   Require(d_allocated);
   Require(j >= 0 && j < d_n);
-  Insist(type == INSERT, "Cannot ADD by column");
+  if (type == ADD || d_values_only)
+  {
+    for (int ii = 0; ii < n; ++ii)
+      if (!insert(i[ii], j, v[ii], type)) return false;
+    return true;
+  }
+  Require(!d_is_ready);
   // return if storage unavailable
   for (int ii = 0; ii < n; ++ii)
   {
@@ -251,20 +238,33 @@ inline bool Matrix::insert(int *i, int j, double *v, int n, const int type)
 //----------------------------------------------------------------------------//
 inline bool Matrix::insert(int *i, int *j, double *v, int n, const int type)
 {
-  Require(!d_is_ready);
   Require(d_allocated);
-  Insist(type == INSERT, "Cannot ADD by row, column, value triplet")
-  // return if storage unavailable
-  // \todo this assumes one entry per row---fix
-  for (int k = 0; k < n; ++k)
+  if (type == ADD || d_values_only)
+  {
+    for (int k = 0; k < n; ++k)
+      if (!insert(i[k], j[k], v[k], type)) return false;
+    return true;
+  }
+  Require(!d_is_ready);
+  // return if storage unavailable, counting entries that share a row by
+  // provisionally advancing the row counters
+  int k = 0;
+  for (; k < n; ++k)
   {
     Require(i[k] >= 0 && i[k] < d_m);
     Require(j[k] >= 0 && j[k] < d_n);
-    if (d_counter[i[k]] + 1 > d_aij[i[k]].size())
-      return false;
+    if (d_counter[i[k]] >= d_aij[i[k]].size()) break;
+    ++d_counter[i[k]];
+  }
+  bool fits = (k == n);
+  while (k > 0)
+  {
+    --k;
+    --d_counter[i[k]];
   }
+  if (!fits) return false;
   // otherwise, add the entries
-  for (int k = 0; k < n; ++k)
+  for (k = 0; k < n; ++k)
   {
     d_aij[i[k]][d_counter[i[k]]].i = i[k];
     d_aij[i[k]][d_counter[i[k]]].j = j[k];
@@ -274,6 +274,19 @@ inline bool Matrix::insert(int *i, int *j, double *v, int n, const int type)
   return true;
 }
 
+//----------------------------------------------------------------------------//
+inline bool Matrix::insert_values_only(const int i, const int j, const double v)
+{
+  // the values were zeroed, so INSERT and ADD both accumulate, just as
+  // repeated entries are summed during a full assembly
+  const int *begin = d_columns + d_rows[i];
+  const int *end   = d_columns + d_rows[i + 1];
+  const int *p = std::lower_bound(begin, end, j);
+  if (p == end || *p != j) return false;
+  d_values[p - d_columns] += v;
+  return true;
+}
+
 } // end namespace callow
 
 #endif /* callow_MATRIX_I_HH_ */
@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixBCSR.cc
+ *  @brief MatrixBCSR member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "MatrixBCSR.hh"
+#include <algorithm>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+MatrixBCSR::MatrixBCSR(Matrix &A, const int block_size, const bool strided)
+  : MatrixBase(A.number_rows(), A.number_columns())
+  , d_block_size(block_size)
+  , d_strided(strided)
+  , d_number_block_rows(0)
+{
+  Insist(A.is_ready(), "A BCSR matrix requires an assembled CSR matrix.");
+  Insist(d_m == d_n, "A BCSR matrix must be square.");
+  Insist(d_block_size > 0 && d_m % d_block_size == 0,
+         "The block size must divide the matrix size.");
+
+  const int     b       = d_block_size;
+  const int    *rows    = A.rows();
+  const int    *columns = A.columns();
+  const double *values  = A.values();
+  d_number_block_rows = d_m / b;
+  const int nb = d_number_block_rows;
+
+  // find the block columns of each block row
+  d_rows.assign(nb + 1, 0);
+  std::vector<std::vector<int> > block_columns(nb);
+  for (int I = 0; I < nb; ++I)
+  {
+    for (int r = 0; r < b; ++r)
+    {
+      int i = index(I, r);
+      for (int p = rows[i]; p < rows[i + 1]; ++p)
+        block_columns[I].push_back(d_strided ? columns[p] % nb
+                                             : columns[p] / b);
+    }
+    std::sort(block_columns[I].begin(), block_columns[I].end());
+    block_columns[I].erase(std::unique(block_columns[I].begin(),
+                                       block_columns[I].end()),
+                           block_columns[I].end());
+    d_rows[I + 1] = d_rows[I] + block_columns[I].size();
+  }
+
+  // fill the blocks
+  d_columns.resize(d_rows[nb]);
+  d_values.assign(d_rows[nb] * b * b, 0.0);
+  for (int I = 0; I < nb; ++I)
+  {
+    std::copy(block_columns[I].begin(), block_columns[I].end(),
+              d_columns.begin() + d_rows[I]);
+    for (int r = 0; r < b; ++r)
+    {
+      int i = index(I, r);
+      for (int p = rows[i]; p < rows[i + 1]; ++p)
+      {
+        int J = d_strided ? columns[p] % nb : columns[p] / b;
+        int k = d_strided ? columns[p] / nb : columns[p] % b;
+        int q = std::lower_bound(block_columns[I].begin(),
+                                 block_columns[I].end(), J)
+              - block_columns[I].begin() + d_rows[I];
+        d_values[q * b * b + k * b + r] = values[p];
+      }
+    }
+  }
+  d_is_ready = true;
+}
+
+//----------------------------------------------------------------------------//
+MatrixBCSR::SP_matrix
+MatrixBCSR::Create(Matrix &A, const int block_size, const bool strided)
+{
+  SP_matrix p(new MatrixBCSR(A, block_size, strided));
+  return p;
+}
+
+//----------------------------------------------------------------------------//
+void MatrixBCSR::assemble()
+{
+  Insist(d_is_ready, "A BCSR matrix is assembled on construction.");
+}
+
+//----------------------------------------------------------------------------//
+void MatrixBCSR::display(bool forceprint) const
+{
+  Require(d_is_ready);
+  const int b = d_block_size;
+  printf(" BCSR matrix \n");
+  printf(" ---------------------------\n");
+  printf("      number rows = %5i \n",   d_m);
+  printf("   number columns = %5i \n",   d_n);
+  printf("       block size = %5i \n",   b);
+  printf("          strided = %5i \n",   (int) d_strided);
+  printf("    number blocks = %5i \n\n", (int) d_columns.size());
+  if ((d_m > 20 || d_n > 20) && !forceprint)
+  {
+    printf("  *** matrix not printed for m or n > 20 *** \n");
+    return;
+  }
+  for (int I = 0; I < d_number_block_rows; ++I)
+  {
+    for (int r = 0; r < b; ++r)
+    {
+      printf(" row  %3i | ", index(I, r));
+      for (int p = d_rows[I]; p < d_rows[I + 1]; ++p)
+      {
+        for (int k = 0; k < b; ++k)
+        {
+          double v = d_values[p * b * b + k * b + r];
+          if (v != 0.0) printf(" %3i (%13.6e)", index(d_columns[p], k), v);
+        }
+      }
+      printf("\n");
+    }
+  }
+  printf("\n");
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of MatrixBCSR.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixBCSR.hh
+ *  @brief MatrixBCSR class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_MATRIXBCSR_HH_
+#define callow_MATRIXBCSR_HH_
+
+#include "Matrix.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class MatrixBCSR
+ *  @brief Block compressed row storage matrix
+ *
+ *  The unknowns are partitioned into blocks of b entries, and the matrix
+ *  is stored as a CSR matrix of dense b x b blocks.  Only one column
+ *  index is kept per block, and each block is stored column-major, so
+ *  the product with a block is a series of unit-stride updates of b rows
+ *  that the compiler can vectorize.
+ *
+ *  Blocks can be contiguous (unknown i is entry i % b of block i / b) or
+ *  strided (unknown i is entry i / nb of block i % nb, with nb = n / b).
+ *  The latter is the natural choice for the multigroup diffusion and CMFD
+ *  operators, which order unknowns by group and then cell: with b equal
+ *  to the number of groups, each block holds all groups of one cell, so
+ *  the scattering and fission couplings fall in the diagonal blocks and
+ *  the 5/7-point stencil gives the off-diagonal blocks.
+ *
+ *  A BCSR matrix is converted from an assembled square @ref Matrix, whose
+ *  values it copies.
+ */
+class CALLOW_EXPORT MatrixBCSR: public MatrixBase
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<MatrixBCSR>  SP_matrix;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param A            assembled, square CSR matrix
+   *  @param block_size   number of unknowns per block
+   *  @param strided      are block entries strided rather than contiguous?
+   */
+  MatrixBCSR(Matrix &A, const int block_size, const bool strided = false);
+  virtual ~MatrixBCSR(){}
+  static SP_matrix Create(Matrix &A,
+                          const int  block_size,
+                          const bool strided = false);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// number of unknowns per block
+  int block_size() const { return d_block_size; }
+  /// number of block rows
+  int number_block_rows() const { return d_number_block_rows; }
+  /// number of stored blocks
+  int number_blocks() const { return d_columns.size(); }
+  /// unknown index of entry k of block I
+  int index(const int I, const int k) const
+  {
+    return d_strided ? I + k * d_number_block_rows : I * d_block_size + k;
+  }
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL MATRICES MUST IMPLEMENT
+  //--------------------------------------------------------------------------//
+
+  // postprocess storage (done on construction)
+  void assemble();
+  // action y <-- A * x
+  void multiply(const Vector &x,  Vector &y);
+  // action y <-- A' * x
+  void multiply_transpose(const Vector &x, Vector &y);
+  // pretty print to screen
+  void display(bool forceprint = false) const;
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// unknowns per block
+  int d_block_size;
+  /// are block entries strided?
+  bool d_strided;
+  /// number of block rows (and columns)
+  int d_number_block_rows;
+  /// block row pointers
+  std::vector<int> d_rows;
+  /// block column indices
+  std::vector<int> d_columns;
+  /// block elements, column-major within each block
+  std::vector<double> d_values;
+
+};
+
+CALLOW_TEMPLATE_EXPORT(detran_utilities::SP<MatrixBCSR>)
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//----------------------------------------------------------------------------//
+
+#include "MatrixBCSR.i.hh"
+
+#endif /* callow_MATRIXBCSR_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of MatrixBCSR.hh
+//----------------------------------------------------------------------------//
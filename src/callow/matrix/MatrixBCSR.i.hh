@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixBCSR.i.hh
+ *  @brief MatrixBCSR inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_MATRIXBCSR_I_HH_
+#define callow_MATRIXBCSR_I_HH_
+
+#include "utilities/DBC.hh"
+#include <vector>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+inline void MatrixBCSR::multiply(const Vector &x, Vector &y)
+{
+  Require(d_is_ready);
+  Require(x.size() == d_n);
+  Require(y.size() == d_m);
+  const double *X = &x[0];
+  double       *Y = &y[0];
+  const int     b = d_block_size;
+  #pragma omp parallel if (d_m > Matrix::OMP_MINIMUM_ROWS)
+  {
+    std::vector<double> work(b, 0.0);
+    double *temp = &work[0];
+    #pragma omp for schedule(static)
+    for (int I = 0; I < d_number_block_rows; ++I)
+    {
+      for (int r = 0; r < b; ++r)
+        temp[r] = 0.0;
+      for (int p = d_rows[I]; p < d_rows[I + 1]; ++p)
+      {
+        const double *v = &d_values[0] + p * b * b;
+        const int     J = d_columns[p];
+        // each column of the block updates all of its rows at once
+        for (int k = 0; k < b; ++k, v += b)
+        {
+          const double x_k = X[index(J, k)];
+          for (int r = 0; r < b; ++r)
+            temp[r] += v[r] * x_k;
+        }
+      }
+      for (int r = 0; r < b; ++r)
+        Y[index(I, r)] = temp[r];
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+inline void MatrixBCSR::multiply_transpose(const Vector &x, Vector &y)
+{
+  Require(d_is_ready);
+  Require(x.size() == d_m);
+  Require(y.size() == d_n);
+  const double *X = &x[0];
+  const int     b = d_block_size;
+  // each thread scatters its block rows into its own copy of y
+  std::vector<double> work;
+  int number_threads = 1;
+  #pragma omp parallel if (d_m > Matrix::OMP_MINIMUM_ROWS)
+  {
+    double *w = transpose_work(work, number_threads);
+    std::vector<double> work(b, 0.0);
+    double *temp = &work[0];
+    #pragma omp for schedule(static)
+    for (int I = 0; I < d_number_block_rows; ++I)
+    {
+      for (int r = 0; r < b; ++r)
+        temp[r] = X[index(I, r)];
+      for (int p = d_rows[I]; p < d_rows[I + 1]; ++p)
+      {
+        const double *v = &d_values[0] + p * b * b;
+        const int     J = d_columns[p];
+        // a column of the block is a unit-stride dot product
+        for (int k = 0; k < b; ++k, v += b)
+        {
+          double sum = 0.0;
+          for (int r = 0; r < b; ++r)
+            sum += v[r] * temp[r];
+          w[index(J, k)] += sum;
+        }
+      }
+    }
+  }
+  reduce_transpose_work(work, number_threads, y);
+}
+
+} // end namespace callow
+
+#endif /* callow_MATRIXBCSR_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of MatrixBCSR.i.hh
+//----------------------------------------------------------------------------//
@@ -9,6 +9,9 @@
 #include "MatrixBase.hh"
 #include "utils/Typedefs.hh"
 #include <iostream>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace callow
 {
@@ -54,6 +57,15 @@ void MatrixBase::set_size(const int m, const int n)
   d_sizes_set = true;
 }
 
+//----------------------------------------------------------------------------//
+void MatrixBase::multiply_block(const std::vector<SP_vector> &x,
+                                std::vector<SP_vector>       &y)
+{
+  Require(x.size() == y.size());
+  for (size_t j = 0; j < x.size(); ++j)
+    multiply(*x[j], *y[j]);
+}
+
 //----------------------------------------------------------------------------//
 void MatrixBase::compute_explicit(std::string filename)
 {
@@ -74,6 +86,45 @@ void MatrixBase::print_matlab(std::string filename)
   /* ... */
 }
 
+//----------------------------------------------------------------------------//
+double* MatrixBase::transpose_work(std::vector<double> &work,
+                                   int                 &number_threads)
+{
+  // The team may be smaller than requested, so size and zero the copies
+  // from the team that actually runs.  The single ends in a barrier.
+  #pragma omp single
+  {
+    number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+    number_threads = omp_get_num_threads();
+#endif
+    work.assign(number_threads * d_n, 0.0);
+  }
+  int thread = 0;
+#ifdef DETRAN_ENABLE_OPENMP
+  thread = omp_get_thread_num();
+#endif
+  return &work[thread * d_n];
+}
+
+//----------------------------------------------------------------------------//
+void MatrixBase::reduce_transpose_work(const std::vector<double> &work,
+                                       const int                  number_threads,
+                                       Vector                    &y)
+{
+  Require(y.size() == d_n);
+  Require(work.size() == number_threads * d_n);
+  const double *w = &work[0];
+  #pragma omp parallel for schedule(static) if (number_threads > 1)
+  for (int j = 0; j < d_n; ++j)
+  {
+    double v = 0.0;
+    for (int t = 0; t < number_threads; ++t)
+      v += w[t * d_n + j];
+    y[j] = v;
+  }
+}
+
 } // end namespace callow
 
 //----------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 #include "callow/callow_config.hh"
 #include "callow/vector/Vector.hh"
 #include "utilities/SP.hh"
+#include <vector>
 
 namespace callow
 {
@@ -68,6 +69,15 @@ public:
     multiply_transpose(*x, *y);
   }
 
+  /**
+   *  Multiply a block of vectors, y[j] <-- A * x[j].  By default, the
+   *  vectors are multiplied one at a time.  Operators that can share
+   *  work among the vectors, e.g. one transport sweep carrying several
+   *  sources, should override this.
+   */
+  virtual void multiply_block(const std::vector<SP_vector> &x,
+                              std::vector<SP_vector>       &y);
+
   // compute and print the explicit operator (even if shell)
   virtual void compute_explicit(std::string filename = "matrix.out");
   // print output for reading into matlab
@@ -105,6 +115,25 @@ protected:
   /// PETSc matrix
   Mat d_petsc_matrix;
 
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  A transpose product scatters into the output, so each thread sums
+   *  its rows into a private copy of y, and the copies are then reduced.
+   *  Called by every thread of the region, transpose_work sizes the
+   *  caller's buffer for the team, zeros it, records the team size, and
+   *  returns the calling thread's copy.  reduce_transpose_work then sums
+   *  the copies into y.
+   */
+  //@{
+  double* transpose_work(std::vector<double> &work, int &number_threads);
+  void reduce_transpose_work(const std::vector<double> &work,
+                             const int                  number_threads,
+                             Vector                    &y);
+  //@}
+
 };
 
 CALLOW_TEMPLATE_EXPORT(detran_utilities::SP<MatrixBase>)
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixFormat.cc
+ *  @brief MatrixFormat member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "MatrixFormat.hh"
+#include "Matrix.hh"
+#include "MatrixSELL.hh"
+#include "MatrixBCSR.hh"
+#include "utilities/GenException.hh"
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+MatrixFormat::MatrixFormat(const int  format,
+                           const int  block_size,
+                           const bool strided)
+  : d_format(format)
+  , d_block_size(block_size)
+  , d_strided(strided)
+{
+  Require(d_format >= 0 && d_format < END_FORMATS);
+  Require(d_block_size > 0);
+}
+
+//----------------------------------------------------------------------------//
+MatrixFormat::MatrixFormat(SP_db db, const std::string &prefix)
+  : d_format(CSR)
+  , d_block_size(1)
+  , d_strided(false)
+{
+  if (!db) return;
+  if (db->check(prefix + "_matrix_format"))
+  {
+    std::string name = db->get<std::string>(prefix + "_matrix_format");
+    if (name == "csr")
+      d_format = CSR;
+    else if (name == "sell")
+      d_format = SELL;
+    else if (name == "bcsr")
+      d_format = BCSR;
+    else
+      THROW("Unsupported matrix format: " + name);
+  }
+  if (db->check(prefix + "_matrix_block_size"))
+    d_block_size = db->get<int>(prefix + "_matrix_block_size");
+  if (db->check(prefix + "_matrix_block_strided"))
+    d_strided = 0 != db->get<int>(prefix + "_matrix_block_strided");
+  Insist(d_block_size > 0, "The matrix block size must be positive.");
+}
+
+//----------------------------------------------------------------------------//
+MatrixFormat::SP_matrix MatrixFormat::convert(SP_matrix A) const
+{
+  Require(A);
+  if (d_format == CSR) return A;
+  Matrix *B = dynamic_cast<Matrix*>(A.bp());
+  if (!B || !B->is_ready()) return A;
+  SP_matrix C;
+  if (d_format == SELL)
+    C = new MatrixSELL(*B);
+  else
+    C = new MatrixBCSR(*B, d_block_size, d_strided);
+  return C;
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of MatrixFormat.cc
+//----------------------------------------------------------------------------//
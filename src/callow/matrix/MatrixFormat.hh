@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixFormat.hh
+ *  @brief MatrixFormat class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_MATRIXFORMAT_HH_
+#define callow_MATRIXFORMAT_HH_
+
+#include "MatrixBase.hh"
+#include "utilities/InputDB.hh"
+#include <string>
+
+namespace callow
+{
+
+/**
+ *  @class MatrixFormat
+ *  @brief Converts assembled CSR matrices to other storage formats
+ *
+ *  Solvers that only need the action of an operator can use whichever
+ *  storage gives the fastest product.  The format is selected with the
+ *  database keys
+ *    - <prefix>_matrix_format        "csr" (default), "sell", or "bcsr"
+ *    - <prefix>_matrix_block_size    unknowns per block for "bcsr"
+ *    - <prefix>_matrix_block_strided 1 if block entries are strided
+ *  where the prefix is e.g. "linear_solver" or "eigen_solver".
+ *
+ *  @sa MatrixSELL, MatrixBCSR
+ */
+class CALLOW_EXPORT MatrixFormat
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //--------------------------------------------------------------------------//
+
+  enum FORMATS
+  {
+    CSR, SELL, BCSR, END_FORMATS
+  };
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef MatrixBase::SP_matrix                 SP_matrix;
+  typedef detran_utilities::InputDB::SP_input   SP_db;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /// Default to CSR, i.e. no conversion
+  MatrixFormat(const int  format     = CSR,
+               const int  block_size = 1,
+               const bool strided    = false);
+
+  /// Read the format from the keys with the given prefix
+  MatrixFormat(SP_db db, const std::string &prefix);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Convert a matrix to this format
+   *
+   *  Only an assembled @ref Matrix is converted.  Other matrices, and any
+   *  matrix when the format is CSR, are returned as is.
+   */
+  SP_matrix convert(SP_matrix A) const;
+
+  /// The format
+  int format() const { return d_format; }
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  int  d_format;
+  int  d_block_size;
+  bool d_strided;
+
+};
+
+} // end namespace callow
+
+#endif /* callow_MATRIXFORMAT_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of MatrixFormat.hh
+//----------------------------------------------------------------------------//
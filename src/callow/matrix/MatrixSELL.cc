@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixSELL.cc
+ *  @brief MatrixSELL member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "MatrixSELL.hh"
+#include <algorithm>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+/// Orders rows by decreasing length
+struct compare_row_length
+{
+  compare_row_length(const std::vector<int> &length) : d_length(length) {}
+  bool operator()(const int i, const int j) const
+  {
+    return d_length[i] > d_length[j];
+  }
+  const std::vector<int> &d_length;
+};
+
+//----------------------------------------------------------------------------//
+MatrixSELL::MatrixSELL(Matrix &A, const int chunk, const int sigma)
+  : MatrixBase(A.number_rows(), A.number_columns())
+  , d_chunk(chunk)
+  , d_sigma(sigma)
+  , d_number_chunks(0)
+  , d_nnz(A.number_nonzeros())
+{
+  Insist(A.is_ready(), "A SELL matrix requires an assembled CSR matrix.");
+  Require(d_chunk > 0 && d_chunk <= MAXIMUM_CHUNK);
+  Require(d_sigma > 0 && d_sigma % d_chunk == 0);
+
+  const int *rows    = A.rows();
+  const int *columns = A.columns();
+  const double *values = A.values();
+
+  // sort rows by decreasing length within each window
+  std::vector<int> length(d_m, 0);
+  std::vector<int> order(d_m, 0);
+  for (int i = 0; i < d_m; ++i)
+  {
+    length[i] = rows[i + 1] - rows[i];
+    order[i] = i;
+  }
+  for (int i = 0; i < d_m; i += d_sigma)
+  {
+    int end = std::min(i + d_sigma, d_m);
+    std::stable_sort(order.begin() + i, order.begin() + end,
+                     compare_row_length(length));
+  }
+
+  // assign rows to chunk slots and size the chunks
+  d_number_chunks = (d_m + d_chunk - 1) / d_chunk;
+  d_row_of_slot.assign(d_number_chunks * d_chunk, -1);
+  d_chunk_starts.assign(d_number_chunks + 1, 0);
+  for (int c = 0; c < d_number_chunks; ++c)
+  {
+    int width = 0;
+    for (int r = 0; r < d_chunk && c * d_chunk + r < d_m; ++r)
+    {
+      int i = order[c * d_chunk + r];
+      d_row_of_slot[c * d_chunk + r] = i;
+      width = std::max(width, length[i]);
+    }
+    d_chunk_starts[c + 1] = d_chunk_starts[c] + width * d_chunk;
+  }
+
+  // fill the chunks column by column.  padding points to column zero.
+  d_columns.assign(d_chunk_starts[d_number_chunks], 0);
+  d_values.assign(d_chunk_starts[d_number_chunks], 0.0);
+  for (int c = 0; c < d_number_chunks; ++c)
+  {
+    for (int r = 0; r < d_chunk; ++r)
+    {
+      int i = d_row_of_slot[c * d_chunk + r];
+      if (i < 0) continue;
+      for (int k = 0; k < length[i]; ++k)
+      {
+        int q = d_chunk_starts[c] + k * d_chunk + r;
+        d_columns[q] = columns[rows[i] + k];
+        d_values[q]  = values[rows[i] + k];
+      }
+    }
+  }
+  d_is_ready = true;
+}
+
+//----------------------------------------------------------------------------//
+MatrixSELL::SP_matrix
+MatrixSELL::Create(Matrix &A, const int chunk, const int sigma)
+{
+  SP_matrix p(new MatrixSELL(A, chunk, sigma));
+  return p;
+}
+
+//----------------------------------------------------------------------------//
+void MatrixSELL::assemble()
+{
+  Insist(d_is_ready, "A SELL matrix is assembled on construction.");
+}
+
+//----------------------------------------------------------------------------//
+void MatrixSELL::display(bool forceprint) const
+{
+  Require(d_is_ready);
+  printf(" SELL-C-sigma matrix \n");
+  printf(" ---------------------------\n");
+  printf("      number rows = %5i \n",   d_m);
+  printf("   number columns = %5i \n",   d_n);
+  printf("       chunk size = %5i \n",   d_chunk);
+  printf("            sigma = %5i \n",   d_sigma);
+  printf("  number nonzeros = %5i \n",   d_nnz);
+  printf("      stored size = %5i \n\n", (int) d_values.size());
+  if ((d_m > 20 || d_n > 20) && !forceprint)
+  {
+    printf("  *** matrix not printed for m or n > 20 *** \n");
+    return;
+  }
+  for (int c = 0; c < d_number_chunks; ++c)
+  {
+    int width = (d_chunk_starts[c + 1] - d_chunk_starts[c]) / d_chunk;
+    for (int r = 0; r < d_chunk; ++r)
+    {
+      int i = d_row_of_slot[c * d_chunk + r];
+      if (i < 0) continue;
+      printf(" row  %3i | ", i);
+      for (int k = 0; k < width; ++k)
+      {
+        int q = d_chunk_starts[c] + k * d_chunk + r;
+        printf(" %3i (%13.6e)", d_columns[q], d_values[q]);
+      }
+      printf("\n");
+    }
+  }
+  printf("\n");
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of MatrixSELL.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,147 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixSELL.hh
+ *  @brief MatrixSELL class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_MATRIXSELL_HH_
+#define callow_MATRIXSELL_HH_
+
+#include "Matrix.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class MatrixSELL
+ *  @brief Sliced ELLPACK (SELL-C-sigma) matrix
+ *
+ *  The rows are grouped into chunks of C rows.  Each chunk is stored as a
+ *  dense C x w block in column-major order, where w is the longest row
+ *  in the chunk and shorter rows are padded with zeros.  Hence, the
+ *  product works on C rows at a time with unit-stride loads, which the
+ *  compiler can vectorize.  To limit the padding, rows are first sorted
+ *  by decreasing length within windows of sigma rows; the permutation is
+ *  kept so that x and y stay in the original ordering.
+ *
+ *  Example (C = 2, sigma = 4):
+ *
+ *   | 7  0  0  2 |
+ *   | 0  2  0  4 |
+ *   | 1  0  0  0 |
+ *   | 3  8  0  6 |
+ *
+ *  sorted rows     = [3 0 1 2]
+ *  chunk starts    = [0 6 10]
+ *  value           = [3 7 8 2 6 0 | 2 1 4 0]
+ *  column indices  = [0 0 1 3 3 0 | 1 0 3 0]
+ *
+ *  A SELL matrix is converted from an assembled @ref Matrix, whose
+ *  values it copies.  Solvers that need direct access to L, D, and U
+ *  (e.g. @ref GaussSeidel) still require the CSR matrix.
+ */
+class CALLOW_EXPORT MatrixSELL: public MatrixBase
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<MatrixSELL>  SP_matrix;
+
+  //--------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //--------------------------------------------------------------------------//
+
+  /// Default and largest chunk sizes and default sorting window
+  enum {DEFAULT_CHUNK = 8, MAXIMUM_CHUNK = 64, DEFAULT_SIGMA = 256};
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param A      assembled CSR matrix
+   *  @param chunk  number of rows per chunk
+   *  @param sigma  number of rows within which rows are sorted by length;
+   *                must be a multiple of the chunk size
+   */
+  MatrixSELL(Matrix &A,
+             const int chunk = DEFAULT_CHUNK,
+             const int sigma = DEFAULT_SIGMA);
+  virtual ~MatrixSELL(){}
+  static SP_matrix Create(Matrix &A,
+                          const int chunk = DEFAULT_CHUNK,
+                          const int sigma = DEFAULT_SIGMA);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// number of rows per chunk
+  int chunk_size() const { return d_chunk; }
+  /// number of chunks
+  int number_chunks() const { return d_number_chunks; }
+  /// number of nonzeros in the original matrix
+  int number_nonzeros() const { return d_nnz; }
+  /// number of stored entries, including padding
+  int number_stored() const { return d_values.size(); }
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL MATRICES MUST IMPLEMENT
+  //--------------------------------------------------------------------------//
+
+  // postprocess storage (done on construction)
+  void assemble();
+  // action y <-- A * x
+  void multiply(const Vector &x,  Vector &y);
+  // action y <-- A' * x
+  void multiply_transpose(const Vector &x, Vector &y);
+  // pretty print to screen
+  void display(bool forceprint = false) const;
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// rows per chunk
+  int d_chunk;
+  /// sorting window
+  int d_sigma;
+  /// number of chunks
+  int d_number_chunks;
+  /// number of nonzeros in the original matrix
+  int d_nnz;
+  /// offset of each chunk's values, plus the total
+  std::vector<int> d_chunk_starts;
+  /// original row of each chunk slot (-1 for padding slots)
+  std::vector<int> d_row_of_slot;
+  /// column indices, column-major within each chunk
+  std::vector<int> d_columns;
+  /// matrix elements, column-major within each chunk
+  std::vector<double> d_values;
+
+};
+
+CALLOW_TEMPLATE_EXPORT(detran_utilities::SP<MatrixSELL>)
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//----------------------------------------------------------------------------//
+
+#include "MatrixSELL.i.hh"
+
+#endif /* callow_MATRIXSELL_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of MatrixSELL.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MatrixSELL.i.hh
+ *  @brief MatrixSELL inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_MATRIXSELL_I_HH_
+#define callow_MATRIXSELL_I_HH_
+
+#include "utilities/DBC.hh"
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+inline void MatrixSELL::multiply(const Vector &x, Vector &y)
+{
+  Require(d_is_ready);
+  Require(x.size() == d_n);
+  Require(y.size() == d_m);
+  const double *X = &x[0];
+  double       *Y = &y[0];
+  const int     C = d_chunk;
+  #pragma omp parallel for schedule(static) if (d_m > Matrix::OMP_MINIMUM_ROWS)
+  for (int c = 0; c < d_number_chunks; ++c)
+  {
+    double temp[MAXIMUM_CHUNK];
+    for (int r = 0; r < C; ++r)
+      temp[r] = 0.0;
+    const int     start = d_chunk_starts[c];
+    const int     width = (d_chunk_starts[c + 1] - start) / C;
+    const double *v     = &d_values[0] + start;
+    const int    *col   = &d_columns[0] + start;
+    // each column of the chunk updates all of its rows at once
+    for (int k = 0; k < width; ++k, v += C, col += C)
+      for (int r = 0; r < C; ++r)
+        temp[r] += v[r] * X[col[r]];
+    const int *row = &d_row_of_slot[c * C];
+    for (int r = 0; r < C; ++r)
+      if (row[r] >= 0) Y[row[r]] = temp[r];
+  }
+}
+
+//----------------------------------------------------------------------------//
+inline void MatrixSELL::multiply_transpose(const Vector &x, Vector &y)
+{
+  Require(d_is_ready);
+  Require(x.size() == d_m);
+  Require(y.size() == d_n);
+  const double *X = &x[0];
+  const int     C = d_chunk;
+  // each thread scatters its chunks into its own copy of y
+  std::vector<double> work;
+  int number_threads = 1;
+  #pragma omp parallel if (d_m > Matrix::OMP_MINIMUM_ROWS)
+  {
+    double *w = transpose_work(work, number_threads);
+    double temp[MAXIMUM_CHUNK];
+    #pragma omp for schedule(static)
+    for (int c = 0; c < d_number_chunks; ++c)
+    {
+      // padding slots have zero values, so any x will do
+      const int *row = &d_row_of_slot[c * C];
+      for (int r = 0; r < C; ++r)
+        temp[r] = row[r] >= 0 ? X[row[r]] : 0.0;
+      const int     start = d_chunk_starts[c];
+      const int     width = (d_chunk_starts[c + 1] - start) / C;
+      const double *v     = &d_values[0] + start;
+      const int    *col   = &d_columns[0] + start;
+      for (int k = 0; k < width; ++k, v += C, col += C)
+        for (int r = 0; r < C; ++r)
+          w[col[r]] += v[r] * temp[r];
+    }
+  }
+  reduce_transpose_work(work, number_threads, y);
+}
+
+} // end namespace callow
+
+#endif /* callow_MATRIXSELL_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of MatrixSELL.i.hh
+//----------------------------------------------------------------------------//
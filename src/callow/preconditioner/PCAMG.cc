@@ -0,0 +1,477 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCAMG.cc
+ *  @brief PCAMG member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PCAMG.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+// LOCAL KERNELS
+//----------------------------------------------------------------------------//
+
+/// Build an assembled matrix from rows of sorted columns and values
+static Matrix::SP_matrix
+build_matrix(const int                                m,
+             const int                                n,
+             const std::vector<std::vector<int> >    &columns,
+             const std::vector<std::vector<double> > &values)
+{
+  std::vector<int> nnz(m, 0);
+  for (int i = 0; i < m; ++i)
+    nnz[i] = columns[i].size();
+  Matrix::SP_matrix A(new Matrix(m, n));
+  A->preallocate(&nnz[0]);
+  for (int i = 0; i < m; ++i)
+  {
+    if (!nnz[i]) continue;
+    A->insert(i, const_cast<int*>(&columns[i][0]),
+              const_cast<double*>(&values[i][0]), nnz[i]);
+  }
+  A->assemble();
+  return A;
+}
+
+/// Compute y = A * x, threaded over rows
+static void multiply(Matrix &A, const Vector &x, Vector &y)
+{
+  const int    *rows    = A.rows();
+  const int    *columns = A.columns();
+  const double *values  = A.values();
+  const double *X = &x[0];
+  double       *Y = &y[0];
+  int m = A.number_rows();
+  #pragma omp parallel for schedule(static) if (m > Matrix::OMP_MINIMUM_ROWS)
+  for (int i = 0; i < m; ++i)
+  {
+    double v = 0.0;
+    for (int p = rows[i]; p < rows[i + 1]; ++p)
+      v += values[p] * X[columns[p]];
+    Y[i] = v;
+  }
+}
+
+/// Compute r = b - A * x, threaded over rows
+static void residual(Matrix &A, const Vector &x, const Vector &b, Vector &r)
+{
+  const int    *rows    = A.rows();
+  const int    *columns = A.columns();
+  const double *values  = A.values();
+  const double *X = &x[0];
+  const double *B = &b[0];
+  double       *R = &r[0];
+  int m = A.number_rows();
+  #pragma omp parallel for schedule(static) if (m > Matrix::OMP_MINIMUM_ROWS)
+  for (int i = 0; i < m; ++i)
+  {
+    double v = B[i];
+    for (int p = rows[i]; p < rows[i + 1]; ++p)
+      v -= values[p] * X[columns[p]];
+    R[i] = v;
+  }
+}
+
+/// Compute the sparse product C = A * B, skipping stored zeros
+static Matrix::SP_matrix product(Matrix &A, Matrix &B)
+{
+  Require(A.number_columns() == B.number_rows());
+  int m = A.number_rows();
+  int n = B.number_columns();
+  std::vector<std::vector<int> >    columns(m);
+  std::vector<std::vector<double> > values(m);
+  std::vector<int>    marker(n, -1);
+  std::vector<double> w(n, 0.0);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int p = A.start(i); p < A.end(i); ++p)
+    {
+      double a = A.values()[p];
+      if (a == 0.0) continue;
+      int k = A.column(p);
+      for (int q = B.start(k); q < B.end(k); ++q)
+      {
+        double b = B.values()[q];
+        if (b == 0.0) continue;
+        int j = B.column(q);
+        if (marker[j] != i)
+        {
+          marker[j] = i;
+          columns[i].push_back(j);
+          w[j] = 0.0;
+        }
+        w[j] += a * b;
+      }
+    }
+    std::sort(columns[i].begin(), columns[i].end());
+    values[i].resize(columns[i].size());
+    for (int p = 0; p < columns[i].size(); ++p)
+      values[i][p] = w[columns[i][p]];
+  }
+  return build_matrix(m, n, columns, values);
+}
+
+/// Compute the transpose of A, skipping stored zeros
+static Matrix::SP_matrix transpose(Matrix &A)
+{
+  int m = A.number_rows();
+  int n = A.number_columns();
+  std::vector<std::vector<int> >    columns(n);
+  std::vector<std::vector<double> > values(n);
+  // rows are visited in order, so the transposed rows stay sorted
+  for (int i = 0; i < m; ++i)
+  {
+    for (int p = A.start(i); p < A.end(i); ++p)
+    {
+      if (A.values()[p] == 0.0) continue;
+      columns[A.column(p)].push_back(i);
+      values[A.column(p)].push_back(A.values()[p]);
+    }
+  }
+  return build_matrix(n, m, columns, values);
+}
+
+//----------------------------------------------------------------------------//
+// PCAMG
+//----------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------//
+PCAMG::PCAMG(SP_matrix    A,
+             const double strength,
+             const int    max_levels,
+             const int    coarse_size,
+             const int    sweeps)
+  : Base("PCAMG")
+  , d_strength(strength)
+  , d_sweeps(sweeps)
+{
+  Require(A);
+  Require(A->number_rows() == A->number_columns());
+  Require(d_strength >= 0.0);
+  Require(max_levels >= 1);
+  Require(coarse_size >= 1);
+  Require(d_sweeps >= 1);
+  Insist(dynamic_cast<Matrix*>(A.bp()),
+    "Need an explicit matrix for use with PCAMG");
+  SP_matrixfull B(A);
+
+  d_size = B->number_rows();
+  d_A.push_back(B);
+  setup_level();
+
+  // coarsen until small enough or aggregation stalls
+  std::vector<int> agg;
+  while (d_A.size() < max_levels)
+  {
+    int l = d_A.size() - 1;
+    int n = d_A[l]->number_rows();
+    if (n <= coarse_size) break;
+    int number_aggregates = aggregate(*d_A[l], agg);
+    if (number_aggregates == 0 || number_aggregates == n) break;
+    d_P.push_back(prolongation(l, agg, number_aggregates));
+    d_R.push_back(transpose(*d_P[l]));
+    SP_matrixfull AP = product(*d_A[l], *d_P[l]);
+    d_A.push_back(product(*d_R[l], *AP));
+    setup_level();
+  }
+  factor_coarse();
+}
+
+//----------------------------------------------------------------------------//
+PCAMG::SP_preconditioner PCAMG::Create(SP_matrix    A,
+                                       const double strength,
+                                       const int    max_levels,
+                                       const int    coarse_size,
+                                       const int    sweeps)
+{
+  SP_preconditioner p(
+    new PCAMG(A, strength, max_levels, coarse_size, sweeps));
+  return p;
+}
+
+//----------------------------------------------------------------------------//
+double PCAMG::operator_complexity() const
+{
+  double nnz = 0.0;
+  for (int l = 0; l < d_A.size(); ++l)
+    nnz += d_A[l]->number_nonzeros();
+  return nnz / d_A[0]->number_nonzeros();
+}
+
+//----------------------------------------------------------------------------//
+void PCAMG::setup_level()
+{
+  int l = d_A.size() - 1;
+  Matrix &A = *d_A[l];
+  int n = A.number_rows();
+
+  SP_vector D(new Vector(n, 0.0));
+  for (int i = 0; i < n; ++i)
+  {
+    int d = A.diagonal(i);
+    double aii = d < 0 ? 0.0 : A.values()[d];
+    (*D)[i] = (aii == 0.0) ? 1.0 : 1.0 / aii;
+  }
+  d_inverse_diagonal.push_back(D);
+
+  // estimate the spectral radius of inv(D)*A with a few power iterations
+  Vector v(n, 0.0), w(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    v[i] = 1.0 + std::sin(1.0 + i);
+  v.scale(1.0 / v.norm(L2));
+  double rho = 0.0;
+  for (int k = 0; k < 15; ++k)
+  {
+    multiply(A, v, w);
+    w.multiply(*D);
+    double norm_w = w.norm(L2);
+    if (norm_w == 0.0) break;
+    rho = std::max(rho, norm_w);
+    v.copy(w);
+    v.scale(1.0 / norm_w);
+  }
+  d_omega.push_back(rho > 0.0 ? 4.0 / (3.0 * rho) : 1.0);
+
+  d_x.push_back(SP_vector(new Vector(n, 0.0)));
+  d_b.push_back(SP_vector(new Vector(n, 0.0)));
+  d_r.push_back(SP_vector(new Vector(n, 0.0)));
+}
+
+//----------------------------------------------------------------------------//
+int PCAMG::aggregate(const Matrix &A_in, std::vector<int> &agg)
+{
+  Matrix &A = const_cast<Matrix&>(A_in);
+  int n = A.number_rows();
+  const double *values = A.values();
+
+  // strong neighbors of each unknown
+  std::vector<int> strong_start(n + 1, 0), strong;
+  strong.reserve(A.number_nonzeros());
+  for (int i = 0; i < n; ++i)
+  {
+    double aii = A.diagonal(i) < 0 ? 0.0 : std::abs(values[A.diagonal(i)]);
+    for (int p = A.start(i); p < A.end(i); ++p)
+    {
+      int j = A.column(p);
+      if (j == i || values[p] == 0.0) continue;
+      double ajj = A.diagonal(j) < 0 ? 0.0 : std::abs(values[A.diagonal(j)]);
+      if (std::abs(values[p]) >= d_strength * std::sqrt(aii * ajj))
+        strong.push_back(j);
+    }
+    strong_start[i + 1] = strong.size();
+  }
+
+  agg.assign(n, -1);
+  int number_aggregates = 0;
+
+  // pass 1: unknowns whose strong neighbors are all free seed aggregates
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    bool free = true;
+    for (int p = strong_start[i]; p < strong_start[i + 1]; ++p)
+      if (agg[strong[p]] != -1) free = false;
+    if (!free || strong_start[i] == strong_start[i + 1]) continue;
+    agg[i] = number_aggregates;
+    for (int p = strong_start[i]; p < strong_start[i + 1]; ++p)
+      agg[strong[p]] = number_aggregates;
+    ++number_aggregates;
+  }
+
+  // pass 2: join a neighboring aggregate from pass 1
+  std::vector<int> seed(agg);
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    for (int p = strong_start[i]; p < strong_start[i + 1]; ++p)
+    {
+      if (seed[strong[p]] != -1)
+      {
+        agg[i] = seed[strong[p]];
+        break;
+      }
+    }
+  }
+
+  // pass 3: the rest form aggregates with their free strong neighbors
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    agg[i] = number_aggregates;
+    for (int p = strong_start[i]; p < strong_start[i + 1]; ++p)
+      if (agg[strong[p]] == -1) agg[strong[p]] = number_aggregates;
+    ++number_aggregates;
+  }
+
+  return number_aggregates;
+}
+
+//----------------------------------------------------------------------------//
+PCAMG::SP_matrixfull PCAMG::prolongation(const int               l,
+                                         const std::vector<int> &agg,
+                                         const int               number_aggregates)
+{
+  // row i of (I - omega * inv(D) * A) * P0, where P0(j, agg[j]) = 1
+  Matrix &A = *d_A[l];
+  Vector &D = *d_inverse_diagonal[l];
+  int n = A.number_rows();
+  std::vector<std::vector<int> >    columns(n);
+  std::vector<std::vector<double> > values(n);
+  std::vector<int>    marker(number_aggregates, -1);
+  std::vector<double> w(number_aggregates, 0.0);
+  for (int i = 0; i < n; ++i)
+  {
+    marker[agg[i]] = i;
+    columns[i].push_back(agg[i]);
+    w[agg[i]] = 1.0;
+    double scale = d_omega[l] * D[i];
+    for (int p = A.start(i); p < A.end(i); ++p)
+    {
+      int J = agg[A.column(p)];
+      if (marker[J] != i)
+      {
+        marker[J] = i;
+        columns[i].push_back(J);
+        w[J] = 0.0;
+      }
+      w[J] -= scale * A.values()[p];
+    }
+    std::sort(columns[i].begin(), columns[i].end());
+    values[i].resize(columns[i].size());
+    for (int p = 0; p < columns[i].size(); ++p)
+      values[i][p] = w[columns[i][p]];
+  }
+  return build_matrix(n, number_aggregates, columns, values);
+}
+
+//----------------------------------------------------------------------------//
+void PCAMG::factor_coarse()
+{
+  Matrix &A = *d_A.back();
+  int n = A.number_rows();
+  if (n > MAX_DENSE_COARSE_SIZE)
+  {
+    d_coarse_lu.clear();
+    d_coarse_pivot.clear();
+    return;
+  }
+  d_coarse_lu.assign(n * n, 0.0);
+  d_coarse_pivot.resize(n);
+  double *LU = &d_coarse_lu[0];
+  for (int i = 0; i < n; ++i)
+    for (int p = A.start(i); p < A.end(i); ++p)
+      LU[i * n + A.column(p)] = A.values()[p];
+
+  // Doolittle LU with partial pivoting
+  for (int k = 0; k < n; ++k)
+  {
+    int pivot = k;
+    for (int i = k + 1; i < n; ++i)
+      if (std::abs(LU[i * n + k]) > std::abs(LU[pivot * n + k])) pivot = i;
+    d_coarse_pivot[k] = pivot;
+    if (pivot != k)
+      std::swap_ranges(LU + k * n, LU + (k + 1) * n, LU + pivot * n);
+    if (LU[k * n + k] == 0.0)
+    {
+      THROW("ZERO PIVOT IN AMG COARSE SOLVE");
+    }
+    for (int i = k + 1; i < n; ++i)
+    {
+      double m = LU[i * n + k] / LU[k * n + k];
+      LU[i * n + k] = m;
+      if (m == 0.0) continue;
+      for (int j = k + 1; j < n; ++j)
+        LU[i * n + j] -= m * LU[k * n + j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+void PCAMG::solve_coarse(Vector &x)
+{
+  int n = x.size();
+  const double *LU = &d_coarse_lu[0];
+  for (int k = 0; k < n; ++k)
+    if (d_coarse_pivot[k] != k) std::swap(x[k], x[d_coarse_pivot[k]]);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < i; ++j)
+      x[i] -= LU[i * n + j] * x[j];
+  for (int i = n - 1; i >= 0; --i)
+  {
+    for (int j = i + 1; j < n; ++j)
+      x[i] -= LU[i * n + j] * x[j];
+    x[i] /= LU[i * n + i];
+  }
+}
+
+//----------------------------------------------------------------------------//
+void PCAMG::cycle(const int l)
+{
+  Vector &x = *d_x[l];
+  Vector &b = *d_b[l];
+  Vector &r = *d_r[l];
+
+  if (l == d_A.size() - 1)
+  {
+    if (dense_coarse())
+    {
+      x.copy(b);
+      solve_coarse(x);
+    }
+    else
+    {
+      smooth(l, true, COARSE_SWEEPS);
+    }
+    return;
+  }
+
+  // pre-smooth, restrict the residual, and correct from the coarse level
+  smooth(l, true, d_sweeps);
+  residual(*d_A[l], x, b, r);
+  multiply(*d_R[l], r, *d_b[l + 1]);
+  cycle(l + 1);
+  multiply(*d_P[l], *d_x[l + 1], r);
+  x.add(r);
+  smooth(l, false, d_sweeps);
+}
+
+//----------------------------------------------------------------------------//
+void PCAMG::smooth(const int l, bool zero_guess, const int sweeps)
+{
+  Vector &x = *d_x[l];
+  Vector &b = *d_b[l];
+  Vector &r = *d_r[l];
+  const double *D = &(*d_inverse_diagonal[l])[0];
+  const double  omega = d_omega[l];
+  int n = x.size();
+  for (int s = 0; s < sweeps; ++s)
+  {
+    // x <-- x + omega * inv(D) * (b - A * x)
+    const double *R = &b[0];
+    if (!zero_guess || s > 0)
+    {
+      residual(*d_A[l], x, b, r);
+      R = &r[0];
+    }
+    else
+    {
+      x.set(0.0);
+    }
+    double *X = &x[0];
+    #pragma omp parallel for schedule(static) if (n > Matrix::OMP_MINIMUM_ROWS)
+    for (int i = 0; i < n; ++i)
+      X[i] += omega * D[i] * R[i];
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PCAMG.cc
+//----------------------------------------------------------------------------//
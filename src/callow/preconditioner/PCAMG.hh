@@ -0,0 +1,188 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCAMG.hh
+ *  @brief PCAMG class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCAMG_HH_
+#define callow_PCAMG_HH_
+
+#include "Preconditioner.hh"
+#include "callow/matrix/Matrix.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class PCAMG
+ *  @brief Smoothed aggregation algebraic multigrid preconditioner
+ *
+ *  The hierarchy follows Vanek, Mandel, and Brezina.  On each level,
+ *    - unknown j is a strong neighbor of i if
+ *      @f$ |a_{ij}| \ge \theta \sqrt{|a_{ii} a_{jj}|} @f$,
+ *    - unknowns are grouped into aggregates of strong neighbors,
+ *    - the tentative prolongation P0 injects a constant over each
+ *      aggregate, and
+ *    - the prolongation is the damped Jacobi smoothed
+ *      @f$ \mathbf{P} = (\mathbf{I} - \omega \mathbf{D}^{-1}\mathbf{A})
+ *          \mathbf{P}_0 @f$, with @f$ \omega = 4/(3\rho) @f$ and
+ *      @f$ \rho @f$ an estimate of the spectral radius of
+ *      @f$ \mathbf{D}^{-1}\mathbf{A} @f$.
+ *  The coarse operator is @f$ \mathbf{P}^T \mathbf{A} \mathbf{P} @f$.
+ *  Coarsening stops when the operator is small enough or aggregation
+ *  no longer reduces its size.  The coarsest level is solved by dense LU
+ *  if it has at most MAX_DENSE_COARSE_SIZE rows.  Otherwise, as happens
+ *  when aggregation stalls on a large level (e.g. a diagonally dominant
+ *  operator with no strong couplings), it gets COARSE_SWEEPS sweeps of
+ *  the smoother instead, which keeps the setup and the memory linear in
+ *  the size of that level.
+ *
+ *  The preconditioner applies one V cycle with a zero initial guess.
+ *  The smoother is damped Jacobi with the same @f$ \omega @f$, which is
+ *  threaded over rows, as are the restriction and prolongation.  The
+ *  near null space is taken to be the constant vector, which suits
+ *  diffusion operators.
+ */
+
+class CALLOW_EXPORT PCAMG: public Preconditioner
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef Preconditioner                    Base;
+  typedef Base::SP_preconditioner           SP_preconditioner;
+  typedef MatrixBase::SP_matrix             SP_matrix;
+  typedef Matrix::SP_matrix                 SP_matrixfull;
+  typedef Vector::SP_vector                 SP_vector;
+
+  //--------------------------------------------------------------------------//
+  // CONSTANTS
+  //--------------------------------------------------------------------------//
+
+  /// Largest coarsest level solved by dense LU
+  static const int MAX_DENSE_COARSE_SIZE = 1000;
+  /// Smoother sweeps on a coarsest level too large for dense LU
+  static const int COARSE_SWEEPS = 10;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Construct an AMG preconditioner for the explicit matrix A
+   *  @param A              explicit matrix
+   *  @param strength       strength of connection threshold
+   *  @param max_levels     maximum number of levels, including A
+   *  @param coarse_size    size at or below which coarsening stops
+   *  @param sweeps         number of pre- and post-smoothing sweeps
+   */
+  PCAMG(SP_matrix    A,
+        const double strength    = 0.08,
+        const int    max_levels  = 20,
+        const int    coarse_size = 100,
+        const int    sweeps      = 1);
+
+  /// SP constructor
+  static SP_preconditioner Create(SP_matrix    A,
+                                  const double strength    = 0.08,
+                                  const int    max_levels  = 20,
+                                  const int    coarse_size = 100,
+                                  const int    sweeps      = 1);
+
+  /// Virtual destructor
+  virtual ~PCAMG(){};
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Number of levels in the hierarchy
+  int number_levels() const { return d_A.size(); }
+
+  /// Operator on a level, with level 0 the original matrix
+  SP_matrixfull level_operator(const int l) const
+  {
+    Require(l < number_levels());
+    return d_A[l];
+  }
+
+  /// Total nonzeros of all levels relative to those of A
+  double operator_complexity() const;
+
+  /// Is the coarsest level solved by dense LU?
+  bool dense_coarse() const { return !d_coarse_lu.empty(); }
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL PRECONDITIONERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /// Solve Px = b
+  void apply(Vector &b, Vector &x);
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Strength of connection threshold
+  double d_strength;
+  /// Number of smoothing sweeps
+  int d_sweeps;
+  /// Operator on each level
+  std::vector<SP_matrixfull> d_A;
+  /// Prolongation from level l + 1 to level l
+  std::vector<SP_matrixfull> d_P;
+  /// Restriction from level l to level l + 1
+  std::vector<SP_matrixfull> d_R;
+  /// Inverse diagonal of each level operator
+  std::vector<SP_vector> d_inverse_diagonal;
+  /// Jacobi damping on each level
+  std::vector<double> d_omega;
+  /// Solution, right hand side, and residual work vectors on each level
+  std::vector<SP_vector> d_x;
+  std::vector<SP_vector> d_b;
+  std::vector<SP_vector> d_r;
+  /// Dense LU factors of the coarsest operator, stored by rows
+  std::vector<double> d_coarse_lu;
+  /// Row pivots of the coarsest factorization
+  std::vector<int> d_coarse_pivot;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Set the diagonal, damping, and work vectors of the newest level
+  void setup_level();
+  /// Group the unknowns of a level into aggregates; returns the number
+  int aggregate(const Matrix &A, std::vector<int> &agg);
+  /// Build the smoothed prolongation of level l
+  SP_matrixfull prolongation(const int l, const std::vector<int> &agg,
+                             const int number_aggregates);
+  /// Factor the coarsest operator if it is small enough
+  void factor_coarse();
+  /// Solve with the coarsest factors in place
+  void solve_coarse(Vector &x);
+  /// Apply one V cycle starting at level l to d_b[l], leaving d_x[l]
+  void cycle(const int l);
+  /// Apply sweeps of damped Jacobi to level l
+  void smooth(const int l, bool zero_guess, const int sweeps);
+
+};
+
+} // end namespace callow
+
+#include "PCAMG.i.hh"
+
+#endif // callow_PCAMG_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCAMG.hh
+//----------------------------------------------------------------------------//
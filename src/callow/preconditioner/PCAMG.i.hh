@@ -0,0 +1,31 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCAMG.i.hh
+ *  @brief PCAMG inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCAMG_I_HH_
+#define callow_PCAMG_I_HH_
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+inline void PCAMG::apply(Vector &b, Vector &x)
+{
+  Require(b.size() == d_size);
+  Require(x.size() == d_size);
+  d_b[0]->copy(b);
+  cycle(0);
+  x.copy(*d_x[0]);
+}
+
+} // end namespace callow
+
+#endif // callow_PCAMG_I_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCAMG.i.hh
+//----------------------------------------------------------------------------//
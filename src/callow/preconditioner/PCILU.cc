@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILU.cc
+ *  @brief PCILU member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PCILU.hh"
+#include <algorithm>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+PCILU::PCILU(const std::string &name)
+  : Base(name)
+{
+  /* ... */
+}
+
+//----------------------------------------------------------------------------//
+void PCILU::set_factors(const std::vector<std::vector<int> >    &columns,
+                        const std::vector<std::vector<double> > &values)
+{
+  Require(columns.size() == values.size());
+  int n = columns.size();
+  std::vector<int> nnz(n, 0);
+  for (int i = 0; i < n; ++i)
+    nnz[i] = columns[i].size();
+  d_P = new Matrix(n, n);
+  d_P->preallocate(&nnz[0]);
+  for (int i = 0; i < n; ++i)
+  {
+    if (!nnz[i]) continue;
+    bool flag = d_P->insert(i,
+                            const_cast<int*>(&columns[i][0]),
+                            const_cast<double*>(&values[i][0]),
+                            nnz[i]);
+    Assert(flag);
+  }
+  d_P->assemble();
+}
+
+//----------------------------------------------------------------------------//
+/// Group rows into levels given the level of each row
+static void sort_levels(const std::vector<int> &level,
+                        std::vector<int>       &start,
+                        std::vector<int>       &rows)
+{
+  int n = level.size();
+  int number_levels = n ? *std::max_element(level.begin(), level.end()) + 1 : 0;
+  start.assign(number_levels + 1, 0);
+  for (int i = 0; i < n; ++i)
+    ++start[level[i] + 1];
+  for (int l = 0; l < number_levels; ++l)
+    start[l + 1] += start[l];
+  std::vector<int> next(start.begin(), start.end() - 1);
+  rows.resize(n);
+  for (int i = 0; i < n; ++i)
+    rows[next[level[i]]++] = i;
+}
+
+//----------------------------------------------------------------------------//
+void PCILU::build_levels()
+{
+  Require(d_P);
+  int n = d_P->number_rows();
+  const int *rows    = d_P->rows();
+  const int *diag    = d_P->diagonals();
+  const int *columns = d_P->columns();
+  std::vector<int> level(n, 0);
+
+  // forward solve: row i waits on the rows of L(i, :)
+  for (int i = 0; i < n; ++i)
+  {
+    int l = 0;
+    for (int p = rows[i]; p < diag[i]; ++p)
+      l = std::max(l, level[columns[p]] + 1);
+    level[i] = l;
+  }
+  sort_levels(level, d_lower_start, d_lower_rows);
+
+  // backward solve: row i waits on the rows of U(i, :)
+  for (int i = n - 1; i >= 0; --i)
+  {
+    int l = 0;
+    for (int p = diag[i] + 1; p < rows[i + 1]; ++p)
+      l = std::max(l, level[columns[p]] + 1);
+    level[i] = l;
+  }
+  sort_levels(level, d_upper_start, d_upper_rows);
+
+  d_size = n;
+  d_y.resize(n, 0.0);
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PCILU.cc
+//----------------------------------------------------------------------------//
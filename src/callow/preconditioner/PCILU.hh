@@ -0,0 +1,124 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILU.hh
+ *  @brief PCILU class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCILU_HH_
+#define callow_PCILU_HH_
+
+#include "Preconditioner.hh"
+#include "callow/matrix/Matrix.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class PCILU
+ *  @brief Base class for incomplete LU preconditioners
+ *
+ *  Each incomplete factorization yields a unit lower triangular L and an
+ *  upper triangular U, which are stored together in one CSR matrix (the
+ *  unit diagonal of L is implicit).  Derived classes compute the factors;
+ *  this class applies them.
+ *
+ *  The triangular solves are level scheduled.  Row i of the forward
+ *  solve can proceed once every row j < i with L(i, j) nonzero is done,
+ *  so rows are grouped into levels
+ *  @f[
+ *      \mathrm{level}(i) = 1 + \max_{L(i,j) \ne 0} \mathrm{level}(j) \, ,
+ *  @f]
+ *  and the rows within a level are independent.  The backward solve is
+ *  scheduled the same way using U.  The levels are processed in order,
+ *  with the rows of each level shared among threads.  Each row does the
+ *  same arithmetic as in the natural-order solve, so the result does not
+ *  depend on the number of threads.
+ */
+class CALLOW_EXPORT PCILU: public Preconditioner
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef Preconditioner                    Base;
+  typedef Base::SP_preconditioner           SP_preconditioner;
+  typedef MatrixBase::SP_matrix             SP_matrix;
+  typedef Matrix::SP_matrix                 SP_matrixfull;
+  typedef Vector::SP_vector                 SP_vector;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  PCILU(const std::string &name);
+
+  /// Virtual destructor
+  virtual ~PCILU(){};
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// The factors, with L strictly below and U on and above the diagonal
+  SP_matrixfull factors() const { return d_P; }
+
+  /// Number of levels in the forward solve
+  int number_lower_levels() const { return d_lower_start.size() - 1; }
+
+  /// Number of levels in the backward solve
+  int number_upper_levels() const { return d_upper_start.size() - 1; }
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL PRECONDITIONERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /// Solve Px = b
+  void apply(Vector &b, Vector &x);
+
+protected:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// ILU decomposition of A
+  SP_matrixfull d_P;
+  /// Working vector
+  Vector d_y;
+  /// Start of each forward solve level in d_lower_rows
+  std::vector<int> d_lower_start;
+  /// Rows ordered by forward solve level
+  std::vector<int> d_lower_rows;
+  /// Start of each backward solve level in d_upper_rows
+  std::vector<int> d_upper_start;
+  /// Rows ordered by backward solve level
+  std::vector<int> d_upper_rows;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Store factors given by rows of sorted columns and values
+  void set_factors(const std::vector<std::vector<int> >    &columns,
+                   const std::vector<std::vector<double> > &values);
+
+  /// Schedule the triangular solves and size the working vector
+  void build_levels();
+
+};
+
+} // end namespace callow
+
+#include "PCILU.i.hh"
+
+#endif // callow_PCILU_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCILU.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILU.i.hh
+ *  @brief PCILU inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCILU_I_HH_
+#define callow_PCILU_I_HH_
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+inline void PCILU::apply(Vector &b, Vector &x)
+{
+  Require(d_P);
+  Require(b.size() == d_size);
+  Require(x.size() == d_size);
+
+  // solve LUx = b --> x = inv(U)*inv(L)*b
+
+  const int    *rows    = d_P->rows();
+  const int    *diag    = d_P->diagonals();
+  const int    *columns = d_P->columns();
+  const double *values  = d_P->values();
+  const double *B = &b[0];
+  double       *Y = &d_y[0];
+  double       *X = &x[0];
+  const int number_lower_levels = d_lower_start.size() - 1;
+  const int number_upper_levels = d_upper_start.size() - 1;
+
+  #pragma omp parallel if (d_size > Matrix::OMP_MINIMUM_ROWS)
+  {
+    // forward substitution
+    //   y[i] = b[i] - sum(k=0:i-1, L[i,k]*y[k])
+    // noting that L is *unit* lower triangular
+    for (int l = 0; l < number_lower_levels; ++l)
+    {
+      #pragma omp for schedule(static)
+      for (int q = d_lower_start[l]; q < d_lower_start[l + 1]; ++q)
+      {
+        int i = d_lower_rows[q];
+        double v = B[i];
+        for (int p = rows[i]; p < diag[i]; ++p)
+          v -= values[p] * Y[columns[p]];
+        Y[i] = v;
+      }
+    }
+
+    // backward substitution
+    //   x[i] = 1/U[i,i] * ( y[i] - sum(k=i+1:m-1, U[i,k]*x[k]) )
+    for (int l = 0; l < number_upper_levels; ++l)
+    {
+      #pragma omp for schedule(static)
+      for (int q = d_upper_start[l]; q < d_upper_start[l + 1]; ++q)
+      {
+        int i = d_upper_rows[q];
+        double v = Y[i];
+        for (int p = diag[i] + 1; p < rows[i + 1]; ++p)
+          v -= values[p] * X[columns[p]];
+        X[i] = v / values[diag[i]];
+      }
+    }
+  }
+}
+
+} // end namespace callow
+
+#endif // callow_PCILU_I_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCILU.i.hh
+//----------------------------------------------------------------------------//
@@ -55,7 +55,7 @@ PCILU0::PCILU0(SP_matrix A)
 
     // pre-store the column pointers for this row.  if
     // the column isn't present, the value remains -1
-    for (int p = d_P->start(i); p < d_P->diagonal(i); ++p)
+    for (int p = d_P->start(i); p < d_P->end(i); ++p)
       iw[d_P->column(p)] = p;
 
     // loop through the columns
@@ -82,14 +82,14 @@ PCILU0::PCILU0(SP_matrix A)
     }
 
     // reset
-    for (int p = d_P->start(i); p < d_P->diagonal(i); ++p)
+    for (int p = d_P->start(i); p < d_P->end(i); ++p)
       iw[d_P->column(p)] = -1;
   }
 
   delete [] iw;
 
-  // size the working vector
-  d_y.resize(d_P->number_rows(), 0.0);
+  // schedule the solves and size the working vector
+  build_levels();
 
 }
 
@@ -9,8 +9,7 @@
 #ifndef callow_PCILU0_HH_
 #define callow_PCILU0_HH_
 
-#include "Preconditioner.hh"
-#include "callow/matrix/Matrix.hh"
+#include "PCILU.hh"
 
 namespace callow
 {
@@ -34,9 +33,12 @@ namespace callow
  *      end
  *    end
  *  @endcode
+ *
+ *  The factors keep the sparsity of A, and the solves are applied by
+ *  PCILU.
  */
 
-class CALLOW_EXPORT PCILU0: public Preconditioner
+class CALLOW_EXPORT PCILU0: public PCILU
 {
 
 public:
@@ -45,7 +47,7 @@ public:
   // TYPEDEFS
   //--------------------------------------------------------------------------//
 
-  typedef Preconditioner                    Base;
+  typedef PCILU                             Base;
   typedef Base::SP_preconditioner           SP_preconditioner;
   typedef MatrixBase::SP_matrix             SP_matrix;
   typedef Matrix::SP_matrix                 SP_matrixfull;
@@ -64,26 +66,10 @@ public:
   /// Virtual destructor
   virtual ~PCILU0(){};
 
-  //--------------------------------------------------------------------------//
-  // ABSTRACT INTERFACE -- ALL PRECONDITIONERS MUST IMPLEMENT THIS
-  //--------------------------------------------------------------------------//
-
-  /// Solve Px = b
-  void apply(Vector &b, Vector &x);
-
-protected:
-
-  /// ILU decomposition of A
-  SP_matrixfull d_P;
-  /// Working vector
-  Vector d_y;
-
 };
 
 } // end namespace callow
 
-#include "PCILU0.i.hh"
-
 #endif // callow_PCILU0_HH_
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILUK.cc
+ *  @brief PCILUK member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PCILUK.hh"
+#include <algorithm>
+#include <set>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+PCILUK::PCILUK(SP_matrix A, const int levels)
+  : Base("PCILUK")
+  , d_levels(levels)
+{
+  Require(A);
+  Require(A->number_rows() == A->number_columns());
+  Require(d_levels >= 0);
+  Insist(dynamic_cast<Matrix*>(A.bp()),
+    "Need an explicit matrix for use with PCILUK");
+  SP_matrixfull B(A);
+
+  int n = B->number_rows();
+
+  // rows of the factors, with the level of each entry
+  std::vector<std::vector<int> >    columns(n);
+  std::vector<std::vector<double> > values(n);
+  std::vector<std::vector<int> >    fill(n);
+  std::vector<int>                  diag(n, -1);
+
+  // dense working row and level, plus the ordered pattern of the row
+  std::vector<double> w(n, 0.0);
+  std::vector<int>    lev(n, d_levels + 1);
+  std::set<int>       pattern;
+
+  for (int i = 0; i < n; ++i)
+  {
+    // load row i of A, whose entries have level zero
+    for (int p = B->start(i); p < B->end(i); ++p)
+    {
+      int j = B->column(p);
+      w[j]   = B->values()[p];
+      lev[j] = 0;
+      pattern.insert(j);
+    }
+
+    // eliminate the lower entries in order; fill is inserted to the right
+    // of k, so the iteration visits it in turn
+    std::set<int>::iterator it = pattern.begin();
+    for (; it != pattern.end() && *it < i; ++it)
+    {
+      int k = *it;
+      double val = w[k] / values[k][diag[k]];
+      w[k] = val;
+      for (int q = diag[k] + 1; q < (int)columns[k].size(); ++q)
+      {
+        int j = columns[k][q];
+        int l = lev[k] + fill[k][q] + 1;
+        // existing entries are always updated, but new fill only if its
+        // level is low enough
+        if (lev[j] > d_levels)
+        {
+          if (l > d_levels) continue;
+          pattern.insert(j);
+        }
+        w[j] -= val * values[k][q];
+        lev[j] = std::min(lev[j], l);
+      }
+    }
+
+    // store the row, keeping the level of each entry
+    for (it = pattern.begin(); it != pattern.end(); ++it)
+    {
+      int j = *it;
+      if (j == i) diag[i] = columns[i].size();
+      columns[i].push_back(j);
+      values[i].push_back(w[j]);
+      fill[i].push_back(lev[j]);
+      w[j]   = 0.0;
+      lev[j] = d_levels + 1;
+    }
+    pattern.clear();
+    if (diag[i] == -1 || values[i][diag[i]] == 0.0)
+    {
+      THROW("ZERO PIVOT IN ILUK");
+    }
+  }
+
+  set_factors(columns, values);
+  build_levels();
+}
+
+//----------------------------------------------------------------------------//
+PCILUK::SP_preconditioner PCILUK::Create(SP_matrix A, const int levels)
+{
+  SP_preconditioner p(new PCILUK(A, levels));
+  return p;
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PCILUK.cc
+//----------------------------------------------------------------------------//
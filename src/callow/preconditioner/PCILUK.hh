@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILUK.hh
+ *  @brief PCILUK class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCILUK_HH_
+#define callow_PCILUK_HH_
+
+#include "PCILU.hh"
+
+namespace callow
+{
+
+/**
+ *  @class PCILUK
+ *  @brief Implements the level of fill ILU(k) preconditioner
+ *
+ *  Following Saad (Algorithm 10.5), each entry of the factors is given
+ *  a level of fill.  Nonzeros of A have level zero, and the fill created
+ *  by eliminating (i, m) in the update of (i, j) has level
+ *  @f[
+ *      \mathrm{lev}(i, j) = \min(\mathrm{lev}(i, j),
+ *                   \mathrm{lev}(i, m) + \mathrm{lev}(m, j) + 1) \, .
+ *  @f]
+ *  Entries with a level above k are dropped.  ILU(0) is recovered with
+ *  k = 0, while larger k approach the full LU factorization at the cost
+ *  of more fill.
+ */
+
+class CALLOW_EXPORT PCILUK: public PCILU
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef PCILU                             Base;
+  typedef Base::SP_preconditioner           SP_preconditioner;
+  typedef MatrixBase::SP_matrix             SP_matrix;
+  typedef Matrix::SP_matrix                 SP_matrixfull;
+  typedef Vector::SP_vector                 SP_vector;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Construct an ILU(k) preconditioner for the explicit matrix A
+   *  @param A        explicit matrix
+   *  @param levels   maximum level of fill retained
+   */
+  PCILUK(SP_matrix A, const int levels = 1);
+
+  /// SP constructor
+  static SP_preconditioner Create(SP_matrix A, const int levels = 1);
+
+  /// Virtual destructor
+  virtual ~PCILUK(){};
+
+  /// Maximum level of fill
+  int levels() const { return d_levels; }
+
+private:
+
+  /// Maximum level of fill
+  int d_levels;
+
+};
+
+} // end namespace callow
+
+#endif // callow_PCILUK_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCILUK.hh
+//----------------------------------------------------------------------------//
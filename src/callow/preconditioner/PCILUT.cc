@@ -0,0 +1,165 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILUT.cc
+ *  @brief PCILUT member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PCILUT.hh"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <set>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+/// Order entries by decreasing magnitude
+static bool larger_magnitude(const std::pair<double, int> &a,
+                             const std::pair<double, int> &b)
+{
+  return std::abs(a.first) > std::abs(b.first);
+}
+
+/// Order entries by column
+static bool smaller_column(const std::pair<double, int> &a,
+                           const std::pair<double, int> &b)
+{
+  return a.second < b.second;
+}
+
+//----------------------------------------------------------------------------//
+PCILUT::PCILUT(SP_matrix A, const double tolerance, const int fill)
+  : Base("PCILUT")
+  , d_tolerance(tolerance)
+  , d_fill(fill)
+{
+  Require(A);
+  Require(A->number_rows() == A->number_columns());
+  Require(d_tolerance >= 0.0);
+  Require(d_fill >= 0);
+  Insist(dynamic_cast<Matrix*>(A.bp()),
+    "Need an explicit matrix for use with PCILUT");
+  SP_matrixfull B(A);
+
+  int n = B->number_rows();
+
+  // rows of the factors
+  std::vector<std::vector<int> >    columns(n);
+  std::vector<std::vector<double> > values(n);
+  std::vector<int>                  diag(n, -1);
+
+  // dense working row plus its ordered pattern
+  std::vector<double> w(n, 0.0);
+  std::set<int>       pattern;
+  std::vector<std::pair<double, int> > lower, upper;
+
+  for (int i = 0; i < n; ++i)
+  {
+    // load row i of A and set the drop tolerance
+    double norm = 0.0;
+    for (int p = B->start(i); p < B->end(i); ++p)
+    {
+      int j = B->column(p);
+      w[j] = B->values()[p];
+      norm += w[j] * w[j];
+      pattern.insert(j);
+    }
+    double tau = d_tolerance * std::sqrt(norm);
+
+    // eliminate the lower entries in order, dropping small multipliers
+    std::set<int>::iterator it = pattern.begin();
+    for (; it != pattern.end() && *it < i; ++it)
+    {
+      int k = *it;
+      double val = w[k] / values[k][diag[k]];
+      if (std::abs(val) < tau)
+      {
+        w[k] = 0.0;
+        continue;
+      }
+      w[k] = val;
+      for (int q = diag[k] + 1; q < (int)columns[k].size(); ++q)
+      {
+        int j = columns[k][q];
+        pattern.insert(j);
+        w[j] -= val * values[k][q];
+      }
+    }
+
+    // split the row and apply the dual threshold to each part
+    double pivot = w[i];
+    for (it = pattern.begin(); it != pattern.end(); ++it)
+    {
+      int j = *it;
+      if (j < i)
+        lower.push_back(std::make_pair(w[j], j));
+      else if (j > i)
+        upper.push_back(std::make_pair(w[j], j));
+      w[j] = 0.0;
+    }
+    pattern.clear();
+    if (pivot == 0.0)
+    {
+      THROW("ZERO PIVOT IN ILUT");
+    }
+    keep_largest(lower, tau);
+    keep_largest(upper, tau);
+
+    // store the row
+    columns[i].reserve(lower.size() + upper.size() + 1);
+    values[i].reserve(lower.size() + upper.size() + 1);
+    for (int p = 0; p < lower.size(); ++p)
+    {
+      columns[i].push_back(lower[p].second);
+      values[i].push_back(lower[p].first);
+    }
+    diag[i] = columns[i].size();
+    columns[i].push_back(i);
+    values[i].push_back(pivot);
+    for (int p = 0; p < upper.size(); ++p)
+    {
+      columns[i].push_back(upper[p].second);
+      values[i].push_back(upper[p].first);
+    }
+    lower.clear();
+    upper.clear();
+  }
+
+  set_factors(columns, values);
+  build_levels();
+}
+
+//----------------------------------------------------------------------------//
+PCILUT::SP_preconditioner
+PCILUT::Create(SP_matrix A, const double tolerance, const int fill)
+{
+  SP_preconditioner p(new PCILUT(A, tolerance, fill));
+  return p;
+}
+
+//----------------------------------------------------------------------------//
+void PCILUT::keep_largest(std::vector<std::pair<double, int> > &entries,
+                          const double                           tau)
+{
+  int m = 0;
+  for (int p = 0; p < entries.size(); ++p)
+    if (std::abs(entries[p].first) >= tau && entries[p].first != 0.0)
+      entries[m++] = entries[p];
+  entries.resize(m);
+  if (m > d_fill)
+  {
+    std::nth_element(entries.begin(), entries.begin() + d_fill,
+                     entries.end(), larger_magnitude);
+    entries.resize(d_fill);
+  }
+  std::sort(entries.begin(), entries.end(), smaller_column);
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PCILUT.cc
+//----------------------------------------------------------------------------//
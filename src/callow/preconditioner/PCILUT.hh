@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PCILUT.hh
+ *  @brief PCILUT class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PCILUT_HH_
+#define callow_PCILUT_HH_
+
+#include "PCILU.hh"
+
+namespace callow
+{
+
+/**
+ *  @class PCILUT
+ *  @brief Implements the dual threshold ILUT(tau, p) preconditioner
+ *
+ *  Following Saad (Algorithm 10.6), row i is eliminated with the rows of
+ *  U above it, and entries are dropped by magnitude rather than by
+ *  position.  With tau_i = tau * ||a_i||_2,
+ *    - multipliers smaller than tau_i are dropped before they are used,
+ *    - entries of the finished row smaller than tau_i are dropped, and
+ *    - at most p of the largest entries are kept in each of L and U,
+ *      with the diagonal always kept.
+ *  The fill therefore adapts to the operator, which helps where ILU(0)
+ *  discards large fill entries.
+ */
+
+class CALLOW_EXPORT PCILUT: public PCILU
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef PCILU                             Base;
+  typedef Base::SP_preconditioner           SP_preconditioner;
+  typedef MatrixBase::SP_matrix             SP_matrix;
+  typedef Matrix::SP_matrix                 SP_matrixfull;
+  typedef Vector::SP_vector                 SP_vector;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Construct an ILUT preconditioner for the explicit matrix A
+   *  @param A          explicit matrix
+   *  @param tolerance  drop tolerance relative to the row norm
+   *  @param fill       maximum number of entries in each row of L and U
+   */
+  PCILUT(SP_matrix A, const double tolerance = 1e-3, const int fill = 10);
+
+  /// SP constructor
+  static SP_preconditioner Create(SP_matrix    A,
+                                  const double tolerance = 1e-3,
+                                  const int    fill = 10);
+
+  /// Virtual destructor
+  virtual ~PCILUT(){};
+
+  /// Drop tolerance
+  double tolerance() const { return d_tolerance; }
+
+  /// Maximum fill per row of L and U
+  int fill() const { return d_fill; }
+
+private:
+
+  /// Drop tolerance
+  double d_tolerance;
+  /// Maximum fill per row of L and U
+  int d_fill;
+
+  /// Keep the d_fill largest entries at or above tau, sorted by column
+  void keep_largest(std::vector<std::pair<double, int> > &entries,
+                    const double                           tau);
+
+};
+
+} // end namespace callow
+
+#endif // callow_PCILUT_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PCILUT.hh
+//----------------------------------------------------------------------------//
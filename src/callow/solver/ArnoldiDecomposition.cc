@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  ArnoldiDecomposition.cc
+ *  @brief ArnoldiDecomposition member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "ArnoldiDecomposition.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+ArnoldiDecomposition::ArnoldiDecomposition(SP_matrix A,
+                                           const int m,
+                                           SP_solver B_solver)
+  : d_A(A)
+  , d_m(m)
+  , d_B_solver(B_solver)
+  , d_breakdown(false)
+  , d_number_applications(0)
+{
+  Require(d_A);
+  Require(d_m > 0);
+  Require(d_m <= d_A->number_rows());
+  int n = d_A->number_rows();
+  d_V = new KrylovBasis(d_m + 1, n);
+  d_H.assign(d_m + 1, std::vector<double>(d_m, 0.0));
+  d_t = new Vector(n, 0.0);
+  d_a.assign(d_m + 1, 0.0);
+}
+
+//----------------------------------------------------------------------------//
+void ArnoldiDecomposition::initialize(const Vector &x)
+{
+  Require(x.size() == d_V->size());
+  d_V->zero();
+  for (int i = 0; i < d_H.size(); ++i)
+    std::fill(d_H[i].begin(), d_H[i].end(), 0.0);
+  SP_vector v = d_V->view(0);
+  v->copy(x);
+  double norm_v = v->norm(L2);
+  Insist(norm_v > 0.0, "The initial Arnoldi vector must be nonzero.");
+  v->scale(1.0 / norm_v);
+  d_breakdown = false;
+}
+
+//----------------------------------------------------------------------------//
+int ArnoldiDecomposition::extend(const int k, const int m)
+{
+  Require(k >= 0 && k <= m && m <= d_m);
+  d_breakdown = false;
+  for (int j = k; j < m; ++j)
+  {
+    SP_vector v = d_V->view(j);
+    SP_vector w = d_V->view(j + 1);
+    apply(*v, *w);
+    double norm_w = w->norm(L2);
+
+    // remove the projections onto the basis, twice
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      d_V->dot(j + 1, *w, &d_a[0]);
+      for (int i = 0; i <= j; ++i)
+      {
+        d_H[i][j] += d_a[i];
+        d_a[i] = -d_a[i];
+      }
+      d_V->add(j + 1, &d_a[0], *w);
+    }
+
+    double h = w->norm(L2);
+    if (h <= 1.0e-12 * norm_w)
+    {
+      // the span is invariant
+      w->set(0.0);
+      d_H[j + 1][j] = 0.0;
+      d_breakdown = true;
+      return j + 1;
+    }
+    w->scale(1.0 / h);
+    d_H[j + 1][j] = h;
+  }
+  return m;
+}
+
+//----------------------------------------------------------------------------//
+void ArnoldiDecomposition::restart(const int m, const vec2_dbl &Q)
+{
+  int k = Q.size();
+  Require(k > 0 && k < m && m <= d_m);
+
+  // new basis vectors V*Q, followed by the last vector
+  std::vector<Vector> W(k + 1, Vector(d_V->size(), 0.0));
+  for (int c = 0; c < k; ++c)
+  {
+    Require(Q[c].size() == m);
+    d_V->add(m, &Q[c][0], W[c]);
+  }
+  d_V->get(m, W[k]);
+  d_V->zero();
+  for (int c = 0; c <= k; ++c)
+    d_V->set(c, W[c]);
+
+  // new projection Q'*H*Q and last row b'*Q
+  vec2_dbl HQ(m + 1, std::vector<double>(k, 0.0));
+  for (int i = 0; i <= m; ++i)
+    for (int c = 0; c < k; ++c)
+      for (int j = 0; j < m; ++j)
+        HQ[i][c] += d_H[i][j] * Q[c][j];
+  for (int i = 0; i < d_H.size(); ++i)
+    std::fill(d_H[i].begin(), d_H[i].end(), 0.0);
+  for (int r = 0; r < k; ++r)
+    for (int c = 0; c < k; ++c)
+      for (int i = 0; i < m; ++i)
+        d_H[r][c] += Q[r][i] * HQ[i][c];
+  for (int c = 0; c < k; ++c)
+    d_H[k][c] = HQ[m][c];
+}
+
+//----------------------------------------------------------------------------//
+void ArnoldiDecomposition::apply(const Vector &x, Vector &y)
+{
+  if (d_B_solver)
+  {
+    d_A->multiply(x, *d_t);
+    y.copy(*d_t);
+    d_B_solver->solve(*d_t, y);
+  }
+  else
+  {
+    d_A->multiply(x, y);
+  }
+  ++d_number_applications;
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file ArnoldiDecomposition.cc
+//----------------------------------------------------------------------------//
@@ -10,6 +10,11 @@
 #ifndef callow_ARNOLDIDECOMPOSITION_HH_
 #define callow_ARNOLDIDECOMPOSITION_HH_
 
+#include "KrylovBasis.hh"
+#include "LinearSolver.hh"
+#include "callow/matrix/MatrixBase.hh"
+#include <vector>
+
 namespace callow
 {
 
@@ -18,13 +23,137 @@ namespace callow
  *  @brief Compute an n-step Arnoldi decomposition of an operator A
  *
  *  For various algorithms, computing an Arnoldi decomposition is a useful
- *  step.
+ *  step.  For an operator @f$ \mathbf{A} @f$, an m-step decomposition is
+ *  @f[
+ *      \mathbf{A} \mathbf{V}_m = \mathbf{V}_m \mathbf{H}_m
+ *                              + v_{m} b^T \, ,
+ *  @f]
+ *  where @f$ \mathbf{V}_m @f$ has orthonormal columns that are also
+ *  orthogonal to @f$ v_m @f$, and @f$ \mathbf{H}_m = \mathbf{V}_m^T
+ *  \mathbf{A} \mathbf{V}_m @f$.  Straight from Arnoldi's process,
+ *  @f$ \mathbf{H}_m @f$ is upper Hessenberg and @f$ b = h_{m,m-1} e_m @f$.
+ *  More generally (i.e. after a restart), the relation is a Krylov
+ *  decomposition with a full @f$ \mathbf{H}_m @f$ and @f$ b @f$.  The
+ *  m + 1 rows of H are stored with @f$ b^T @f$ as the last.
+ *
+ *  A restart with an m x k matrix Q whose orthonormal columns span an
+ *  invariant subspace of @f$ \mathbf{H}_m @f$ (e.g. its wanted Schur or
+ *  Ritz vectors) keeps the k-step Krylov decomposition
+ *  @f[
+ *      \mathbf{A} (\mathbf{V}_m \mathbf{Q}) = (\mathbf{V}_m \mathbf{Q})
+ *        (\mathbf{Q}^T \mathbf{H}_m \mathbf{Q}) + v_m (b^T \mathbf{Q}) \, ,
+ *  @f]
+ *  which may be extended again by Arnoldi steps.  This is the
+ *  thick restart of Krylov-Schur methods.
  *
+ *  For a generalized problem, the operator is
+ *  @f$ \mathbf{B}^{-1}\mathbf{A} @f$, with @f$ \mathbf{B} @f$ inverted
+ *  by a given linear solver.  The basis is orthogonalized by classical
+ *  Gram-Schmidt applied twice.
  */
-class ArnoldiDecomposition
+class CALLOW_EXPORT ArnoldiDecomposition
 {
 
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef MatrixBase::SP_matrix             SP_matrix;
+  typedef LinearSolver::SP_solver           SP_solver;
+  typedef Vector::SP_vector                 SP_vector;
+  typedef std::vector<std::vector<double> > vec2_dbl;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param A          operator
+   *  @param m          maximum number of steps
+   *  @param B_solver   optional solver for B, giving the operator inv(B)*A
+   */
+  ArnoldiDecomposition(SP_matrix A, const int m,
+                       SP_solver B_solver = SP_solver(0));
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Start a decomposition of no steps from the (normalized) vector x
+  void initialize(const Vector &x);
+
+  /**
+   *  @brief Extend a k-step decomposition to (at most) m steps
+   *
+   *  The decomposition breaks down, i.e. its span is invariant, when a
+   *  new vector lies in the span of the basis.  The new vector is then
+   *  zero and the steps reached are returned.
+   *
+   *  @param k  current number of steps
+   *  @param m  wanted number of steps
+   *  @return   number of steps reached
+   */
+  int extend(const int k, const int m);
+
+  /// Did the last extension break down?
+  bool breakdown() const { return d_breakdown; }
+
+  /**
+   *  @brief Restart an m-step decomposition with the columns of Q
+   *  @param m  current number of steps
+   *  @param Q  orthonormal columns of length m, i.e. Q[column][row]
+   */
+  void restart(const int m, const vec2_dbl &Q);
+
+  /// Element (i, j) of the m + 1 by m matrix H
+  double H(const int i, const int j) const
+  {
+    Require(i < d_H.size() && j < d_H[i].size());
+    return d_H[i][j];
+  }
+
+  /// The basis (with the new vector last)
+  const KrylovBasis& basis() const { return *d_V; }
+
+  /// Maximum number of steps
+  int number_steps() const { return d_m; }
+
+  /// Number of applications of the operator
+  int number_applications() const { return d_number_applications; }
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Operator
+  SP_matrix d_A;
+  /// Maximum number of steps
+  int d_m;
+  /// Solver for B in generalized problems
+  SP_solver d_B_solver;
+  /// Basis of m + 1 vectors
+  detran_utilities::SP<KrylovBasis> d_V;
+  /// Projected operator [m+1][m]
+  vec2_dbl d_H;
+  /// Work vectors
+  SP_vector d_t;
+  std::vector<double> d_a;
+  /// Breakdown flag
+  bool d_breakdown;
+  /// Number of applications of the operator
+  int d_number_applications;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
 
+  /// y <-- inv(B)*A*x
+  void apply(const Vector &x, Vector &y);
 
 };
 
@@ -0,0 +1,141 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  BiCGSTAB.cc
+ *  @brief BiCGSTAB member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "BiCGSTAB.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+BiCGSTAB::BiCGSTAB(const double  atol,
+                   const double  rtol,
+                   const int     maxit)
+  : LinearSolver(atol, rtol, maxit, "solver_bicgstab")
+{
+  d_monitor_diverge = false;
+}
+
+//----------------------------------------------------------------------------//
+void BiCGSTAB::solve_impl(const Vector &b, Vector &x)
+{
+  int n = x.size();
+
+  // residual, shadow residual, search direction, and work vectors
+  Vector r(n, 0.0);
+  Vector r_hat(n, 0.0);
+  Vector p(n, 0.0);
+  Vector p_hat(n, 0.0);
+  Vector v(n, 0.0);
+  Vector s_hat(n, 0.0);
+  Vector t(n, 0.0);
+  Vector w(n, 0.0);
+
+  // r <-- inv(P_L)*(b - A*x)
+  d_A->multiply(x, w);
+  w.subtract(b);
+  w.scale(-1.0);
+  if (d_P && d_pc_side == Base::LEFT)
+    d_P->apply(w, r);
+  else
+    r.copy(w);
+  if (monitor_init(r.norm(L2))) return;
+
+  r_hat.copy(r);
+  double rho   = 1.0;
+  double alpha = 1.0;
+  double omega = 1.0;
+  v.set(0.0);
+  p.set(0.0);
+
+  for (int iteration = 1; iteration < d_maximum_iterations; ++iteration)
+  {
+    // restart the shadow residual on (near) breakdown
+    double rho_new = r_hat.dot(r);
+    if (std::abs(rho_new) < 1.0e-30 * r.dot(r))
+    {
+      r_hat.copy(r);
+      rho_new = r_hat.dot(r);
+      p.set(0.0);
+      v.set(0.0);
+      rho = alpha = omega = 1.0;
+    }
+
+    // p <-- r + beta*(p - omega*v)
+    double beta = (rho_new / rho) * (alpha / omega);
+    rho = rho_new;
+    p.add_a_times_x(-omega, v);
+    p.scale(beta);
+    p.add(r);
+
+    // v <-- A*inv(P)*p
+    apply_right(p, p_hat);
+    apply_operator(p_hat, v, w);
+    alpha = rho / r_hat.dot(v);
+
+    // s <-- r - alpha*v, stored in r; stop if it is small enough
+    x.add_a_times_x(alpha, p_hat);
+    double norm_s = r.add_a_times_x_norm(-alpha, v);
+    if (norm_s < std::max(d_relative_tolerance * d_residual[0],
+                          d_absolute_tolerance))
+    {
+      monitor(iteration, norm_s);
+      break;
+    }
+
+    // t <-- A*inv(P)*s and the minimizing omega
+    apply_right(r, s_hat);
+    apply_operator(s_hat, t, w);
+    double tt = t.dot(t);
+    omega = tt > 0.0 ? t.dot(r) / tt : 0.0;
+
+    // update the solution and the residual r <-- s - omega*t
+    x.add_a_times_x(omega, s_hat);
+    double norm_r = r.add_a_times_x_norm(-omega, t);
+    if (monitor(iteration, norm_r)) break;
+
+    if (omega == 0.0)
+    {
+      if (d_monitor_level > 0)
+        printf("*** %s stagnated with omega = 0\n", d_name.c_str());
+      set_status(DIVERGE);
+      break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+void BiCGSTAB::apply_right(Vector &x, Vector &y)
+{
+  if (d_P && d_pc_side == Base::RIGHT)
+    d_P->apply(x, y);
+  else
+    y.copy(x);
+}
+
+//----------------------------------------------------------------------------//
+void BiCGSTAB::apply_operator(Vector &x, Vector &y, Vector &t)
+{
+  if (d_P && d_pc_side == Base::LEFT)
+  {
+    d_A->multiply(x, t);
+    d_P->apply(t, y);
+  }
+  else
+  {
+    d_A->multiply(x, y);
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file BiCGSTAB.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  BiCGSTAB.hh
+ *  @brief BiCGSTAB class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_BICGSTAB_HH_
+#define callow_BICGSTAB_HH_
+
+#include "LinearSolver.hh"
+
+namespace callow
+{
+
+/**
+ *  @class BiCGSTAB
+ *  @brief Uses preconditioned BiCGSTAB iteration to solve a system
+ *
+ *  BiCGSTAB (van der Vorst) handles nonsymmetric \f$ \mathbf{A} \f$
+ *  with short recurrences.  Each iteration is a BiCG step followed by a
+ *  one-dimensional residual minimization, for two matrix-vector
+ *  products, two preconditioner applications, four inner products,
+ *  and a fixed amount of storage (seven vectors), independent of the
+ *  iteration count.  That makes it a useful alternative to GMRES(m)
+ *  when the restart needed for GMRES to converge is large.
+ *
+ *  With a right preconditioner (or none), the monitored residual is
+ *  the recursively updated residual of the original system.  With a
+ *  left preconditioner, the iteration is applied to
+ *  \f$ \mathbf{P}\mathbf{A}x = \mathbf{P}b \f$, and the monitored
+ *  residual is the preconditioned one, as done for GMRES.  If the
+ *  shadow residual becomes orthogonal to the residual, the iteration
+ *  is restarted with the current residual.  As for CG, the residual
+ *  need not decrease monotonically, so divergence checks are off by
+ *  default.
+ */
+class BiCGSTAB: public LinearSolver
+{
+
+public:
+
+  typedef LinearSolver Base;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  BiCGSTAB(const double atol, const double rtol, const int maxit);
+
+  virtual ~BiCGSTAB(){}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // expose base class members
+  using LinearSolver::d_absolute_tolerance;
+  using LinearSolver::d_relative_tolerance;
+  using LinearSolver::d_maximum_iterations;
+  using LinearSolver::d_residual;
+  using LinearSolver::d_number_iterations;
+  using LinearSolver::d_A;
+  using LinearSolver::d_P;
+  using LinearSolver::d_pc_side;
+  using LinearSolver::d_monitor_level;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param b  right hand side
+   *  @param x  unknown vector
+   */
+  void solve_impl(const Vector &b, Vector &x);
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Apply y <-- inv(P_R)*x, or copy if there is no right preconditioner
+  void apply_right(Vector &x, Vector &y);
+
+  /// Apply y <-- inv(P_L)*A*x, with t as work space
+  void apply_operator(Vector &x, Vector &y, Vector &t);
+
+};
+
+} // end namespace callow
+
+#endif // callow_BICGSTAB_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file BiCGSTAB.hh
+//----------------------------------------------------------------------------//
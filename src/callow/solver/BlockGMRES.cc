@@ -0,0 +1,360 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  BlockGMRES.cc
+ *  @brief BlockGMRES member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "BlockGMRES.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+BlockGMRES::BlockGMRES(const double  atol,
+                       const double  rtol,
+                       const int     maxit,
+                       const int     restart)
+  : LinearSolver(atol, rtol, maxit, "solver_block_gmres")
+  , d_restart(restart)
+{
+  Insist(d_restart > 0, "Need a restart of > 0");
+}
+
+//----------------------------------------------------------------------------//
+int BlockGMRES::solve_block(const std::vector<SP_vector> &B,
+                            std::vector<SP_vector>       &X)
+{
+  Require(d_A);
+  Require(B.size() > 0);
+  Require(B.size() == X.size());
+  for (int j = 0; j < B.size(); ++j)
+  {
+    Require(B[j]->size() == d_A->number_rows());
+    Require(X[j]->size() == d_A->number_rows());
+  }
+  // Resize the norm
+  d_residual.resize(d_maximum_iterations+1, 0.0);
+  set_status(RUNNING);
+  solve_block_impl(B, X);
+  if (status() == MAXIT && d_monitor_level > 0)
+  {
+     printf("*** %s did not converge within the maximum number of iterations\n",
+            d_name.c_str());
+  }
+  // Resize the norm
+  d_residual.resize(d_number_iterations+1);
+  return status();
+}
+
+//----------------------------------------------------------------------------//
+void BlockGMRES::solve_impl(const Vector &b, Vector &x)
+{
+  // a block of one, with x updated in place
+  std::vector<SP_vector> B(1, SP_vector(new Vector(b)));
+  std::vector<SP_vector> X(1, SP_vector(new Vector(x.size(), &x[0])));
+  solve_block_impl(B, X);
+}
+
+//----------------------------------------------------------------------------//
+void BlockGMRES::solve_block_impl(const std::vector<SP_vector> &B,
+                                  std::vector<SP_vector>       &X)
+{
+  int p = B.size();
+  int n = d_A->number_rows();
+
+  // the basis can hold at most n vectors
+  int m = std::min(d_restart, n / p - 1);
+  Insist(m > 0, "Too many right hand sides for the size of the system.");
+  int mp = m * p;
+
+  // krylov basis, stored contiguously so that the projections onto all
+  // basis vectors can be computed in one pass, and views of its vectors
+  KrylovBasis basis((m + 1) * p, n);
+  std::vector<SP_vector> V((m + 1) * p);
+  for (int i = 0; i < V.size(); ++i)
+    V[i] = basis.view(i);
+
+  // work vectors
+  std::vector<SP_vector> W(p);
+  for (int s = 0; s < p; ++s)
+    W[s] = new Vector(n, 0.0);
+  Vector t(n, 0.0);
+
+  // coefficients such that x_s = x_s + V*y_s
+  std::vector<double> y(mp, 0.0);
+
+  d_H.assign((m + 1) * p, std::vector<double>(mp, 0.0));
+  d_G.assign((m + 1) * p, std::vector<double>(p, 0.0));
+  d_c.assign(mp * p, 1.0);
+  d_s.assign(mp * p, 0.0);
+  d_h.assign((m + 1) * p, 0.0);
+  d_a.assign((m + 1) * p, 0.0);
+
+  //--------------------------------------------------------------------------//
+  // outer iterations
+  //--------------------------------------------------------------------------//
+
+  int iteration = 0;  // total iterations (i.e. applications of A to blocks)
+  bool done = false;
+  while (!done && iteration < d_maximum_iterations)
+  {
+
+    // clear krylov subspace
+    basis.zero();
+    for (int i = 0; i < d_H.size(); ++i)
+    {
+      std::fill(d_H[i].begin(), d_H[i].end(), 0.0);
+      std::fill(d_G[i].begin(), d_G[i].end(), 0.0);
+    }
+
+    // compute the residuals in the first block of the basis
+    std::vector<SP_vector> R(V.begin(), V.begin() + p);
+    d_A->multiply_block(X, R);
+    for (int s = 0; s < p; ++s)
+    {
+      R[s]->subtract(*B[s]);
+      R[s]->scale(-1);
+      if (d_P && d_pc_side == Base::LEFT)
+      {
+        t.copy(*R[s]);
+        d_P->apply(t, *R[s]);
+      }
+    }
+
+    // check initial outer residual.  if it's small enough, we started
+    // with solved systems.
+    if (iteration == 0)
+    {
+      double rho = 0.0;
+      for (int s = 0; s < p; ++s)
+        rho = std::max(rho, R[s]->norm(L2));
+      if (monitor_init(rho))
+      {
+        done = true;
+        break;
+      }
+    }
+
+    // the QR factorization of the residuals gives the first block of the
+    // basis and of the residual coefficients
+    for (int s = 0; s < p; ++s)
+    {
+      double r = orthogonalize(basis, s);
+      for (int i = 0; i < s; ++i)
+        d_G[i][s] = d_h[i];
+      d_G[s][s] = r;
+    }
+
+    // inner iterations (of size restart)
+    int k = 0;
+    for (; k < m; ++k)
+    {
+      ++iteration;
+      // check iteration count
+      if (iteration >= d_maximum_iterations-1)
+      {
+        done = true;
+        break;
+      }
+
+      //----------------------------------------------------------------------//
+      // compute V(k+1) <-- inv(P_L)*A*inv(P_R) * V(k)
+      //----------------------------------------------------------------------//
+
+      std::vector<SP_vector> V_k(V.begin() + k * p, V.begin() + (k + 1) * p);
+      std::vector<SP_vector> V_k1(V.begin() + (k + 1) * p,
+                                  V.begin() + (k + 2) * p);
+      if (d_P && d_pc_side == Base::RIGHT)
+      {
+        for (int s = 0; s < p; ++s)
+          d_P->apply(*V_k[s], *W[s]);
+        d_A->multiply_block(W, V_k1);
+      }
+      else
+      {
+        d_A->multiply_block(V_k, V_k1);
+      }
+      if (d_P && d_pc_side == Base::LEFT)
+      {
+        for (int s = 0; s < p; ++s)
+        {
+          t.copy(*V_k1[s]);
+          d_P->apply(t, *V_k1[s]);
+        }
+      }
+
+      //----------------------------------------------------------------------//
+      // orthogonalize the new block and triangularize its columns of H
+      //----------------------------------------------------------------------//
+
+      for (int l = 0; l < p; ++l)
+      {
+        int c = k * p + l;
+        int j = c + p;
+        double r = orthogonalize(basis, j);
+        for (int i = 0; i < j; ++i)
+          d_H[i][c] = d_h[i];
+        d_H[j][c] = r;
+        rotate(c, p);
+      }
+
+      //----------------------------------------------------------------------//
+      // monitor the largest residual and break if done
+      //----------------------------------------------------------------------//
+
+      double rho = 0.0;
+      for (int s = 0; s < p; ++s)
+      {
+        double rho_s = 0.0;
+        for (int i = (k + 1) * p; i < (k + 2) * p; ++i)
+          rho_s += d_G[i][s] * d_G[i][s];
+        rho = std::max(rho, std::sqrt(rho_s));
+      }
+      if (monitor(iteration, rho))
+      {
+        ++k;
+        done = true;
+        break;
+      }
+
+    } // end inners
+
+    //----------------------------------------------------------------------//
+    // update the solutions
+    //----------------------------------------------------------------------//
+
+    int nk = k * p;
+    for (int s = 0; s < p; ++s)
+    {
+      // back substitution with the triangularized H; a zero pivot (i.e. a
+      // singular projected operator) leaves its unknown zero
+      for (int i = nk - 1; i >= 0; --i)
+      {
+        double v = d_G[i][s];
+        for (int c = i + 1; c < nk; ++c)
+          v -= d_H[i][c] * y[c];
+        y[i] = d_H[i][i] != 0.0 ? v / d_H[i][i] : 0.0;
+      }
+      // x_s = x_s + inv(P_R) * V*y
+      W[s]->set(0.0);
+      basis.add(nk, &y[0], *W[s]);
+      if (d_P && d_pc_side == Base::RIGHT)
+      {
+        t.copy(*W[s]);
+        d_P->apply(t, *W[s]);
+      }
+      X[s]->add(*W[s]);
+    }
+
+  } // end outers
+
+}
+
+//----------------------------------------------------------------------------//
+double BlockGMRES::orthogonalize(KrylovBasis &basis, const int j)
+{
+  SP_vector w = basis.view(j);
+  double norm_w = w->norm(L2);
+  for (int i = 0; i < j; ++i)
+    d_h[i] = 0.0;
+  project(basis, j, *w, d_h);
+
+  // a vector that lies in the span of the basis is replaced by a random
+  // one orthogonal to the basis, which enters with a zero coefficient
+  double r = w->norm(L2);
+  if (r <= 1.0e-12 * norm_w || r == 0.0)
+  {
+    unsigned int seed = 12345u + j;
+    for (int i = 0; i < w->size(); ++i)
+    {
+      seed = 1664525u * seed + 1013904223u;
+      (*w)[i] = seed / 4294967296.0 - 0.5;
+    }
+    std::vector<double> h(j + 1, 0.0);
+    project(basis, j, *w, h);
+    w->scale(1.0 / w->norm(L2));
+    return 0.0;
+  }
+  w->scale(1.0 / r);
+  return r;
+}
+
+//----------------------------------------------------------------------------//
+void BlockGMRES::project(KrylovBasis         &basis,
+                         const int            j,
+                         Vector              &w,
+                         std::vector<double> &h)
+{
+  // each pass computes all j projections with one sweep over the basis
+  // and removes them with another; the second pass recovers the
+  // orthogonality lost to cancellation in the first
+  std::vector<double> &a = d_a;
+  for (int pass = 0; pass < 2 && j > 0; ++pass)
+  {
+    basis.dot(j, w, &a[0]);
+    for (int i = 0; i < j; ++i)
+    {
+      h[i] += a[i];
+      a[i] = -a[i];
+    }
+    basis.add(j, &a[0], w);
+  }
+}
+
+//----------------------------------------------------------------------------//
+void BlockGMRES::rotate(const int c, const int p)
+{
+  // apply the rotations of the previous columns, in order.  column i
+  // eliminated rows i+p down to i+1, each into the row above it.
+  for (int i = 0; i < c; ++i)
+  {
+    for (int l = 0; l < p; ++l)
+    {
+      int q = i * p + l;
+      int r = i + p - 1 - l;
+      double h_0 = d_c[q]*d_H[r][c] - d_s[q]*d_H[r+1][c];
+      double h_1 = d_s[q]*d_H[r][c] + d_c[q]*d_H[r+1][c];
+      d_H[r  ][c] = h_0;
+      d_H[r+1][c] = h_1;
+    }
+  }
+
+  // eliminate the p subdiagonal entries of this column, applying the same
+  // rotations to the residual coefficients
+  for (int l = 0; l < p; ++l)
+  {
+    int q = c * p + l;
+    int r = c + p - 1 - l;
+    double nu = std::sqrt(d_H[r][c]*d_H[r][c] + d_H[r+1][c]*d_H[r+1][c]);
+    if (nu > 0.0)
+    {
+      d_c[q] =  d_H[r  ][c] / nu;
+      d_s[q] = -d_H[r+1][c] / nu;
+    }
+    else
+    {
+      d_c[q] = 1.0;
+      d_s[q] = 0.0;
+    }
+    d_H[r  ][c] = nu;
+    d_H[r+1][c] = 0.0;
+    for (int s = 0; s < p; ++s)
+    {
+      double g_0 = d_c[q]*d_G[r][s] - d_s[q]*d_G[r+1][s];
+      double g_1 = d_s[q]*d_G[r][s] + d_c[q]*d_G[r+1][s];
+      d_G[r  ][s] = g_0;
+      d_G[r+1][s] = g_1;
+    }
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file BlockGMRES.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  BlockGMRES.hh
+ *  @brief BlockGMRES class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_BLOCKGMRES_HH_
+#define callow_BLOCKGMRES_HH_
+
+#include "LinearSolver.hh"
+#include "KrylovBasis.hh"
+
+namespace callow
+{
+
+/**
+ *  @class BlockGMRES
+ *  @brief Uses block GMRES(m) to solve a system for several right hand sides
+ *
+ *  For p right hand sides \f$ \mathbf{B} = [b_1, \ldots, b_p] \f$, block
+ *  GMRES builds the block Krylov subspace
+ *  @f[
+ *     \mathcal{K}_n \equiv
+ *       [\mathbf{R}_0, \mathbf{A}\mathbf{R}_0, \ldots,
+ *        \mathbf{A}^{n-1} \mathbf{R}_0] \, ,
+ *  @f]
+ *  where \f$ \mathbf{R}_0 \f$ holds the p initial residuals, and
+ *  minimizes each residual over the whole subspace.  Each iteration
+ *  applies the operator to a block of p vectors through
+ *  MatrixBase::multiply_block, so operators that can share work among
+ *  the vectors (e.g. a transport sweep carrying several sources) apply
+ *  it once per iteration, and each system sees the directions generated
+ *  by the others.
+ *
+ *  The block Arnoldi process orthogonalizes each new vector against the
+ *  basis by classical Gram-Schmidt applied twice.  The block upper
+ *  Hessenberg matrix has p subdiagonals, which are eliminated by p
+ *  Givens rotations per column.  A new vector that is (numerically)
+ *  dependent on the basis, e.g. when two right hand sides coincide, is
+ *  replaced by a random vector orthogonal to the basis.  It enters the
+ *  Arnoldi relation with a zero coefficient, so the projected problem
+ *  and its residual estimates remain exact.
+ *
+ *  An iteration is one block step, i.e. one application of the operator
+ *  to p vectors.  The monitored residual is the largest of the p
+ *  residual norms, so the right hand sides should be of similar size.
+ *  Preconditioning is applied to each vector of a block.
+ *
+ *  A single right hand side may be solved with LinearSolver::solve, in
+ *  which case the method is GMRES(m).
+ */
+class BlockGMRES: public LinearSolver
+{
+
+public:
+
+  typedef LinearSolver Base;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  BlockGMRES(const double atol, const double rtol, const int maxit,
+             const int restart = 20);
+
+  virtual ~BlockGMRES(){}
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Solve the system for several right hand sides
+   *  @param B  right hand sides
+   *  @param X  unknown vectors, with the initial guesses on input
+   */
+  int solve_block(const std::vector<SP_vector> &B, std::vector<SP_vector> &X);
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // expose base class members
+  using LinearSolver::d_absolute_tolerance;
+  using LinearSolver::d_relative_tolerance;
+  using LinearSolver::d_maximum_iterations;
+  using LinearSolver::d_residual;
+  using LinearSolver::d_number_iterations;
+  using LinearSolver::d_A;
+  using LinearSolver::d_P;
+  using LinearSolver::d_pc_side;
+  using LinearSolver::d_monitor_level;
+
+  /// maximum number of block steps between restarts
+  int d_restart;
+  /// block upper hessenberg [(m+1)p][mp], treated as dense
+  std::vector<std::vector<double> > d_H;
+  /// rotated residual coefficients [(m+1)p][p]
+  std::vector<std::vector<double> > d_G;
+  /// cosine and sine of the p rotations of each column [mp*p]
+  std::vector<double> d_c;
+  std::vector<double> d_s;
+  /// projections onto the basis [(m+1)p]
+  std::vector<double> d_h;
+  /// projections of one Gram-Schmidt pass [(m+1)p]
+  std::vector<double> d_a;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param b  right hand side
+   *  @param x  unknown vector
+   */
+  void solve_impl(const Vector &b, Vector &x);
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// solve for the block of right hand sides
+  void solve_block_impl(const std::vector<SP_vector> &B,
+                        std::vector<SP_vector>       &X);
+
+  /**
+   *  Orthogonalize basis vector j against the first j basis vectors by
+   *  CGS2 and normalize it.  The projections are left in d_h, and the
+   *  norm is returned.  A dependent vector is replaced, and zero returned.
+   */
+  double orthogonalize(KrylovBasis &basis, const int j);
+
+  /// remove from w its projections onto the first j basis vectors, adding
+  /// them to h
+  void project(KrylovBasis &basis, const int j, Vector &w,
+               std::vector<double> &h);
+
+  /// triangularize column c of H, applying the new rotations to G
+  void rotate(const int c, const int p);
+
+};
+
+} // end namespace callow
+
+#endif // callow_BLOCKGMRES_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file BlockGMRES.hh
+//----------------------------------------------------------------------------//
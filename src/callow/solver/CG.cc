@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  CG.cc
+ *  @brief CG member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "CG.hh"
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+CG::CG(const double  atol,
+       const double  rtol,
+       const int     maxit)
+  : LinearSolver(atol, rtol, maxit, "solver_cg")
+{
+  d_monitor_diverge = false;
+}
+
+//----------------------------------------------------------------------------//
+void CG::solve_impl(const Vector &b, Vector &x)
+{
+  int n = x.size();
+
+  // residual, preconditioned residual, search direction, and A*p
+  Vector r(n, 0.0);
+  Vector z(n, 0.0);
+  Vector p(n, 0.0);
+  Vector q(n, 0.0);
+
+  // r <-- b - A*x
+  d_A->multiply(x, r);
+  r.subtract(b);
+  r.scale(-1.0);
+  if (monitor_init(r.norm(L2))) return;
+
+  // the preconditioner applies only once it has been set
+  const bool precondition = d_P && d_pc_side != Base::NONE;
+
+  // z <-- inv(P)*r
+  if (precondition)
+    d_P->apply(r, z);
+  else
+    z.copy(r);
+  p.copy(z);
+  double rz = r.dot(z);
+
+  for (int iteration = 1; iteration < d_maximum_iterations; ++iteration)
+  {
+    // step length
+    d_A->multiply(p, q);
+    double pq = p.dot(q);
+    if (pq <= 0.0)
+    {
+      if (d_monitor_level > 0)
+        printf("*** %s found a nonpositive curvature (p, Ap) = %12.8e\n",
+               d_name.c_str(), pq);
+      d_number_iterations = iteration - 1;
+      set_status(DIVERGE);
+      return;
+    }
+    double alpha = rz / pq;
+
+    // update the solution and residual
+    x.add_a_times_x(alpha, p);
+    double rho = r.add_a_times_x_norm(-alpha, q);
+    if (monitor(iteration, rho)) break;
+
+    // new search direction p <-- z + beta*p
+    if (precondition)
+      d_P->apply(r, z);
+    else
+      z.copy(r);
+    double rz_new = r.dot(z);
+    double beta = rz_new / rz;
+    rz = rz_new;
+    p.scale(beta);
+    p.add(z);
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file CG.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,89 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  CG.hh
+ *  @brief CG class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_CG_HH_
+#define callow_CG_HH_
+
+#include "LinearSolver.hh"
+
+namespace callow
+{
+
+/**
+ *  @class CG
+ *  @brief Uses preconditioned conjugate gradients to solve a system
+ *
+ *  For symmetric positive definite \f$ \mathbf{A} \f$, CG minimizes
+ *  the error in the \f$ \mathbf{A} \f$-norm over the Krylov subspace
+ *  @f[
+ *     \mathcal{K}_n \equiv
+ *       [r_0, \mathbf{PA}r_0, \ldots, (\mathbf{PA})^{n-1} r_0] \, ,
+ *  @f]
+ *  where \f$ \mathbf{P} \f$ is the (inverse) preconditioner.  Unlike
+ *  GMRES, only the last search direction is needed, so each iteration
+ *  costs one matrix-vector product, one preconditioner application,
+ *  two inner products, and three vector updates regardless of the
+ *  iteration count.
+ *
+ *  The preconditioner must itself be symmetric positive definite (e.g.
+ *  Jacobi or AMG with a symmetric smoother) and is applied the same way
+ *  regardless of the preconditioner side.  The monitored residual is
+ *  the L2 norm of the unpreconditioned, recursively updated residual.
+ *  Since that norm need not decrease monotonically, divergence checks
+ *  are off by default.
+ */
+class CG: public LinearSolver
+{
+
+public:
+
+  typedef LinearSolver Base;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  CG(const double atol, const double rtol, const int maxit);
+
+  virtual ~CG(){}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // expose base class members
+  using LinearSolver::d_absolute_tolerance;
+  using LinearSolver::d_relative_tolerance;
+  using LinearSolver::d_maximum_iterations;
+  using LinearSolver::d_residual;
+  using LinearSolver::d_number_iterations;
+  using LinearSolver::d_A;
+  using LinearSolver::d_P;
+  using LinearSolver::d_monitor_level;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param b  right hand side
+   *  @param x  unknown vector
+   */
+  void solve_impl(const Vector &b, Vector &x);
+
+};
+
+} // end namespace callow
+
+#endif // callow_CG_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file CG.hh
+//----------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include "callow/matrix/MatrixDense.hh"
 #include "callow/solver/Eispack.hh"
 #include "EigenSolverCreator.hh"
+#include <algorithm>
 
 namespace callow
 {
@@ -21,6 +22,7 @@ Davidson::Davidson(const double    tol,
                    const int       subspace_size)
   : Base(tol, maxit, "davidson")
   , d_subspace_size(subspace_size)
+  , d_basis_precision(KrylovBasis::DOUBLE)
 {
   // create projected system solver
   SP_db db = detran_utilities::InputDB::Create();
@@ -86,20 +88,31 @@ void Davidson::solve_impl(Vector &u, Vector &x0)
   // working residual
   Vector r(m, 0.0);
   Vector t(m, 0.0);
-
-  // initialize the orthogonal basis
-  std::vector<Vector> V(d_subspace_size,   Vector(m, 0.0));
-  std::vector<Vector> V_a(d_subspace_size, Vector(m, 0.0));
-  std::vector<Vector> V_b(d_subspace_size, Vector(m, 0.0));
-  V[0].copy(x0);
-  V[0].scale(1.0/V[0].norm());
-  d_A->multiply(V[0], V_a[0]); // aka  Dinv(L)MF
-  d_B->multiply(V[0], V_b[0]); // aka  I - Dinv(L)MS
+  Vector s(m, 0.0);
+
+  // initialize the orthogonal basis.  the first vector, which holds the
+  // last ritz vector after a restart, is kept in double precision along
+  // with its images, while the corrections (and their images) are kept
+  // at the basis precision.
+  Vector V_0(m, 0.0);
+  Vector V_a_0(m, 0.0);
+  Vector V_b_0(m, 0.0);
+  int number_corrections = std::max((int)d_subspace_size - 1, 1);
+  KrylovBasis V(number_corrections, m, d_basis_precision);
+  KrylovBasis V_a(number_corrections, m, d_basis_precision);
+  KrylovBasis V_b(number_corrections, m, d_basis_precision);
+  V_0.copy(x0);
+  V_0.scale(1.0/V_0.norm());
+  d_A->multiply(V_0, V_a_0); // aka  Dinv(L)MF
+  d_B->multiply(V_0, V_b_0); // aka  I - Dinv(L)MS
 
   // projected operators
   MatrixDense::SP_matrix A;
   MatrixDense::SP_matrix B;
 
+  // coefficients of the corrections
+  std::vector<double> c(d_subspace_size, 0.0);
+
   // perform outer iterations
   size_t it = 1;
   size_t outers = d_maximum_iterations / d_subspace_size + 1;
@@ -113,11 +126,16 @@ void Davidson::solve_impl(Vector &u, Vector &x0)
       B = new MatrixDense(i+1, i+1, 0.0);
       for (size_t row = 0; row < i+1; ++row)
       {
-        for (size_t col = 0; col < i+1; ++col)
-        {
-          (*A)(row, col) = V[row].dot(V_a[col]);
-          (*B)(row, col) = V[row].dot(V_b[col]);
-        }
+        Vector &v_row = row ? s : V_0;
+        if (row) V.get(row - 1, s);
+        (*A)(row, 0) = v_row.dot(V_a_0);
+        (*B)(row, 0) = v_row.dot(V_b_0);
+        V_a.dot(i, v_row, &c[0]);
+        for (size_t col = 1; col < i+1; ++col)
+          (*A)(row, col) = c[col - 1];
+        V_b.dot(i, v_row, &c[0]);
+        for (size_t col = 1; col < i+1; ++col)
+          (*B)(row, col) = c[col - 1];
       }
       d_projected_solver->set_operators(A, B);
 //      A->display();
@@ -130,64 +148,93 @@ void Davidson::solve_impl(Vector &u, Vector &x0)
       d_projected_solver->solve(y1, y0);
       d_lambda = d_projected_solver->eigenvalue();
       //y1.display("Y");
-      //V[0].display("V0");
       // compute ritz vector, V*y1
       u.scale(0.0);
-      for (size_t j = 0; j < i + 1; ++j)
-        u.add_a_times_x(y1[j], V[j]);
+      u.add_a_times_x(y1[0], V_0);
+      if (i) V.add(i, &y1[1], u);
 //     u.display("U");
       // update residual  u = Vy,  r = Au = AVy =
       r.scale(0.0);
-      for (size_t j = 0; j < i + 1; ++j)
+      r.add_a_times_x( y1[0],          V_a_0);
+      r.add_a_times_x(-d_lambda*y1[0], V_b_0);
+      if (i)
       {
-        r.add_a_times_x( y1[j],          V_a[j]);
-        r.add_a_times_x(-d_lambda*y1[j], V_b[j]);
+        V_a.add(i, &y1[1], r);
+        for (size_t j = 0; j < i; ++j)
+          c[j] = -d_lambda * y1[j + 1];
+        V_b.add(i, &c[0], r);
       }
 //      r.display("R");
 //      d_A_minus_ritz_times_B->multiply(u, t);
 //      t.display("R part 2");
 
+      // with rounded corrections, the residual above is only that of the
+      // rounded subspace, so confirm convergence with the ritz vector
+      // itself, restarting from it if it falls short
+      double norm_r = r.norm();
+      bool restart = false;
+      if (d_basis_precision == KrylovBasis::SINGLE && norm_r < d_tolerance)
+      {
+        d_A->multiply(u, r);
+        d_B->multiply(u, s);
+        d_lambda = u.dot(r) / u.dot(s);
+        r.add_a_times_x(-d_lambda, s);
+        norm_r = r.norm();
+        restart = norm_r >= d_tolerance;
+      }
+
       // check for convergence
-      if (monitor(it, d_lambda, r.norm()))
+      if (monitor(it, d_lambda, norm_r))
       {
         it = 0;
         break;
       }
       // restart if necessary (saving u as is)
       t.copy(u);
-      if (i == d_subspace_size - 1) break;
+      if (restart || i == d_subspace_size - 1) break;
       // update the subspace
       d_P->apply(r, u);
       //u.display(" V = P\R");
-      for (size_t j = 0; j < i+1; ++j)
-        y1[j] = V[j].dot(u); // V'*u
-      for (size_t j = 0; j < i+1; ++j)
-        u.add_a_times_x(-y1[j], V[j]);
+      double c_0 = V_0.dot(u); // V'*u
+      V.dot(i, u, &c[0]);
+      u.add_a_times_x(-c_0, V_0);
+      for (size_t j = 0; j < i; ++j)
+        c[j] = -c[j];
+      V.add(i, &c[0], u);
       u.scale(1.0/u.norm());
       //u.display(" V ");
 
-      V[i+1].copy(u);
-      d_A->multiply(V[i+1], V_a[i+1]);
-      d_B->multiply(V[i+1], V_b[i+1]);
+      // store the correction, and compute the images of what was stored
+      V.set(i, u);
+      V.get(i, u);
+      d_A->multiply(u, s);
+      V_a.set(i, s);
+      d_B->multiply(u, s);
+      V_b.set(i, s);
     } // end inners
     if (it == 0)
     {
       break;
     }
     // otherwise, restart with u
-    V[0].copy(t);
-    d_A->multiply(V[0], V_a[0]); // aka  Dinv(L)MF
-    d_B->multiply(V[0], V_b[0]); // aka  I - Dinv(L)MS
-    for (size_t i = 1; i < V.size(); ++i)
-    {
-      V[i].scale(0.0);
-      V_a[i].scale(0.0);
-      V_b[i].scale(0.0);
-    }
+    V_0.copy(t);
+    d_A->multiply(V_0, V_a_0); // aka  Dinv(L)MF
+    d_B->multiply(V_0, V_b_0); // aka  I - Dinv(L)MS
+    V.zero();
+    V_a.zero();
+    V_b.zero();
 
   } // end outers
 }
 
+//----------------------------------------------------------------------------//
+std::size_t Davidson::basis_bytes(const int n) const
+{
+  int number_corrections = std::max((int)d_subspace_size - 1, 1);
+  return 3 * (KrylovBasis::bytes(1, n, KrylovBasis::DOUBLE) +
+              KrylovBasis::bytes(number_corrections, n, d_basis_precision));
+}
+
 } // end namespace callow
 
 //----------------------------------------------------------------------------//
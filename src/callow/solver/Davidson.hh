@@ -10,6 +10,7 @@
 #define callow_DAVIDSON_HH_
 
 #include "EigenSolver.hh"
+#include "KrylovBasis.hh"
 #include "callow/preconditioner/PCShell.hh"
 #include "callow/matrix/MatrixShell.hh"
 
@@ -45,6 +46,16 @@ namespace callow
  *  here, projection methods in general can be much more efficient
  *  if restarted.  We simply take the last resulting eigenpair.
  *
+ *  The corrections and their images may be stored in single precision
+ *  (see \ref KrylovBasis), which halves the memory of all but the first
+ *  vector of the three subspaces.  The first vector, which after a
+ *  restart is the last Ritz vector, is always kept in double, so the
+ *  rounding limits only the corrections and not the attainable
+ *  accuracy.
+ *
+ *  Relevant database entries:
+ *    - eigen_solver_basis_precision [string] "double" or "single"
+ *
  *  SLEPc also offers an implementation of generalized Davidson
  *  that may be more efficient but cannot handle arbitrary user-defined
  *  preconditioners in the way needed for Detran.
@@ -96,6 +107,16 @@ public:
   void set_preconditioner(SP_pc     P,
                           const int side = LinearSolver::LEFT);
 
+  /// Set the storage precision of the corrections
+  void set_basis_precision(const int precision)
+  {
+    Require(precision >= 0 && precision < KrylovBasis::END_PRECISION_TYPES);
+    d_basis_precision = precision;
+  }
+
+  /// Bytes used by the subspace and its images for a problem of size n
+  std::size_t basis_bytes(const int n) const;
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -104,6 +125,8 @@ private:
 
   /// Subspace size
   size_t d_subspace_size;
+  /// Storage precision of the corrections
+  int d_basis_precision;
   /// Preconditioner, i.e. approximate action inv(A-theta*B) * v
   SP_pc d_P;
   /// Residual operator
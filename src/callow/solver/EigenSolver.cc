@@ -35,7 +35,7 @@ void EigenSolver::set_operators(SP_matrix    A,
                                 SP_db        db)
 {
   Insist(A, "The operator A cannot be null");
-  d_A = A;
+  d_A = d_matrix_format.convert(A);
   Ensure(d_A->number_rows() == d_A->number_columns());
 
   // Setup linear system if this is a generalized eigenproblem
@@ -13,6 +13,7 @@
 #include "callow/utils/CallowDefinitions.hh"
 #include "LinearSolver.hh"
 #include "callow/matrix/MatrixBase.hh"
+#include "callow/matrix/MatrixFormat.hh"
 #include "callow/vector/Vector.hh"
 #include "utilities/SP.hh"
 #include <cstdio>
@@ -140,6 +141,15 @@ public:
     d_monitor_level = v;
   }
 
+  /**
+   *  Set the storage used for the left operator.  An assembled CSR
+   *  operator is converted when set.
+   */
+  void set_matrix_format(const MatrixFormat &format)
+  {
+    d_matrix_format = format;
+  }
+
   /**
    *  @brief Solve the eigenvalue problem
    *
@@ -166,6 +176,12 @@ public:
     return d_residual_norm;
   }
 
+  /// Return the number of iterations performed
+  int number_iterations() const
+  {
+    return d_number_iterations;
+  }
+
   /// Get the left operator
   SP_matrix A()
   {
@@ -218,6 +234,8 @@ protected:
   double d_lambda;
   /// solver status
   int d_status;
+  /// storage format for the left operator
+  MatrixFormat d_matrix_format;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -12,6 +12,7 @@
 #include "PowerIteration.hh"
 #include "SlepcSolver.hh"
 #include "Davidson.hh"
+#include "KrylovSchur.hh"
 #include "Eispack.hh"
 //
 #include <string>
@@ -46,7 +47,7 @@ EigenSolverCreator::Create(SP_db db)
       monitor_level = db->get<int>("eigen_solver_monitor_level");
     if (db->check("eigen_number_values"))
       number_values = db->get<int>("eigen_number_values");
-    // note, this is ignored unless we use slepc
+    // note, this is ignored unless we use slepc or krylovschur
   }
 
   if (solver_type == "power")
@@ -66,7 +67,24 @@ EigenSolverCreator::Create(SP_db db)
   {
     if (db->check("eigen_solver_subspace_size"))
       subspace_size = db->get<int>("eigen_solver_subspace_size");
-    solver = new Davidson(tol, maxit, subspace_size);
+    Davidson *davidson = new Davidson(tol, maxit, subspace_size);
+    if (db->check("eigen_solver_basis_precision"))
+    {
+      std::string type = db->get<std::string>("eigen_solver_basis_precision");
+      if (type == "double")
+        davidson->set_basis_precision(KrylovBasis::DOUBLE);
+      else if (type == "single")
+        davidson->set_basis_precision(KrylovBasis::SINGLE);
+      else
+        THROW("Unsupported Davidson basis precision: " + type);
+    }
+    solver = davidson;
+  }
+  else if (solver_type == "krylovschur")
+  {
+    if (db->check("eigen_solver_subspace_size"))
+      subspace_size = db->get<int>("eigen_solver_subspace_size");
+    solver = new KrylovSchur(tol, maxit, subspace_size, number_values);
   }
   else if (solver_type == "eispack")
   {
@@ -77,6 +95,16 @@ EigenSolverCreator::Create(SP_db db)
   else
     THROW("Unsupported solver type: " + solver_type);
 
+  // Only power iteration applies the operator through the base class;
+  // the other solvers set up their operators themselves.
+  MatrixFormat format(db, "eigen_solver");
+  if (format.format() != MatrixFormat::CSR)
+  {
+    Insist(solver_type == "power",
+           "Only power iteration supports other matrix formats.");
+    solver->set_matrix_format(format);
+  }
+
   solver->set_monitor_level(monitor_level);
   return solver;
 }
@@ -7,6 +7,7 @@
 //----------------------------------------------------------------------------//
 
 #include "GMRES.hh"
+#include <algorithm>
 
 namespace callow
 {
@@ -19,6 +20,9 @@ GMRES::GMRES(const double  atol,
   : LinearSolver(atol, rtol, maxit, "solver_gmres")
   , d_restart(restart)
   , d_reorthog(1)
+  , d_orthogonalization(MGS)
+  , d_basis_precision(KrylovBasis::DOUBLE)
+  , d_h(restart+1, 0.0)
   , d_c(restart+1, 0.0)
   , d_s(restart+1, 0.0)
 {
@@ -53,8 +57,27 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
   // Unknowns.  If x0 is nonzero, we need to separate it out.
   Vector x(x0);
 
-  // krylov basis
-  std::vector<Vector>  v(d_restart + 1, Vector(x.size(), 0.0));
+  // krylov basis, stored contiguously so that the projections onto all
+  // basis vectors can be computed in one pass
+  int n = x.size();
+  KrylovBasis basis(d_restart + 1, n, d_basis_precision);
+  std::vector<Vector::SP_vector> v(d_restart + 1);
+
+  // a double precision basis is used in place, while a single precision
+  // one is expanded into v_k, and the new vector is built in w
+  bool single = d_basis_precision == KrylovBasis::SINGLE;
+  Vector::SP_vector v_k;
+  Vector::SP_vector w;
+  if (single)
+  {
+    v_k = new Vector(n, 0.0);
+    w   = new Vector(n, 0.0);
+  }
+  else
+  {
+    for (int i = 0; i <= d_restart; ++i)
+      v[i] = basis.view(i);
+  }
 
   // residual
   Vector r(x.size(), 0.0);
@@ -76,11 +99,13 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
 
   int iteration = 0;  // total iterations (i.e. applications of A)
   bool done = false;
+  // whether to confirm convergence with the true residual
+  bool verify = false;
   while (!done && iteration < d_maximum_iterations)
   {
 
     // clear krylov subspace
-    for (int i = 0; i < d_restart; ++i) v[i].set(0.0);
+    basis.zero();
     g.set(0.0);
 
     // compute residual
@@ -109,14 +134,23 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
         break;
       }
     }
-    else
+    else if (verify)
     {
-       //cout << "restarting..." << endl;
+      // the residual estimate converged, but the rounded basis only
+      // gives a correction, so the true residual decides
+      if (rho < std::max(d_relative_tolerance * d_residual[0],
+                         d_absolute_tolerance))
+      {
+        done = true;
+        break;
+      }
+      set_status(RUNNING);
+      verify = false;
     }
 
     // initial krylov vector
-    v[0].copy(r);
-    v[0].scale(1.0 / rho);
+    r.scale(1.0 / rho);
+    basis.set(0, r);
     g[0] = rho;
 
     // inner iterations (of size restart)
@@ -135,59 +169,37 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
       // compute v(k+1) <-- inv(P_L)*A*inv(P_R) * v(k)
       //----------------------------------------------------------------------//
 
+      Vector &vk  = single ? *v_k : *v[k];
+      Vector &vk1 = single ? *w   : *v[k + 1];
+      if (single) basis.get(k, vk);
+
       // apply right preconditioner and operator
       if (d_P && d_pc_side == Base::RIGHT)
       {
-        d_P->apply(v[k], v[k + 1]);
-        t.copy(v[k + 1]);
-        d_A->multiply(t, v[k + 1]);
+        d_P->apply(vk, vk1);
+        t.copy(vk1);
+        d_A->multiply(t, vk1);
       }
       else
       {
         // save on a copy
-        d_A->multiply(v[k], v[k + 1]);
+        d_A->multiply(vk, vk1);
       }
       // apply left preconditioner
       if (d_P && d_pc_side == Base::LEFT)
       {
-        t.copy(v[k + 1]);
-        d_P->apply(t, v[k + 1]);
+        t.copy(vk1);
+        d_P->apply(t, vk1);
       }
 
       //----------------------------------------------------------------------//
-      // use modified gram-schmidt to orthogonalize v(k+1)
+      // orthogonalize v(k+1) against the basis
       //----------------------------------------------------------------------//
 
-      double norm_Av = v[k+1].norm();
-      for (int j = 0; j <= k; ++j)
-      {
-        d_H[j][k] = v[k+1].dot(v[j]);
-        v[k+1].add_a_times_x(-d_H[j][k], v[j]);
-      }
-      d_H[k+1][k] = v[k+1].norm(L2);
-      double norm_Av_2 = d_H[k+1][k];
-
-      //----------------------------------------------------------------------//
-      // optional reorthogonalization
-      //----------------------------------------------------------------------//
-
-      if ( (d_reorthog == 1 && norm_Av + 0.001 * norm_Av_2 == norm_Av) ||
-           (d_reorthog == 2) )
-      {
-        // summarized from kelley:
-        //  if the new vector (i.e. v[k+1]) is very small relative to
-        //  A*v[k], then information might be lost so reorthogonalize.  the
-        //  delta of 0.001 is what kelley uses in his test code.
-
-        if (d_monitor_level > 1) cout << " reorthog ... " << endl;
-        for (int j = 0; j < k; ++j)
-        {
-          double hr = v[j].dot(v[k+1]);
-          d_H[j][k] += hr;
-          v[k+1].add_a_times_x(-hr, v[j]);
-        }
-        d_H[k+1][k] = v[k+1].norm();
-      }
+      if (d_orthogonalization == CGS2 || single)
+        orthogonalize_cgs2(basis, vk1, k);
+      else
+        orthogonalize_mgs(v, k);
 
       //----------------------------------------------------------------------//
       // watch for happy breakdown: if H[k+1][k] == 0, we've solved Ax=b
@@ -195,7 +207,7 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
       bool happy = false;
       if (d_H[k+1][k] != 0.0)
       {
-        v[k+1].scale(1.0/d_H[k+1][k]);
+        vk1.scale(1.0/d_H[k+1][k]);
       }
       else
       {
@@ -203,6 +215,7 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
         std::printf("happy breakdown for k = %5i (iteration = %5i) \n",
                     k, iteration);
       }
+      if (single) basis.set(k + 1, vk1);
 
       //----------------------------------------------------------------------//
       // apply givens rotations to triangularize H on-the-fly (it's neat!)
@@ -231,7 +244,8 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
 //               d_restart, iteration/d_restart);
 //        printf("(inner iteration %3i) to a solution with residual: %12.8e \n",
 //               k, rho);
-        done = true;
+        verify = single && status() == SUCCESS;
+        done = !verify;
         break;
 
       }
@@ -247,10 +261,7 @@ void GMRES::solve_impl(const Vector &b, Vector &x0)
     // reset the solution
     x.set(0.0);
     // update x = v[0]*y[0] + ...
-    for (int i = 0; i < k; ++i)
-    {
-      x.add_a_times_x(y[i], v[i]);
-    }
+    basis.add(k, &y[0], x);
     if (d_P && d_pc_side == Base::RIGHT)
     {
       t.copy(x);
@@ -10,6 +10,7 @@
 #define callow_GMRES_HH_
 
 #include "LinearSolver.hh"
+#include "KrylovBasis.hh"
 
 namespace callow
 {
@@ -42,6 +43,25 @@ namespace callow
  *  rotation for incremental conversion of the upper Hessenberg
  *  matrix \f$ H \f$ to an upper triangle matrix \f$ R \f$.
  *
+ *  Each new Krylov vector is orthogonalized against the basis by
+ *  either modified Gram-Schmidt (MGS, the default) with optional
+ *  reorthogonalization, or by classical Gram-Schmidt applied twice
+ *  (CGS2).  MGS makes two passes over memory per basis vector, while
+ *  CGS2 stores the basis contiguously and computes all projections
+ *  with a single pass over it, i.e. a dense matrix-vector product,
+ *  which is much cheaper for large restarts.  CGS2 is as stable as
+ *  MGS with reorthogonalization.
+ *
+ *  The basis may be stored in single precision (see \ref KrylovBasis),
+ *  which halves its memory, e.g. to allow a larger restart.  Products
+ *  with the basis still accumulate in double, and CGS2 is always used.
+ *  Since the rounded basis limits the accuracy of each cycle's
+ *  correction, convergence of the residual estimate is confirmed with
+ *  the true residual, and another cycle is started if needed.
+ *
+ *  Relevant database entries:
+ *    - linear_solver_gmres_orthogonalization [string] "mgs" or "cgs2"
+ *    - linear_solver_gmres_basis_precision   [string] "double" or "single"
  */
 class GMRES: public LinearSolver
 {
@@ -50,6 +70,12 @@ public:
 
   typedef LinearSolver Base;
 
+  /// Orthogonalization schemes
+  enum ORTHOGONALIZATION_TYPES
+  {
+    MGS, CGS2, END_ORTHOGONALIZATION_TYPES
+  };
+
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
   //--------------------------------------------------------------------------//
@@ -63,6 +89,38 @@ public:
   // PUBLIC FUNCTIONS
   //--------------------------------------------------------------------------//
 
+  /// Set the orthogonalization scheme
+  void set_orthogonalization(const int type)
+  {
+    Require(type >= 0 && type < END_ORTHOGONALIZATION_TYPES);
+    d_orthogonalization = type;
+  }
+
+  /// Orthogonalization scheme in use
+  int orthogonalization() const
+  {
+    return d_orthogonalization;
+  }
+
+  /// Set the storage precision of the basis
+  void set_basis_precision(const int precision)
+  {
+    Require(precision >= 0 && precision < KrylovBasis::END_PRECISION_TYPES);
+    d_basis_precision = precision;
+  }
+
+  /// Storage precision of the basis
+  int basis_precision() const
+  {
+    return d_basis_precision;
+  }
+
+  /// Bytes used by the basis for a system of size n
+  std::size_t basis_bytes(const int n) const
+  {
+    return KrylovBasis::bytes(d_restart + 1, n, d_basis_precision);
+  }
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -86,6 +144,15 @@ private:
   /// reorthogonalize flag [0 = none, 1 = formula, 2 = always]
   int d_reorthog;
 
+  /// orthogonalization scheme
+  int d_orthogonalization;
+
+  /// storage precision of the basis
+  int d_basis_precision;
+
+  /// projections onto the basis for CGS2 [m+1]
+  std::vector<double> d_h;
+
   /// upper hessenberg [m+1][m], treated as dense
   double** d_H;
 
@@ -109,6 +176,12 @@ private:
   void compute_y(Vector &y, const Vector &g, const int k);
 
   void initialize_H();
+
+  /// orthogonalize v[k+1] against v[0:k] by modified gram-schmidt
+  void orthogonalize_mgs(std::vector<SP_vector> &v, const int k);
+
+  /// orthogonalize w against the first k+1 basis vectors by CGS2
+  void orthogonalize_cgs2(const KrylovBasis &basis, Vector &w, const int k);
 };
 
 } // end namespace callow
@@ -57,6 +57,62 @@ inline void GMRES::compute_y(Vector &y, const Vector &g, const int k)
 
 }
 
+//----------------------------------------------------------------------------//
+inline void GMRES::orthogonalize_mgs(std::vector<SP_vector> &v, const int k)
+{
+  double norm_Av = v[k+1]->norm();
+  for (int j = 0; j < k; ++j)
+  {
+    d_H[j][k] = v[k+1]->dot(*v[j]);
+    v[k+1]->add_a_times_x(-d_H[j][k], *v[j]);
+  }
+  // the last projection and the norm share one pass
+  d_H[k][k]   = v[k+1]->dot(*v[k]);
+  d_H[k+1][k] = v[k+1]->add_a_times_x_norm(-d_H[k][k], *v[k]);
+  double norm_Av_2 = d_H[k+1][k];
+
+  // optional reorthogonalization
+  if ( (d_reorthog == 1 && norm_Av + 0.001 * norm_Av_2 == norm_Av) ||
+       (d_reorthog == 2) )
+  {
+    // summarized from kelley:
+    //  if the new vector (i.e. v[k+1]) is very small relative to
+    //  A*v[k], then information might be lost so reorthogonalize.  the
+    //  delta of 0.001 is what kelley uses in his test code.
+
+    if (d_monitor_level > 1) cout << " reorthog ... " << endl;
+    for (int j = 0; j < k; ++j)
+    {
+      double hr = v[j]->dot(*v[k+1]);
+      d_H[j][k] += hr;
+      v[k+1]->add_a_times_x(-hr, *v[j]);
+    }
+    d_H[k+1][k] = v[k+1]->norm();
+  }
+}
+
+//----------------------------------------------------------------------------//
+inline void GMRES::orthogonalize_cgs2(const KrylovBasis &basis,
+                                      Vector            &w,
+                                      const int          k)
+{
+  // each pass computes all k+1 projections with one sweep over the basis
+  // and removes them with another; the second pass recovers the
+  // orthogonality lost to cancellation in the first
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    basis.dot(k + 1, w, &d_h[0]);
+    for (int j = 0; j <= k; ++j)
+    {
+      d_H[j][k] = pass ? d_H[j][k] + d_h[j] : d_h[j];
+      d_h[j] = -d_h[j];
+    }
+    basis.add(k + 1, &d_h[0], w);
+  }
+  d_H[k+1][k] = w.norm(L2);
+}
+
+//----------------------------------------------------------------------------//
 inline void GMRES::initialize_H()
 {
   for (int i = 0; i <= d_restart; i++)
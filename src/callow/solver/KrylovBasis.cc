@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  KrylovBasis.cc
+ *  @brief KrylovBasis member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "KrylovBasis.hh"
+#include <algorithm>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+KrylovBasis::KrylovBasis(const int m, const int n, const int precision)
+  : d_m(m)
+  , d_n(n)
+  , d_precision(precision)
+{
+  Require(m > 0);
+  Require(n > 0);
+  Insist(precision >= 0 && precision < END_PRECISION_TYPES,
+         "Unsupported basis precision");
+  if (d_precision == DOUBLE)
+    d_double.resize((std::size_t)m * n, 0.0);
+  else
+    d_single.resize((std::size_t)m * n, 0.0f);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t KrylovBasis::bytes() const
+{
+  return bytes(d_m, d_n, d_precision);
+}
+
+//----------------------------------------------------------------------------//
+std::size_t KrylovBasis::bytes(const int m, const int n, const int precision)
+{
+  std::size_t s = precision == DOUBLE ? sizeof(double) : sizeof(float);
+  return (std::size_t)m * n * s;
+}
+
+//----------------------------------------------------------------------------//
+void KrylovBasis::zero()
+{
+  std::fill(d_double.begin(), d_double.end(), 0.0);
+  std::fill(d_single.begin(), d_single.end(), 0.0f);
+}
+
+//----------------------------------------------------------------------------//
+void KrylovBasis::set(const int j, const Vector &x)
+{
+  Require(j < d_m);
+  Require(x.size() == d_n);
+  const double *X = &x[0];
+  std::size_t offset = (std::size_t)j * d_n;
+  if (d_precision == DOUBLE)
+  {
+    std::copy(X, X + d_n, d_double.begin() + offset);
+    return;
+  }
+  float *V = &d_single[offset];
+  #pragma omp parallel for if (d_n > Vector::OMP_MINIMUM_SIZE)
+  for (int i = 0; i < d_n; ++i)
+    V[i] = (float)X[i];
+}
+
+//----------------------------------------------------------------------------//
+void KrylovBasis::get(const int j, Vector &x) const
+{
+  Require(j < d_m);
+  Require(x.size() == d_n);
+  double *X = &x[0];
+  std::size_t offset = (std::size_t)j * d_n;
+  if (d_precision == DOUBLE)
+  {
+    std::copy(d_double.begin() + offset,
+              d_double.begin() + offset + d_n, X);
+    return;
+  }
+  const float *V = &d_single[offset];
+  #pragma omp parallel for if (d_n > Vector::OMP_MINIMUM_SIZE)
+  for (int i = 0; i < d_n; ++i)
+    X[i] = (double)V[i];
+}
+
+//----------------------------------------------------------------------------//
+Vector::SP_vector KrylovBasis::view(const int j)
+{
+  Require(j < d_m);
+  Insist(d_precision == DOUBLE, "Views need a double precision basis");
+  return Vector::SP_vector(new Vector(d_n, &d_double[0] + (std::size_t)j * d_n));
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file KrylovBasis.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  KrylovBasis.hh
+ *  @brief KrylovBasis class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_KRYLOVBASIS_HH_
+#define callow_KRYLOVBASIS_HH_
+
+#include "callow/vector/Vector.hh"
+#include <cstddef>
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class KrylovBasis
+ *  @brief Contiguous storage for the basis of a Krylov or search subspace
+ *
+ *  The m basis vectors of length n are stored one after another, in
+ *  either double or single precision.  Vectors are read and written
+ *  through double precision \ref Vector objects, and the inner products
+ *  and linear combinations with the basis always accumulate in double,
+ *  so only the storage is rounded.  Single precision halves the memory
+ *  and the bandwidth of orthogonalization, at the cost of an
+ *  orthogonality of the stored basis no better than about 1e-7.
+ *  Solvers using it must therefore compute the quantities they
+ *  converge on (e.g. residuals) in double and treat the basis as a
+ *  source of corrections only.
+ *
+ *  In double precision, the operations are those of the \ref Vector
+ *  multi-vector kernels, and views of the basis vectors are available.
+ */
+class CALLOW_EXPORT KrylovBasis
+{
+
+public:
+
+  /// Storage precisions
+  enum PRECISION_TYPES
+  {
+    DOUBLE, SINGLE, END_PRECISION_TYPES
+  };
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param m          number of basis vectors
+   *  @param n          length of each vector
+   *  @param precision  storage precision
+   */
+  KrylovBasis(const int m, const int n, const int precision = DOUBLE);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Number of basis vectors
+  int number_vectors() const { return d_m; }
+  /// Length of the basis vectors
+  int size() const { return d_n; }
+  /// Storage precision
+  int precision() const { return d_precision; }
+  /// Bytes used to store the basis
+  std::size_t bytes() const;
+  /// Bytes needed for m vectors of length n in the given precision
+  static std::size_t bytes(const int m, const int n, const int precision);
+
+  /// Zero all vectors
+  void zero();
+  /// Store x as vector j
+  void set(const int j, const Vector &x);
+  /// Copy vector j into x
+  void get(const int j, Vector &x) const;
+  /// View of vector j (double precision only)
+  Vector::SP_vector view(const int j);
+
+  /// Compute d[j] = (w, v_j) for j < k in one pass over w
+  void dot(const int k, Vector &w, double *d) const;
+  /// Compute w += sum_j a[j] * v_j for j < k in one pass over w
+  void add(const int k, const double *a, Vector &w) const;
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Number and length of the vectors
+  int d_m;
+  int d_n;
+  /// Storage precision
+  int d_precision;
+  /// Storage for each precision, only one of which is used
+  std::vector<double> d_double;
+  std::vector<float>  d_single;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Inner products with at most MULTI_BLOCK single precision vectors
+  void dot_block(const int nj, const float * const *v,
+                 const double *w, double *d) const;
+  /// Linear combination of at most MULTI_BLOCK single precision vectors
+  void add_block(const int nj, const double *a, const float * const *v,
+                 double *w) const;
+
+};
+
+} // end namespace callow
+
+#include "KrylovBasis.i.hh"
+
+#endif // callow_KRYLOVBASIS_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file KrylovBasis.hh
+//----------------------------------------------------------------------------//
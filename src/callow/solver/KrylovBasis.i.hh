@@ -0,0 +1,131 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  KrylovBasis.i.hh
+ *  @brief KrylovBasis inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_KRYLOVBASIS_I_HH_
+#define callow_KRYLOVBASIS_I_HH_
+
+#include <algorithm>
+#include <vector>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+inline void KrylovBasis::dot(const int k, Vector &w, double *d) const
+{
+  Require(k <= d_m);
+  Require(w.size() == d_n);
+  if (d_precision == DOUBLE)
+  {
+    w.multi_dot(k, &d_double[0], d);
+    return;
+  }
+  const float *columns[Vector::MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += Vector::MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)Vector::MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+      columns[j] = &d_single[0] + (std::size_t)(j0 + j) * d_n;
+    dot_block(nj, columns, &w[0], d + j0);
+  }
+}
+
+//----------------------------------------------------------------------------//
+inline void KrylovBasis::add(const int k, const double *a, Vector &w) const
+{
+  Require(k <= d_m);
+  Require(w.size() == d_n);
+  if (d_precision == DOUBLE)
+  {
+    w.multi_add_a_times_x(k, a, &d_double[0]);
+    return;
+  }
+  const float *columns[Vector::MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += Vector::MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)Vector::MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+      columns[j] = &d_single[0] + (std::size_t)(j0 + j) * d_n;
+    add_block(nj, a + j0, columns, &w[0]);
+  }
+}
+
+//----------------------------------------------------------------------------//
+inline void KrylovBasis::dot_block(const int             nj,
+                                   const float * const  *v,
+                                   const double         *w,
+                                   double               *d) const
+{
+  Require(nj <= Vector::MULTI_BLOCK);
+  for (int j = 0; j < nj; ++j)
+    d[j] = 0.0;
+  const int n = d_n;
+  // As in Vector::multi_dot, the per-thread partial sums are added in
+  // thread order so that repeated products give the same bits.
+  const int nb = Vector::MULTI_BLOCK;
+  int number_threads = 1;
+  std::vector<double> partial;
+  #pragma omp parallel if (n > Vector::OMP_MINIMUM_SIZE)
+  {
+    #pragma omp single
+    {
+#ifdef DETRAN_ENABLE_OPENMP
+      number_threads = omp_get_num_threads();
+#endif
+      partial.assign(number_threads * nb, 0.0);
+    }
+    int thread = 0;
+#ifdef DETRAN_ENABLE_OPENMP
+    thread = omp_get_thread_num();
+#endif
+    double d_local[Vector::MULTI_BLOCK];
+    for (int j = 0; j < nj; ++j)
+      d_local[j] = 0.0;
+    #pragma omp for schedule(static) nowait
+    for (int i = 0; i < n; ++i)
+    {
+      double w_i = w[i];
+      for (int j = 0; j < nj; ++j)
+        d_local[j] += w_i * (double)v[j][i];
+    }
+    for (int j = 0; j < nj; ++j)
+      partial[thread * nb + j] = d_local[j];
+  }
+  for (int t = 0; t < number_threads; ++t)
+    for (int j = 0; j < nj; ++j)
+      d[j] += partial[t * nb + j];
+}
+
+//----------------------------------------------------------------------------//
+inline void KrylovBasis::add_block(const int             nj,
+                                   const double         *a,
+                                   const float * const  *v,
+                                   double               *w) const
+{
+  Require(nj <= Vector::MULTI_BLOCK);
+  const int n = d_n;
+  #pragma omp parallel for if (n > Vector::OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; ++i)
+  {
+    double w_i = w[i];
+    for (int j = 0; j < nj; ++j)
+      w_i += a[j] * (double)v[j][i];
+    w[i] = w_i;
+  }
+}
+
+} // end namespace callow
+
+#endif // callow_KRYLOVBASIS_I_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file KrylovBasis.i.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,224 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  KrylovSchur.cc
+ *  @brief KrylovSchur member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "KrylovSchur.hh"
+#include "Eispack.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace callow
+{
+
+/// Orders eigenvalues by decreasing magnitude
+struct KrylovSchurMagnitude
+{
+  KrylovSchurMagnitude(const std::vector<double> &wr,
+                       const std::vector<double> &wi)
+    : d_wr(wr), d_wi(wi)
+  {/* ... */}
+  bool operator()(const int i, const int j) const
+  {
+    return d_wr[i]*d_wr[i] + d_wi[i]*d_wi[i] >
+           d_wr[j]*d_wr[j] + d_wi[j]*d_wi[j];
+  }
+  const std::vector<double> &d_wr;
+  const std::vector<double> &d_wi;
+};
+
+//----------------------------------------------------------------------------//
+KrylovSchur::KrylovSchur(const double tol,
+                         const int    maxit,
+                         const int    subspace_size,
+                         const int    number_values)
+  : Base(tol, maxit, "krylovschur")
+  , d_subspace_size(subspace_size)
+  , d_number_values(number_values)
+  , d_number_applications(0)
+{
+  Insist(d_subspace_size >= 3, "Krylov-Schur needs a subspace size >= 3");
+  Insist(d_number_values > 0 && d_number_values < d_subspace_size,
+         "Krylov-Schur needs 0 < number of values < subspace size");
+}
+
+//----------------------------------------------------------------------------//
+void KrylovSchur::solve_impl(Vector &x, Vector &x0)
+{
+  int n   = x.size();
+  int m   = std::min(d_subspace_size, n);
+  int nev = std::min(d_number_values, m);
+
+  // Initialize guess if not present
+  if (!x0.size()) x0.resize(n, 1.0);
+
+  ArnoldiDecomposition arnoldi(d_A, m, d_B ? d_solver : SP_linearsolver(0));
+  arnoldi.initialize(x0);
+
+  std::vector<int>    order;
+  std::vector<double> wr, wi, Z, residual;
+  int k    = 0;
+  int size = 0;
+  for (int it = 1; ; ++it)
+  {
+    // extend the decomposition and get the ritz pairs
+    size = arnoldi.extend(k, m);
+    ritz(arnoldi, size, order, wr, wi, Z, residual);
+
+    // check the wanted values.  a breakdown means the ritz pairs
+    // are exact.
+    double r = 0.0;
+    for (int i = 0; i < std::min(nev, size); ++i)
+      r = std::max(r, residual[order[i]]);
+    if (monitor(it, wr[order[0]], r) || arnoldi.breakdown()) break;
+
+    // keep half way between the wanted values and the subspace, but do
+    // not split a conjugate pair.  without a breakdown, size = m < n.
+    int keep = std::min(size - 1, nev + (size - nev) / 2);
+    if (wi[order[keep - 1]] > 0.0)
+      keep += keep + 1 < size ? 1 : -1;
+    Assert(keep > 0);
+
+    // orthonormalize the kept ritz vectors (or the real and imaginary
+    // parts of a pair), which span an invariant subspace of H
+    ArnoldiDecomposition::vec2_dbl Q;
+    for (int c = 0; c < keep; ++c)
+    {
+      std::vector<double> q(Z.begin() + order[c] * size,
+                            Z.begin() + (order[c] + 1) * size);
+      double norm_q = 0.0;
+      for (int i = 0; i < size; ++i)
+        norm_q += q[i] * q[i];
+      norm_q = std::sqrt(norm_q);
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        for (int j = 0; j < Q.size(); ++j)
+        {
+          double d = 0.0;
+          for (int i = 0; i < size; ++i)
+            d += Q[j][i] * q[i];
+          for (int i = 0; i < size; ++i)
+            q[i] -= d * Q[j][i];
+        }
+      }
+      double norm = 0.0;
+      for (int i = 0; i < size; ++i)
+        norm += q[i] * q[i];
+      norm = std::sqrt(norm);
+      if (norm <= 1.0e-12 * norm_q) continue;
+      for (int i = 0; i < size; ++i)
+        q[i] /= norm;
+      Q.push_back(q);
+    }
+    arnoldi.restart(size, Q);
+    k = Q.size();
+  }
+
+  // extract the wanted values and vectors
+  int nw = std::min(nev, size);
+  d_values_real.resize(nw);
+  d_values_imag.resize(nw);
+  d_vectors.resize(nw);
+  for (int i = 0; i < nw; ++i)
+  {
+    int j = order[i];
+    d_values_real[i] = wr[j];
+    d_values_imag[i] = wi[j];
+    d_vectors[i] = new Vector(n, 0.0);
+    arnoldi.basis().add(size, &Z[j * size], *d_vectors[i]);
+    double sum = 0.0;
+    for (int p = 0; p < n; ++p)
+      sum += (*d_vectors[i])[p];
+    double norm = d_vectors[i]->norm(L2);
+    d_vectors[i]->scale((sum < 0.0 ? -1.0 : 1.0) / norm);
+  }
+  x.copy(*d_vectors[0]);
+  d_lambda = d_values_real[0];
+  d_number_applications = arnoldi.number_applications();
+}
+
+//----------------------------------------------------------------------------//
+void KrylovSchur::ritz(const ArnoldiDecomposition &arnoldi,
+                       const int                   m,
+                       std::vector<int>           &order,
+                       std::vector<double>        &wr,
+                       std::vector<double>        &wi,
+                       std::vector<double>        &Z,
+                       std::vector<double>        &residual)
+{
+  // eigenpairs of the projected matrix, which rg overwrites
+  std::vector<double> H(m * m, 0.0);
+  for (int j = 0; j < m; ++j)
+    for (int i = 0; i < m; ++i)
+      H[j * m + i] = arnoldi.H(i, j);
+  wr.assign(m, 0.0);
+  wi.assign(m, 0.0);
+  Z.assign(m * m, 0.0);
+  std::vector<int>    iv1(m, 0);
+  std::vector<double> fv1(m, 0.0);
+  int matz = 1;
+  int ierr = 0;
+  rg_(&m, &m, &H[0], &wr[0], &wi[0], &matz, &Z[0], &iv1[0], &fv1[0], &ierr);
+  Insist(!ierr, "The projected Krylov-Schur eigenproblem failed.");
+
+  // sort by magnitude, then pull each pair together.  rg stores a pair
+  // with the positive imaginary part first.
+  std::vector<int> sorted(m);
+  for (int i = 0; i < m; ++i)
+    sorted[i] = i;
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   KrylovSchurMagnitude(wr, wi));
+  std::vector<bool> used(m, false);
+  order.clear();
+  for (int s = 0; s < m; ++s)
+  {
+    int i = sorted[s];
+    if (used[i]) continue;
+    if (wi[i] == 0.0)
+    {
+      order.push_back(i);
+      used[i] = true;
+    }
+    else
+    {
+      int f = wi[i] > 0.0 ? i : i - 1;
+      order.push_back(f);
+      order.push_back(f + 1);
+      used[f] = used[f + 1] = true;
+    }
+  }
+
+  // residual norms |b'y|/|y|, with y = re + i*im for a pair
+  residual.assign(m, 0.0);
+  for (int j = 0; j < m; ++j)
+  {
+    int f = j;
+    int c = 1;
+    if (wi[j] != 0.0)
+    {
+      f = wi[j] > 0.0 ? j : j - 1;
+      c = 2;
+    }
+    double by = 0.0, yy = 0.0;
+    for (int p = f; p < f + c; ++p)
+    {
+      double b_p = 0.0;
+      for (int i = 0; i < m; ++i)
+      {
+        b_p += arnoldi.H(m, i) * Z[p * m + i];
+        yy  += Z[p * m + i] * Z[p * m + i];
+      }
+      by += b_p * b_p;
+    }
+    residual[j] = yy > 0.0 ? std::sqrt(by / yy) : 0.0;
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file KrylovSchur.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  KrylovSchur.hh
+ *  @brief KrylovSchur class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_KRYLOVSCHUR_HH_
+#define callow_KRYLOVSCHUR_HH_
+
+#include "EigenSolver.hh"
+#include "ArnoldiDecomposition.hh"
+
+namespace callow
+{
+
+/**
+ *  @class KrylovSchur
+ *  @brief Solves eigenproblems by the thick-restart Krylov-Schur method
+ *
+ *  The method builds an m-step Arnoldi decomposition (see
+ *  \ref ArnoldiDecomposition) of @f$ \mathbf{A} @f$ (or of
+ *  @f$ \mathbf{B}^{-1}\mathbf{A} @f$ for a generalized problem) and
+ *  computes the eigenpairs @f$ (\theta_i, y_i) @f$ of the small projected
+ *  matrix.  The Ritz pair @f$ (\theta_i, \mathbf{V}y_i) @f$ has the
+ *  residual norm @f$ |b^T y_i| @f$, so convergence is checked without
+ *  applying the operator.  The eigenvalues are wanted in order of
+ *  decreasing magnitude.
+ *
+ *  Rather than starting over from a single vector, a restart keeps the
+ *  Krylov decomposition restricted to the k leading Ritz vectors, whose
+ *  span is invariant under the projected matrix, and then extends it
+ *  by m - k Arnoldi steps.  This is equivalent to Stewart's Krylov-Schur
+ *  restart, with the wanted Ritz vectors orthonormalized in place of
+ *  reordered Schur vectors.  A complex conjugate pair is kept through
+ *  the real and imaginary parts of its Ritz vector.  The number kept is
+ *  half way between the wanted number of values and m.
+ *
+ *  The solve is converged when the largest residual norm of the wanted
+ *  values is below the tolerance.  An iteration is one restart cycle.
+ *  The dominant eigenvalue and its (real, positive-sum) eigenvector are
+ *  returned through the base interface, and all wanted values and
+ *  vectors are available afterward.  The operator may be any matrix,
+ *  including shells.
+ *
+ *  Relevant database entries:
+ *    - eigen_solver_subspace_size [int] m (default 20)
+ *    - eigen_number_values [int] wanted values (default 1)
+ */
+class CALLOW_EXPORT KrylovSchur: public EigenSolver
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef EigenSolver                       Base;
+  typedef Base::SP_matrix                   SP_matrix;
+  typedef Base::SP_solver                   SP_solver;
+  typedef Base::SP_vector                   SP_vector;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param tol            tolerance on the residual norms
+   *  @param maxit          maximum number of restart cycles
+   *  @param subspace_size  maximum subspace size m
+   *  @param number_values  number of wanted eigenvalues
+   */
+  KrylovSchur(const double tol           = 1e-6,
+              const int    maxit         = 100,
+              const int    subspace_size = 20,
+              const int    number_values = 1);
+
+  virtual ~KrylovSchur(){}
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Number of wanted eigenvalues
+  int number_values() const { return d_number_values; }
+
+  /// Real parts of the wanted eigenvalues, by decreasing magnitude
+  const std::vector<double>& eigenvalues_real() const { return d_values_real; }
+
+  /// Imaginary parts of the wanted eigenvalues
+  const std::vector<double>& eigenvalues_imag() const { return d_values_imag; }
+
+  /**
+   *  Real eigenvector i, normalized.  For a complex pair, the vectors of
+   *  the pair are the real and imaginary parts of the first's vector.
+   */
+  SP_vector eigenvector(const int i) const
+  {
+    Require(i < d_vectors.size());
+    return d_vectors[i];
+  }
+
+  /// Number of applications of the operator in the last solve
+  int number_applications() const { return d_number_applications; }
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Maximum subspace size
+  int d_subspace_size;
+  /// Number of wanted eigenvalues
+  int d_number_values;
+  /// Wanted eigenvalues and vectors
+  std::vector<double> d_values_real;
+  std::vector<double> d_values_imag;
+  std::vector<SP_vector> d_vectors;
+  /// Number of applications of the operator
+  int d_number_applications;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL EIGENSOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  void solve_impl(Vector &x, Vector &x0);
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  Compute the eigenpairs of the leading m x m block of H, ordered by
+   *  decreasing magnitude with conjugate pairs adjacent (positive
+   *  imaginary part first), and their residual norms.  Eigenvector j is
+   *  stored in column j of Z, i.e. Z[j*m + i], with a pair's real and
+   *  imaginary parts in the columns of its two values.
+   */
+  void ritz(const ArnoldiDecomposition &arnoldi,
+            const int                   m,
+            std::vector<int>           &order,
+            std::vector<double>        &wr,
+            std::vector<double>        &wi,
+            std::vector<double>        &Z,
+            std::vector<double>        &residual);
+
+};
+
+} // end namespace callow
+
+#endif /* callow_KRYLOVSCHUR_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file KrylovSchur.hh
+//----------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include "callow/callow_config.hh"
 #include "callow/utils/CallowDefinitions.hh"
 #include "callow/matrix/MatrixBase.hh"
+#include "callow/matrix/MatrixFormat.hh"
 #include "callow/preconditioner/Preconditioner.hh"
 #include "utilities/InputDB.hh"
 #include "utilities/SP.hh"
@@ -58,6 +59,10 @@ namespace callow
  *    - Jacobi
  *    - Gauss-Seidel
  *    - GMRES(m)
+ *    - CG, for symmetric positive definite systems
+ *    - BiCGSTAB
+ *    - pipelined GMRES(m) and CG, which need one reduction per iteration
+ *    - block GMRES(m), for several right hand sides at once
  *  along with Jacobi and ILU0 preconditioners.  If PETSc is enabled,
  *  all of its solvers are potentially available.
  *
@@ -160,6 +165,16 @@ public:
     d_monitor_diverge = v;
   }
 
+  /**
+   *  Set the storage used for the operator.  An assembled CSR operator
+   *  is converted when set; preconditioners are still built from the
+   *  CSR matrix.
+   */
+  void set_matrix_format(const MatrixFormat &format)
+  {
+    d_matrix_format = format;
+  }
+
   /// Set a norm type
   void set_norm_type(const int norm_type)
   {
@@ -190,6 +205,12 @@ public:
     return d_number_iterations;
   }
 
+  /// return the status of the last solve
+  int status() const
+  {
+    return d_status;
+  }
+
 protected:
 
   //--------------------------------------------------------------------------//
@@ -222,6 +243,8 @@ protected:
   int d_norm_type;
   /// Parameter database
   SP_db d_db;
+  /// Storage format for the operator
+  MatrixFormat d_matrix_format;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -13,6 +13,11 @@
 #include "Jacobi.hh"
 #include "GaussSeidel.hh"
 #include "GMRES.hh"
+#include "BlockGMRES.hh"
+#include "CG.hh"
+#include "BiCGSTAB.hh"
+#include "PipelinedGMRES.hh"
+#include "PipelinedCG.hh"
 #include "PetscSolver.hh"
 
 namespace callow
@@ -33,6 +38,8 @@ LinearSolverCreator::Create(SP_db db)
   bool monitor_diverge = false;
   double omega = 1.0;
   int restart = 30;
+  int orthogonalization = GMRES::MGS;
+  int basis_precision = KrylovBasis::DOUBLE;
 
   if (db)
   {
@@ -58,11 +65,36 @@ LinearSolverCreator::Create(SP_db db)
     {
       omega = db->get<double>("linear_solver_sor_omega");
     }
-    if (solver_type == "gmres" &&
+    if ((solver_type == "gmres" || solver_type == "pgmres" ||
+         solver_type == "bgmres") &&
         db->check("linear_solver_gmres_restart"))
     {
       restart = db->get<int>("linear_solver_gmres_restart");
     }
+    if (solver_type == "gmres" &&
+        db->check("linear_solver_gmres_orthogonalization"))
+    {
+      std::string type =
+        db->get<std::string>("linear_solver_gmres_orthogonalization");
+      if (type == "mgs")
+        orthogonalization = GMRES::MGS;
+      else if (type == "cgs2")
+        orthogonalization = GMRES::CGS2;
+      else
+        THROW("Unsupported GMRES orthogonalization: " + type);
+    }
+    if (solver_type == "gmres" &&
+        db->check("linear_solver_gmres_basis_precision"))
+    {
+      std::string type =
+        db->get<std::string>("linear_solver_gmres_basis_precision");
+      if (type == "double")
+        basis_precision = KrylovBasis::DOUBLE;
+      else if (type == "single")
+        basis_precision = KrylovBasis::SINGLE;
+      else
+        THROW("Unsupported GMRES basis precision: " + type);
+    }
   }
 
 //  std::cout << " CALLOW:" << std::endl;
@@ -98,7 +130,40 @@ LinearSolverCreator::Create(SP_db db)
   //---------------------------------------------------------------------------//
   else if (solver_type == "gmres")
   {
-    solver = new GMRES(atol, rtol, maxit, restart);
+    GMRES *gmres = new GMRES(atol, rtol, maxit, restart);
+    gmres->set_orthogonalization(orthogonalization);
+    gmres->set_basis_precision(basis_precision);
+    solver = gmres;
+  }
+
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "bgmres")
+  {
+    solver = new BlockGMRES(atol, rtol, maxit, restart);
+  }
+
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "cg")
+  {
+    solver = new CG(atol, rtol, maxit);
+  }
+
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "bicgstab")
+  {
+    solver = new BiCGSTAB(atol, rtol, maxit);
+  }
+
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "pgmres")
+  {
+    solver = new PipelinedGMRES(atol, rtol, maxit, restart);
+  }
+
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "pipecg")
+  {
+    solver = new PipelinedCG(atol, rtol, maxit);
   }
 
   //---------------------------------------------------------------------------//
@@ -117,6 +182,20 @@ LinearSolverCreator::Create(SP_db db)
     THROW("Unsupported solver type: " + solver_type);
   }
 
+  // Solvers that access L, D, and U directly (or hand the matrix to
+  // PETSc) need the CSR operator.
+  MatrixFormat format(db, "linear_solver");
+  if (format.format() != MatrixFormat::CSR)
+  {
+    Insist(solver_type == "richardson" || solver_type == "gmres" ||
+           solver_type == "cg"         || solver_type == "bicgstab" ||
+           solver_type == "pgmres"     || solver_type == "pipecg" ||
+           solver_type == "bgmres",
+           "Only Richardson and the Krylov solvers support other "
+           "matrix formats.");
+    solver->set_matrix_format(format);
+  }
+
   solver->set_monitor_diverge(monitor_diverge);
   solver->set_monitor_level(monitor_level);
 
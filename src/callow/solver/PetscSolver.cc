@@ -81,6 +81,39 @@ void PetscSolver::set_operators(SP_matrix A, SP_db db)
     {
       if (pc_type == "ilu0")
         d_P = new PCILU0(d_A);
+      else if (pc_type == "iluk")
+      {
+        int levels = 1;
+        if (d_db->check("pc_ilu_levels"))
+          levels = d_db->get<int>("pc_ilu_levels");
+        d_P = new PCILUK(d_A, levels);
+      }
+      else if (pc_type == "ilut")
+      {
+        double tolerance = 1e-3;
+        int fill = 10;
+        if (d_db->check("pc_ilut_tolerance"))
+          tolerance = d_db->get<double>("pc_ilut_tolerance");
+        if (d_db->check("pc_ilut_fill"))
+          fill = d_db->get<int>("pc_ilut_fill");
+        d_P = new PCILUT(d_A, tolerance, fill);
+      }
+      else if (pc_type == "amg")
+      {
+        double strength = 0.08;
+        int max_levels = 20;
+        int coarse_size = 100;
+        int sweeps = 1;
+        if (d_db->check("pc_amg_strength"))
+          strength = d_db->get<double>("pc_amg_strength");
+        if (d_db->check("pc_amg_levels"))
+          max_levels = d_db->get<int>("pc_amg_levels");
+        if (d_db->check("pc_amg_coarse_size"))
+          coarse_size = d_db->get<int>("pc_amg_coarse_size");
+        if (d_db->check("pc_amg_sweeps"))
+          sweeps = d_db->get<int>("pc_amg_sweeps");
+        d_P = new PCAMG(d_A, strength, max_levels, coarse_size, sweeps);
+      }
       else if (pc_type == "jacobi")
         d_P = new PCJacobi(d_A);
       // Set callow pc as a shell and set the shell operator
@@ -13,7 +13,10 @@
 
 #include "LinearSolver.hh"
 // preconditioners
+#include "callow/preconditioner/PCAMG.hh"
 #include "callow/preconditioner/PCILU0.hh"
+#include "callow/preconditioner/PCILUK.hh"
+#include "callow/preconditioner/PCILUT.hh"
 #include "callow/preconditioner/PCJacobi.hh"
 
 namespace callow
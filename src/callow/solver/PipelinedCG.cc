@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PipelinedCG.cc
+ *  @brief PipelinedCG member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PipelinedCG.hh"
+#include <cmath>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+PipelinedCG::PipelinedCG(const double  atol,
+                         const double  rtol,
+                         const int     maxit)
+  : LinearSolver(atol, rtol, maxit, "solver_pipelined_cg")
+{
+  d_monitor_diverge = false;
+}
+
+//----------------------------------------------------------------------------//
+void PipelinedCG::solve_impl(const Vector &b, Vector &x)
+{
+  int n = x.size();
+
+  // residual, preconditioned residual, and its image
+  Vector r(n, 0.0);
+  Vector u(n, 0.0);
+  Vector w(n, 0.0);
+  // m = P*w and its image
+  Vector m(n, 0.0);
+  Vector nn(n, 0.0);
+  // search direction p and its images s = A*p, q = P*s, and z = A*q
+  Vector p(n, 0.0);
+  Vector s(n, 0.0);
+  Vector q(n, 0.0);
+  Vector z(n, 0.0);
+
+  // the preconditioner applies only once it has been set
+  const bool precondition = d_P && d_pc_side != Base::NONE;
+
+  // r <-- b - A*x, u <-- P*r, w <-- A*u
+  d_A->multiply(x, r);
+  r.subtract(b);
+  r.scale(-1.0);
+  if (precondition)
+    d_P->apply(r, u);
+  else
+    u.copy(r);
+  d_A->multiply(u, w);
+
+  double *X = &x[0];
+  double *R = &r[0], *U = &u[0], *W = &w[0], *M = &m[0], *N = &nn[0];
+  double *P = &p[0], *S = &s[0], *Q = &q[0], *Z = &z[0];
+
+  double alpha = 0.0;
+  double gamma_old = 0.0;
+  for (int iteration = 0; iteration < d_maximum_iterations; ++iteration)
+  {
+    //------------------------------------------------------------------------//
+    // (r, u), (w, u), and (r, r) in one pass
+    //------------------------------------------------------------------------//
+
+    double gamma = 0.0, delta = 0.0, rr = 0.0;
+    #pragma omp parallel for reduction(+:gamma, delta, rr) \
+                             if (n > Vector::OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; ++i)
+    {
+      gamma += R[i] * U[i];
+      delta += W[i] * U[i];
+      rr    += R[i] * R[i];
+    }
+
+    //------------------------------------------------------------------------//
+    // m <-- P*w and n <-- A*m, independent of the reduction
+    //------------------------------------------------------------------------//
+
+    if (precondition)
+      d_P->apply(w, m);
+    else
+      m.copy(w);
+    d_A->multiply(m, nn);
+
+    // the residual is that of the previous update
+    if (iteration == 0)
+    {
+      if (monitor_init(std::sqrt(rr))) return;
+    }
+    else if (monitor(iteration, std::sqrt(rr)))
+    {
+      break;
+    }
+
+    //------------------------------------------------------------------------//
+    // step lengths
+    //------------------------------------------------------------------------//
+
+    double beta = 0.0;
+    double denominator = delta;
+    if (iteration > 0)
+    {
+      beta = gamma / gamma_old;
+      denominator = delta - beta * gamma / alpha;
+    }
+    if (denominator <= 0.0)
+    {
+      if (d_monitor_level > 0)
+        printf("*** %s found a nonpositive curvature (p, Ap) = %12.8e\n",
+               d_name.c_str(), denominator);
+      set_status(DIVERGE);
+      return;
+    }
+    alpha = gamma / denominator;
+    gamma_old = gamma;
+
+    //------------------------------------------------------------------------//
+    // all vector updates in one pass
+    //------------------------------------------------------------------------//
+
+    #pragma omp parallel for if (n > Vector::OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; ++i)
+    {
+      Z[i] = N[i] + beta * Z[i];
+      Q[i] = M[i] + beta * Q[i];
+      S[i] = W[i] + beta * S[i];
+      P[i] = U[i] + beta * P[i];
+      X[i] += alpha * P[i];
+      R[i] -= alpha * S[i];
+      U[i] -= alpha * Q[i];
+      W[i] -= alpha * Z[i];
+    }
+  }
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PipelinedCG.cc
+//----------------------------------------------------------------------------//
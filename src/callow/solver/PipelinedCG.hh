@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PipelinedCG.hh
+ *  @brief PipelinedCG class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PIPELINEDCG_HH_
+#define callow_PIPELINEDCG_HH_
+
+#include "LinearSolver.hh"
+
+namespace callow
+{
+
+/**
+ *  @class PipelinedCG
+ *  @brief Uses pipelined, preconditioned conjugate gradients
+ *
+ *  This is the pipelined CG of Ghysels and Vanroose.  Standard \ref CG
+ *  needs two inner products per iteration, each of which must finish
+ *  before the next step can start.  Here, the residual \f$ r \f$, the
+ *  preconditioned residual \f$ u = \mathbf{P}r \f$, and
+ *  \f$ w = \mathbf{A}u \f$ (along with the images of the search
+ *  direction) are all updated by recurrences, so that
+ *    - the inner products \f$ (r, u) \f$, \f$ (w, u) \f$, and
+ *      \f$ (r, r) \f$ are computed together in one pass,
+ *    - the preconditioner and operator applications
+ *      \f$ m = \mathbf{P}w \f$ and \f$ n = \mathbf{A}m \f$ do not
+ *      depend on that reduction, and
+ *    - the eight vector updates are done together in one pass.
+ *  Each iteration thus has a single synchronization for the inner
+ *  products in place of two, at the cost of four more vectors and
+ *  slightly larger rounding errors in the recursively updated residual.
+ *
+ *  The monitored residual is the L2 norm of the unpreconditioned,
+ *  recursively updated residual.  The same restrictions on
+ *  \f$ \mathbf{A} \f$ and \f$ \mathbf{P} \f$ as for \ref CG apply.
+ */
+class PipelinedCG: public LinearSolver
+{
+
+public:
+
+  typedef LinearSolver Base;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  PipelinedCG(const double atol, const double rtol, const int maxit);
+
+  virtual ~PipelinedCG(){}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // expose base class members
+  using LinearSolver::d_absolute_tolerance;
+  using LinearSolver::d_relative_tolerance;
+  using LinearSolver::d_maximum_iterations;
+  using LinearSolver::d_residual;
+  using LinearSolver::d_number_iterations;
+  using LinearSolver::d_A;
+  using LinearSolver::d_P;
+  using LinearSolver::d_monitor_level;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param b  right hand side
+   *  @param x  unknown vector
+   */
+  void solve_impl(const Vector &b, Vector &x);
+
+};
+
+} // end namespace callow
+
+#endif // callow_PIPELINEDCG_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PipelinedCG.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,256 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PipelinedGMRES.cc
+ *  @brief PipelinedGMRES member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "PipelinedGMRES.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace callow
+{
+
+//----------------------------------------------------------------------------//
+PipelinedGMRES::PipelinedGMRES(const double  atol,
+                               const double  rtol,
+                               const int     maxit,
+                               const int     restart)
+  : LinearSolver(atol, rtol, maxit, "solver_pipelined_gmres")
+  , d_restart(restart)
+  , d_H(restart + 1, std::vector<double>(restart, 0.0))
+  , d_beta(restart + 1, 0.0)
+  , d_c(restart + 1, 0.0)
+  , d_s(restart + 1, 0.0)
+{
+  Insist(d_restart > 2, "Need a restart of > 2");
+}
+
+//----------------------------------------------------------------------------//
+void PipelinedGMRES::solve_impl(const Vector &b, Vector &x)
+{
+  int n = x.size();
+  int m = std::min(d_restart, n);
+
+  // arnoldi basis v[0:m] and shifted basis z[0:m], each stored
+  // contiguously for the fused inner products and updates
+  Vector V((m + 1) * n, 0.0);
+  Vector Z((m + 1) * n, 0.0);
+  std::vector<Vector::SP_vector> v(m + 1);
+  std::vector<Vector::SP_vector> z(m + 1);
+  for (int i = 0; i <= m; ++i)
+  {
+    v[i] = new Vector(n, &V[0] + i * n);
+    z[i] = new Vector(n, &Z[0] + i * n);
+  }
+
+  // residual and work vectors
+  Vector r(n, 0.0);
+  Vector t(n, 0.0);
+  Vector u(n, 0.0);
+
+  // columns for the fused inner products, and their results
+  std::vector<const double*> columns(m + 2);
+  std::vector<double> d(m + 2, 0.0);
+  std::vector<double> a(m + 1, 0.0);
+
+  // g(1:k) = R*y and |g(k+1)| is the residual
+  std::vector<double> g(m + 1, 0.0);
+  std::vector<double> y(m, 0.0);
+
+  int iteration = 0;
+  bool done = false;
+  while (!done)
+  {
+    //------------------------------------------------------------------------//
+    // compute the (left preconditioned) residual and start the basis
+    //------------------------------------------------------------------------//
+
+    d_A->multiply(x, t);
+    t.subtract(b);
+    t.scale(-1.0);
+    if (d_P && d_pc_side == Base::LEFT)
+      d_P->apply(t, r);
+    else
+      r.copy(t);
+    double rho = r.norm(L2);
+    if (iteration == 0 && monitor_init(rho)) return;
+
+    v[0]->copy(r);
+    v[0]->scale(1.0 / rho);
+    z[0]->copy(*v[0]);
+    std::fill(g.begin(), g.end(), 0.0);
+    g[0] = rho;
+
+    // squared norm of z[i], with z[0] = v[0]
+    double zz = 1.0;
+
+    //------------------------------------------------------------------------//
+    // iteration i applies the operator to z[i], finishes v[i], and
+    // computes column i of H.  column i - 1 is complete at its end.
+    //------------------------------------------------------------------------//
+
+    int k = 0;
+    for (int i = 0; i <= m; ++i)
+    {
+      // z[i+1] <-- A*z[i], which needs none of the inner products that
+      // follow, as the last iteration only finishes the basis
+      Vector &w = i < m ? *z[i + 1] : u;
+      if (i < m) apply_operator(*z[i], w, t);
+
+      // normalize v[i-1], z[i], z[i+1], and column i - 1 now that the
+      // norm of v[i-1] is known
+      if (i > 1)
+      {
+        double h = d_beta[i - 1];
+        v[i - 1]->scale(1.0 / h);
+        z[i]->scale(1.0 / h);
+        if (i < m) w.scale(1.0 / h);
+        for (int j = 0; j < i - 1; ++j)
+          d_H[j][i - 1] /= h;
+        d_H[i - 1][i - 1] /= h * h;
+        zz /= h * h;
+      }
+
+      if (i > 0)
+      {
+        // coefficients of column i - 1
+        for (int j = 0; j < i; ++j)
+          a[j] = -d_H[j][i - 1];
+
+        // z[i+1] <-- z[i+1] - sum_j H[j][i-1] z[j+1]
+        if (i < m) w.multi_add_a_times_x(i, &a[0], &Z[0] + n);
+
+        // v[i] <-- z[i] - sum_j H[j][i-1] v[j]
+        v[i]->copy(*z[i]);
+        v[i]->multi_add_a_times_x(i, &a[0], &V[0]);
+
+        // norm of v[i] from that of z[i], unless cancellation is severe
+        double hh = zz;
+        for (int j = 0; j < i; ++j)
+          hh -= d_H[j][i - 1] * d_H[j][i - 1];
+        if (hh > 1.0e-4 * zz)
+          d_beta[i] = std::sqrt(hh);
+        else
+          d_beta[i] = v[i]->norm(L2);
+      }
+
+      // column i of H and the squared norm of z[i+1] in one pass
+      if (i < m)
+      {
+        for (int j = 0; j <= i; ++j)
+          columns[j] = &V[0] + j * n;
+        columns[i + 1] = &w[0];
+        w.multi_dot(i + 2, &columns[0], &d[0]);
+        for (int j = 0; j <= i; ++j)
+          d_H[j][i] = d[j];
+        zz = d[i + 1];
+      }
+
+      if (i == 0) continue;
+
+      //----------------------------------------------------------------------//
+      // triangularize column i - 1 and monitor the residual
+      //----------------------------------------------------------------------//
+
+      k = i;
+      d_H[i][i - 1] = d_beta[i];
+      rho = apply_givens(i - 1, g);
+      ++iteration;
+      if (monitor(iteration, rho))
+      {
+        done = true;
+        break;
+      }
+
+      // a vanishing v[i] means A*x = b is solved in the current subspace
+      if (d_beta[i] == 0.0)
+      {
+        if (d_monitor_level > 0)
+          printf("happy breakdown for k = %5i (iteration = %5i) \n",
+                 i, iteration);
+        done = true;
+        break;
+      }
+    }
+
+    //------------------------------------------------------------------------//
+    // update the solution
+    //------------------------------------------------------------------------//
+
+    // solve R*y = g, with R the leading k by k block of H
+    for (int i = k - 1; i >= 0; --i)
+    {
+      y[i] = g[i];
+      for (int j = i + 1; j < k; ++j)
+        y[i] -= d_H[i][j] * y[j];
+      Assert(d_H[i][i] != 0.0);
+      y[i] /= d_H[i][i];
+    }
+
+    // x <-- x + inv(P_R)*V*y, with v[0:k] all normalized by now
+    u.set(0.0);
+    u.multi_add_a_times_x(k, &y[0], &V[0]);
+    if (d_P && d_pc_side == Base::RIGHT)
+    {
+      d_P->apply(u, t);
+      x.add(t);
+    }
+    else
+    {
+      x.add(u);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+void PipelinedGMRES::apply_operator(Vector &x, Vector &y, Vector &t)
+{
+  if (d_P && d_pc_side == Base::RIGHT)
+  {
+    d_P->apply(x, t);
+    d_A->multiply(t, y);
+  }
+  else if (d_P && d_pc_side == Base::LEFT)
+  {
+    d_A->multiply(x, t);
+    d_P->apply(t, y);
+  }
+  else
+  {
+    d_A->multiply(x, y);
+  }
+}
+
+//----------------------------------------------------------------------------//
+double PipelinedGMRES::apply_givens(const int k, std::vector<double> &g)
+{
+  // apply the previous rotations to column k
+  for (int i = 0; i < k; ++i)
+  {
+    double h_0 = d_c[i] * d_H[i][k] - d_s[i] * d_H[i + 1][k];
+    double h_1 = d_s[i] * d_H[i][k] + d_c[i] * d_H[i + 1][k];
+    d_H[i][k]     = h_0;
+    d_H[i + 1][k] = h_1;
+  }
+  // and the new rotation that zeros H[k+1][k]
+  double nu = std::sqrt(d_H[k][k] * d_H[k][k] + d_H[k + 1][k] * d_H[k + 1][k]);
+  d_c[k] =  d_H[k][k] / nu;
+  d_s[k] = -d_H[k + 1][k] / nu;
+  d_H[k][k] = d_c[k] * d_H[k][k] - d_s[k] * d_H[k + 1][k];
+  d_H[k + 1][k] = 0.0;
+  double g_0 = d_c[k] * g[k] - d_s[k] * g[k + 1];
+  double g_1 = d_s[k] * g[k] + d_c[k] * g[k + 1];
+  g[k]     = g_0;
+  g[k + 1] = g_1;
+  return std::abs(g_1);
+}
+
+} // end namespace callow
+
+//----------------------------------------------------------------------------//
+//              end of file PipelinedGMRES.cc
+//----------------------------------------------------------------------------//
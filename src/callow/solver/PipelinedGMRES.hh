@@ -0,0 +1,120 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  PipelinedGMRES.hh
+ *  @brief PipelinedGMRES class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef callow_PIPELINEDGMRES_HH_
+#define callow_PIPELINEDGMRES_HH_
+
+#include "LinearSolver.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class PipelinedGMRES
+ *  @brief Uses pipelined GMRES(m) iteration to solve a system
+ *
+ *  This is the p(1)-GMRES of Ghysels, Ashby, Meerbergen, and Vanroose.
+ *  Alongside the Arnoldi basis \f$ v_j \f$, it carries the shifted
+ *  basis \f$ z_{j+1} = \mathbf{A} v_j \f$, built by the same recurrence
+ *  as the \f$ v_j \f$.  Normalization is delayed by one iteration, so
+ *  the operator application that extends the basis does not depend on
+ *  the inner products of the current iteration.  All inner products of
+ *  an iteration, i.e. the Hessenberg column and the norm used for the
+ *  next basis vector, are computed together in a single pass, leaving
+ *  one reduction per iteration in place of the k + 2 of
+ *  GMRES with modified Gram-Schmidt.
+ *
+ *  The price is stability: the projections are those of classical
+ *  Gram-Schmidt, and the norm of a new basis vector is computed as
+ *  @f[
+ *     \| v_i \|^2 = \| z_i \|^2 - \sum_{j<i} h_{j,i-1}^2 \, ,
+ *  @f]
+ *  which loses accuracy to cancellation as the subspace captures
+ *  \f$ z_i \f$; in that case the norm is computed directly.  The
+ *  monitored residual is the GMRES estimate, and it lags the operator
+ *  applications by one iteration.  Preconditioning follows \ref GMRES.
+ *
+ *  Relevant database entries:
+ *    - linear_solver_gmres_restart [int] restart, shared with GMRES
+ */
+class PipelinedGMRES: public LinearSolver
+{
+
+public:
+
+  typedef LinearSolver Base;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  PipelinedGMRES(const double atol, const double rtol, const int maxit,
+                 const int restart = 20);
+
+  virtual ~PipelinedGMRES(){}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // expose base class members
+  using LinearSolver::d_absolute_tolerance;
+  using LinearSolver::d_relative_tolerance;
+  using LinearSolver::d_maximum_iterations;
+  using LinearSolver::d_residual;
+  using LinearSolver::d_number_iterations;
+  using LinearSolver::d_A;
+  using LinearSolver::d_P;
+  using LinearSolver::d_pc_side;
+  using LinearSolver::d_monitor_level;
+
+  /// maximum size of krylov subspace
+  int d_restart;
+
+  /// upper hessenberg [m+1][m], rotated to upper triangular as it is built
+  std::vector<std::vector<double> > d_H;
+
+  /// unrotated subdiagonal of the hessenberg [m+1]
+  std::vector<double> d_beta;
+
+  /// cosine and sine term in givens rotation [m+1]
+  std::vector<double> d_c;
+  std::vector<double> d_s;
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @param b  right hand side
+   *  @param x  unknown vector
+   */
+  void solve_impl(const Vector &b, Vector &x);
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Apply y <-- inv(P_L)*A*inv(P_R)*x, with t as work space
+  void apply_operator(Vector &x, Vector &y, Vector &t);
+
+  /// Rotate column k of H and return the new residual estimate
+  double apply_givens(const int k, std::vector<double> &g);
+
+};
+
+} // end namespace callow
+
+#endif // callow_PIPELINEDGMRES_HH_
+
+//----------------------------------------------------------------------------//
+//              end of file PipelinedGMRES.hh
+//----------------------------------------------------------------------------//
@@ -9,7 +9,8 @@
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                    \
         FUNC(test_Davidson_standard) \
-        FUNC(test_Davidson_general)
+        FUNC(test_Davidson_general)  \
+        FUNC(test_Davidson_single)
 
 #include "utilities/TestDriver.hh"
 #include "callow/utils/Initialization.hh"
@@ -123,6 +124,52 @@ int test_Davidson_general(int argc, char *argv[])
   return 0;
 }
 
+/*
+ *  Repeats the problems above with the corrections stored in single
+ *  precision, which must converge to the same tolerance.
+ */
+int test_Davidson_single(int argc, char *argv[])
+{
+  Matrix::SP_matrix M = test_matrix_2(10);
+  Matrix::SP_matrix F = test_matrix_3(10);
+  int n = M->number_columns();
+
+  double ref_L[] = {0.141079562648794, 1.243023126562274};
+  double ref_V[][3] =
+  {{1.000000000000000, -2.916559254113351, 4.589758628640770},
+   {1.000000000000000,  0.976684255089969, 0.930596388729471}};
+  for (int p = 0; p < 2; ++p)
+  {
+    Vector X (n, 1.0);
+    Vector X0(n, 1.0);
+    Davidson solver(1e-10, p ? 50 : 100, 20);
+    solver.set_basis_precision(KrylovBasis::SINGLE);
+    if (p)
+      solver.set_operators(F, M);
+    else
+      solver.set_operators(M);
+    solver.solve(X, X0);
+    X.scale(1.0/X[0]);
+    printf("%16.8f  %16.8f \n", solver.eigenvalue(), ref_L[p]);
+    TEST(soft_equiv(solver.eigenvalue(), ref_L[p], 1.0e-8));
+    for (int i = 0; i < 3; ++i)
+    {
+      printf("%16.8f  %16.8f \n", X[i], ref_V[p][i]);
+      TEST(soft_equiv(X[i], ref_V[p][i], 1.0e-8));
+    }
+  }
+
+  // memory of the subspace and its images for a million unknowns
+  Davidson solver(1e-10, 100, 20);
+  std::size_t bytes_double = solver.basis_bytes(1000000);
+  solver.set_basis_precision(KrylovBasis::SINGLE);
+  std::size_t bytes_single = solver.basis_bytes(1000000);
+  printf("subspace memory: %8.1f MB (double) %8.1f MB (single)\n",
+         bytes_double / 1.0e6, bytes_single / 1.0e6);
+  TEST(bytes_single < 0.55 * bytes_double);
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_Matrix.cc
 //---------------------------------------------------------------------------//
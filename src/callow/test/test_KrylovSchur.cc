@@ -0,0 +1,203 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_KrylovSchur.cc
+ *  @brief Test of KrylovSchur class
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                         \
+        FUNC(test_KrylovSchur_standard)   \
+        FUNC(test_KrylovSchur_complex)    \
+        FUNC(test_KrylovSchur_general)
+
+#include "utilities/TestDriver.hh"
+#include "callow/utils/Initialization.hh"
+#include "callow/solver/KrylovSchur.hh"
+#include "callow/solver/EigenSolverCreator.hh"
+#include "callow/solver/PowerIteration.hh"
+#include "callow/matrix/MatrixShell.hh"
+#include "matrix_fixture.hh"
+#include <cmath>
+#include <iostream>
+
+using namespace callow;
+using namespace detran_test;
+using detran_utilities::soft_equiv;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/// Wraps a matrix as a shell
+class KSShell: public MatrixShell
+{
+public:
+  KSShell(MatrixBase::SP_matrix A)
+    : MatrixShell(this, A->number_rows(), A->number_columns())
+    , d_A(A)
+  {/* ... */}
+  void multiply(const Vector &x,  Vector &y)
+  {
+    d_A->multiply(x, y);
+  }
+  void multiply_transpose(const Vector &x,  Vector &y)
+  {
+    d_A->multiply_transpose(x, y);
+  }
+private:
+  MatrixBase::SP_matrix d_A;
+};
+
+/// Residual norm of A*x - lambda*x
+double eigen_residual(MatrixBase::SP_matrix A, Vector &x, double lambda)
+{
+  Vector r(x.size(), 0.0);
+  A->multiply(x, r);
+  r.add_a_times_x(-lambda, x);
+  return r.norm(L2);
+}
+
+/*
+ *  The nonsymmetric tridiagonal matrix (-1-c, 2, -1+c) has the real
+ *  eigenvalues 2 - 2*sqrt(1-c^2)*cos(k*pi/(n+1)).  The three largest
+ *  are closely spaced, which makes the power method slow.
+ */
+int test_KrylovSchur_standard(int argc, char *argv[])
+{
+  int    n = 200;
+  double c = 0.01;
+  Matrix::SP_matrix A(new Matrix(n, n, 3));
+  for (int i = 0; i < n; ++i)
+  {
+    if (i > 0)     A->insert(i, i - 1, -1.0 - c);
+                   A->insert(i, i,      2.0);
+    if (i < n - 1) A->insert(i, i + 1, -1.0 + c);
+  }
+  A->assemble();
+  MatrixBase::SP_matrix S(new KSShell(A));
+
+  EigenSolver::SP_db db(new detran_utilities::InputDB("test_KrylovSchur"));
+  db->put<std::string>("eigen_solver_type",   "krylovschur");
+  db->put<double>("eigen_solver_tol",         1e-10);
+  db->put<int>("eigen_solver_maxit",          1000);
+  db->put<int>("eigen_solver_subspace_size",  30);
+  db->put<int>("eigen_number_values",         3);
+  db->put<int>("eigen_solver_monitor_level",  1);
+  EigenSolver::SP_solver solver = EigenSolverCreator::Create(db);
+  solver->set_operators(S);
+
+  Vector X(n, 0.0);
+  Vector X0(n, 1.0);
+  TEST(solver->solve(X, X0) == SUCCESS);
+  KrylovSchur &ks = *dynamic_cast<KrylovSchur*>(solver.bp());
+  TEST(ks.eigenvalues_real().size() == 3);
+  for (int k = 0; k < 3; ++k)
+  {
+    double ref = 2.0 - 2.0 * std::sqrt(1.0 - c * c) *
+                 std::cos((n - k) * 3.141592653589793 / (n + 1));
+    printf("%4i %20.12e %20.12e \n", k, ks.eigenvalues_real()[k], ref);
+    TEST(soft_equiv(ks.eigenvalues_real()[k], ref, 1.0e-9));
+    TEST(std::abs(ks.eigenvalues_imag()[k]) < 1.0e-12);
+    TEST(eigen_residual(A, *ks.eigenvector(k), ref) < 1.0e-8);
+  }
+  TEST(soft_equiv(solver->eigenvalue(), ks.eigenvalues_real()[0]));
+
+  // compare to the power method for the dominant value
+  PowerIteration power(1e-10, 100000);
+  power.set_operators(S);
+  power.set_monitor_level(0);
+  Vector Y(n, 0.0);
+  Vector Y0(n, 1.0);
+  power.solve(Y, Y0);
+  printf(" krylov-schur applications: %i, power iterations: %i \n",
+         ks.number_applications(), power.number_iterations());
+  TEST(soft_equiv(power.eigenvalue(), ks.eigenvalues_real()[0], 1.0e-6));
+  TEST(ks.number_applications() < power.number_iterations());
+  return 0;
+}
+
+/*
+ *  A diagonal matrix with a leading rotation block has the dominant
+ *  complex pair 50 +/- 20i, followed by 40, 39, ...
+ */
+int test_KrylovSchur_complex(int argc, char *argv[])
+{
+  int n = 40;
+  Matrix::SP_matrix A(new Matrix(n, n, 2));
+  A->insert(0, 0,  50.0);
+  A->insert(0, 1, -20.0);
+  A->insert(1, 0,  20.0);
+  A->insert(1, 1,  50.0);
+  for (int i = 2; i < n; ++i)
+    A->insert(i, i, 40.0 - (i - 2));
+  A->assemble();
+
+  KrylovSchur solver(1e-10, 100, 10, 3);
+  solver.set_operators(A);
+  solver.set_monitor_level(1);
+  Vector X(n, 0.0);
+  Vector X0(n, 1.0);
+  TEST(solver.solve(X, X0) == SUCCESS);
+  double ref_r[] = {50.0, 50.0, 40.0};
+  double ref_i[] = {20.0, -20.0, 0.0};
+  for (int k = 0; k < 3; ++k)
+  {
+    printf("%4i %20.12e %20.12e \n", k, solver.eigenvalues_real()[k],
+           solver.eigenvalues_imag()[k]);
+    TEST(soft_equiv(solver.eigenvalues_real()[k], ref_r[k], 1.0e-9));
+    TEST(std::abs(solver.eigenvalues_imag()[k] - ref_i[k]) < 1.0e-8);
+  }
+  // the real vector of 40 is the unit vector e_2
+  TEST(soft_equiv(std::abs((*solver.eigenvector(2))[2]), 1.0, 1.0e-9));
+  return 0;
+}
+
+/*
+ *  Solves Ax = e*B*x as in test_Davidson_general.
+ */
+int test_KrylovSchur_general(int argc, char *argv[])
+{
+  Matrix::SP_matrix M = test_matrix_2(10);
+  Matrix::SP_matrix F = test_matrix_3(10);
+  int n = M->number_columns();
+  Vector X (n, 1.0);
+  Vector X0(n, 1.0);
+
+  double ref_L = 1.243023126562274;
+  double ref_V[] =
+  { 1.000000000000000, 0.976684255089969, 0.930596388729471};
+
+  EigenSolver::SP_db db(new detran_utilities::InputDB("test_KrylovSchur"));
+  db->put<double>("linear_solver_atol", 1e-14);
+  db->put<double>("linear_solver_rtol", 1e-14);
+  db->put<int>("linear_solver_maxit",   1000);
+  db->put<int>("linear_solver_monitor_level", 0);
+  KrylovSchur solver(1e-10, 100, 20);
+  solver.set_operators(F, M, db);
+  solver.set_monitor_level(1);
+  TEST(solver.solve(X, X0) == SUCCESS);
+  X.scale(1.0/X[0]);
+  printf("%16.8f  %16.8f \n", solver.eigenvalue(), ref_L);
+  TEST(soft_equiv(solver.eigenvalue(), ref_L, 1.0e-8));
+  for (int i = 0; i < 3; ++i)
+  {
+    printf("%16.8f  %16.8f \n", X[i], ref_V[i]);
+    TEST(soft_equiv(X[i], ref_V[i], 1.0e-8));
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_KrylovSchur.cc
+//----------------------------------------------------------------------------//
@@ -13,7 +13,13 @@
         FUNC(test_GaussSeidel) \
         FUNC(test_SOR)         \
         FUNC(test_GMRES)       \
-        FUNC(test_PetscSolver)
+        FUNC(test_PetscSolver) \
+        FUNC(test_GMRES_CGS2)  \
+        FUNC(test_BiCGSTAB)    \
+        FUNC(test_Krylov_comparison) \
+        FUNC(test_Pipelined)         \
+        FUNC(test_GMRES_single)      \
+        FUNC(test_BlockGMRES)
 
 #include "utilities/TestDriver.hh"
 #include "callow/utils/Initialization.hh"
@@ -23,6 +29,11 @@
 #include "callow/solver/Jacobi.hh"
 #include "callow/solver/GaussSeidel.hh"
 #include "callow/solver/GMRES.hh"
+#include "callow/solver/BlockGMRES.hh"
+#include "callow/solver/CG.hh"
+#include "callow/solver/BiCGSTAB.hh"
+#include "callow/solver/PipelinedGMRES.hh"
+#include "callow/solver/PipelinedCG.hh"
 #ifdef CALLOW_ENABLE_PETSC
 #include "callow/solver/PetscSolver.hh"
 #endif
@@ -32,6 +43,9 @@
 #include "callow/preconditioner/PCIdentity.hh"
 //
 #include "callow/test/matrix_fixture.hh"
+#include "callow/test/matrixshell_fixture.hh"
+#include <cmath>
+#include <cstdio>
 #include <iostream>
 
 using namespace callow;
@@ -227,6 +241,455 @@ int test_GMRES(int argc, char *argv[])
   return 0;
 }
 
+int test_GMRES_CGS2(int argc, char *argv[])
+{
+  GMRES::SP_matrix A;
+  A = test_matrix_1(n);
+  Vector B(n, 1.0);
+  Preconditioner::SP_preconditioner pcilu0;
+  pcilu0 = new PCILU0(A);
+
+  // Solve with both schemes, without and with a preconditioner.  CGS2
+  // should reproduce the MGS solution in the same number of iterations.
+  const char *types[] = {"mgs", "cgs2"};
+  int iterations[2][2];
+  for (int t = 0; t < 2; ++t)
+  {
+    db = get_db();
+    db->put<std::string>("linear_solver_type", "gmres");
+    db->put<int>("linear_solver_maxit", 50);
+    db->put<int>("linear_solver_gmres_restart", 16);
+    db->put<std::string>("linear_solver_gmres_orthogonalization", types[t]);
+    solver = LinearSolverCreator::Create(db);
+    GMRES *gmres = dynamic_cast<GMRES*>(solver.bp());
+    TEST(gmres);
+    TEST(gmres->orthogonalization() == t);
+    solver->set_operators(A);
+    for (int p = 0; p < 2; ++p)
+    {
+      if (p) solver->set_preconditioner(pcilu0, GMRES::RIGHT);
+      Vector X(n, 0.0);
+      int status = solver->solve(B, X);
+      TEST(status == SUCCESS);
+      for (int i = 0; i < 20; ++i)
+      {
+        TEST(soft_equiv(X[i],  X_ref[i], 1e-9));
+      }
+      iterations[t][p] = solver->number_iterations();
+    }
+  }
+  TEST(std::abs(iterations[0][0] - iterations[1][0]) <= 1);
+  TEST(std::abs(iterations[0][1] - iterations[1][1]) <= 1);
+  return 0;
+}
+
+int test_BiCGSTAB(int argc, char *argv[])
+{
+  GMRES::SP_matrix A;
+  A = test_matrix_1(n);
+  Vector B(n, 1.0);
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "bicgstab");
+  db->put<int>("linear_solver_maxit", 50);
+  solver = LinearSolverCreator::Create(db);
+  TEST(dynamic_cast<BiCGSTAB*>(solver.bp()));
+  solver->set_operators(A);
+
+  Preconditioner::SP_preconditioner pcilu0;
+  pcilu0 = new PCILU0(A);
+
+  // no pc, then ILU(0) on the left and on the right
+  for (int p = 0; p < 3; ++p)
+  {
+    if (p == 1) solver->set_preconditioner(pcilu0, LinearSolver::LEFT);
+    if (p == 2) solver->set_preconditioner(pcilu0, LinearSolver::RIGHT);
+    Vector X(n, 0.0);
+    int status = solver->solve(B, X);
+    TEST(status == SUCCESS);
+    for (int i = 0; i < 20; ++i)
+    {
+      TEST(soft_equiv(X[i],  X_ref[i], 1e-9));
+    }
+  }
+  return 0;
+}
+
+/**
+ *  A 5-point operator on an nx by ny grid.  With c = 0, it is the
+ *  (symmetric positive definite) diffusion operator, while c > 0 adds a
+ *  convection term that makes it nonsymmetric.
+ */
+Matrix::SP_matrix grid_matrix(const int nx, const int ny, const double c)
+{
+  int n = nx * ny;
+  Matrix::SP_matrix A(new Matrix(n, n, 5));
+  for (int j = 0; j < ny; ++j)
+  {
+    for (int i = 0; i < nx; ++i)
+    {
+      int row = i + j * nx;
+      if (i > 0)      A->insert(row, row - 1,  -1.0 - c);
+      if (i < nx - 1) A->insert(row, row + 1,  -1.0 + c);
+      if (j > 0)      A->insert(row, row - nx, -1.0 - 0.5 * c);
+      if (j < ny - 1) A->insert(row, row + nx, -1.0 + 0.5 * c);
+      A->insert(row, row, 4.01);
+    }
+  }
+  A->assemble();
+  return A;
+}
+
+/// Solve A x = b with the given solver type and pc, returning iterations.
+/// The pc is built from the db but only applied if enabled.
+int krylov_solve(Matrix::SP_matrix A, Vector &b, Vector &x,
+                 const std::string &type, const std::string &pc,
+                 const bool enable = true)
+{
+  db = get_db();
+  db->put<std::string>("linear_solver_type", type);
+  db->put<int>("linear_solver_maxit", 2000);
+  db->put<int>("linear_solver_monitor_level", 0);
+  db->put<double>("linear_solver_atol", 0.0);
+  db->put<double>("linear_solver_rtol", 1e-10);
+  db->put<int>("linear_solver_gmres_restart", 20);
+  db->put<std::string>("pc_type", pc);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A, db);
+  if (enable)
+    solver->set_preconditioner(solver->preconditioner(), LinearSolver::RIGHT);
+  x.set(0.0);
+  int status = solver->solve(b, x);
+  if (status != SUCCESS) return -1;
+  // check the true residual, since CG and BiCGSTAB monitor a recursive one
+  Vector r(b.size(), 0.0);
+  A->multiply(x, r);
+  if (r.norm_residual(b, L2) > 1e-8 * b.norm(L2)) return -1;
+  return solver->number_iterations();
+}
+
+int test_Krylov_comparison(int argc, char *argv[])
+{
+  // Compare GMRES(20), CG, and BiCGSTAB on a symmetric diffusion operator
+  // and on a nonsymmetric convection-diffusion operator.  All must reach
+  // the same solution; CG applies only to the symmetric case.
+  const char *types[] = {"gmres", "cg", "bicgstab"};
+  const char *pcs[]   = {"", "jacobi", "ilu0"};
+  int nx = 40;
+  Vector B(nx * nx, 1.0);
+  printf("  operator   pc          gmres       cg bicgstab\n");
+  for (int c = 0; c < 2; ++c)
+  {
+    Matrix::SP_matrix A = grid_matrix(nx, nx, 0.3 * c);
+    for (int p = 0; p < 3; ++p)
+    {
+      int iterations[3];
+      Vector X[3];
+      for (int t = 0; t < 3; ++t)
+      {
+        X[t].resize(nx * nx, 0.0);
+        iterations[t] = -1;
+        if (c && t == 1) continue;
+        iterations[t] = krylov_solve(A, B, X[t], types[t], pcs[p]);
+        TEST(iterations[t] > 0);
+      }
+      printf("  %-10s %-10s %8i %8i %8i\n", c ? "nonsym" : "sym",
+             p ? pcs[p] : "none", iterations[0], iterations[1], iterations[2]);
+      for (int i = 0; i < nx * nx; ++i)
+      {
+        if (!c) TEST(soft_equiv(X[1][i], X[0][i], 1e-7));
+        TEST(soft_equiv(X[2][i], X[0][i], 1e-7));
+      }
+      // Short recurrences avoid the stagnation that restarting causes.
+      if (!c) TEST(iterations[1] <= iterations[0]);
+      TEST(iterations[2] <= iterations[0]);
+      // A preconditioner that was built but never set is not applied.
+      if (!c && p)
+      {
+        Vector Y(nx * nx, 0.0);
+        TEST(krylov_solve(A, B, Y, "cg", pcs[p], false) ==
+             krylov_solve(A, B, Y, "cg", ""));
+      }
+    }
+  }
+  return 0;
+}
+
+int test_Pipelined(int argc, char *argv[])
+{
+  // The pipelined variants must reproduce the solutions of GMRES(20) and
+  // CG in (nearly) as many iterations.
+  const char *types[] = {"gmres", "pgmres", "cg", "pipecg"};
+  const char *pcs[]   = {"", "ilu0"};
+  int nx = 40;
+  Vector B(nx * nx, 1.0);
+  printf("  operator   pc          gmres   pgmres       cg   pipecg\n");
+  for (int c = 0; c < 2; ++c)
+  {
+    Matrix::SP_matrix A = grid_matrix(nx, nx, 0.3 * c);
+    for (int p = 0; p < 2; ++p)
+    {
+      int iterations[4];
+      Vector X[4];
+      for (int t = 0; t < 4; ++t)
+      {
+        X[t].resize(nx * nx, 0.0);
+        iterations[t] = -1;
+        if (c && t > 1) continue;
+        iterations[t] = krylov_solve(A, B, X[t], types[t], pcs[p]);
+        TEST(iterations[t] > 0);
+      }
+      printf("  %-10s %-10s %8i %8i %8i %8i\n", c ? "nonsym" : "sym",
+             p ? pcs[p] : "none", iterations[0], iterations[1],
+             iterations[2], iterations[3]);
+      for (int t = 1; t < 4; ++t)
+      {
+        if (iterations[t] < 0) continue;
+        for (int i = 0; i < nx * nx; ++i)
+          TEST(soft_equiv(X[t][i], X[0][i], 1e-7));
+      }
+      TEST(iterations[1] <= iterations[0] + 2);
+      if (!c) TEST(iterations[3] <= iterations[2] + 2);
+      // A preconditioner that was built but never set is not applied.
+      if (!c && p)
+      {
+        Vector Y(nx * nx, 0.0);
+        TEST(krylov_solve(A, B, Y, "pipecg", pcs[p], false) ==
+             krylov_solve(A, B, Y, "pipecg", ""));
+      }
+    }
+  }
+
+  // A shell operator, as used for transport sweeps
+  MatrixShell::SP_matrix S(new TestMatrixShell(n));
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "pgmres");
+  db->put<int>("linear_solver_maxit", 50);
+  db->put<int>("linear_solver_gmres_restart", 16);
+  solver = LinearSolverCreator::Create(db);
+  TEST(dynamic_cast<PipelinedGMRES*>(solver.bp()));
+  solver->set_operators(S);
+  Vector X(n, 0.0);
+  Vector b(n, 1.0);
+  int status = solver->solve(b, X);
+  TEST(status == SUCCESS);
+  for (int i = 0; i < 20; ++i)
+  {
+    TEST(soft_equiv(X[i],  X_ref[i], 1e-9));
+  }
+  return 0;
+}
+
+int test_GMRES_single(int argc, char *argv[])
+{
+  GMRES::SP_matrix A;
+  A = test_matrix_1(n);
+  Vector B(n, 1.0);
+  Preconditioner::SP_preconditioner pcilu0;
+  pcilu0 = new PCILU0(A);
+
+  // The basis in single precision must reach the same tolerance as in
+  // double, without and with a preconditioner on either side.
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<int>("linear_solver_maxit", 100);
+  db->put<int>("linear_solver_gmres_restart", 16);
+  db->put<std::string>("linear_solver_gmres_basis_precision", "single");
+  solver = LinearSolverCreator::Create(db);
+  GMRES *gmres = dynamic_cast<GMRES*>(solver.bp());
+  TEST(gmres);
+  TEST(gmres->basis_precision() == KrylovBasis::SINGLE);
+  solver->set_operators(A);
+  for (int p = 0; p < 3; ++p)
+  {
+    if (p == 1) solver->set_preconditioner(pcilu0, LinearSolver::LEFT);
+    if (p == 2) solver->set_preconditioner(pcilu0, LinearSolver::RIGHT);
+    Vector X(n, 0.0);
+    int status = solver->solve(B, X);
+    TEST(status == SUCCESS);
+    for (int i = 0; i < 20; ++i)
+    {
+      TEST(soft_equiv(X[i],  X_ref[i], 1e-9));
+    }
+  }
+
+  // Larger problems, with the restart a single precision basis allows
+  // for the memory of the double precision one
+  const char *precisions[] = {"double", "single"};
+  const int restarts[] = {20, 20, 41};
+  int nx = 40;
+  Vector b(nx * nx, 1.0);
+  printf("  operator   basis    restart iterations    memory (kB)\n");
+  for (int c = 0; c < 2; ++c)
+  {
+    Matrix::SP_matrix G = grid_matrix(nx, nx, 0.3 * c);
+    Vector X_double(nx * nx, 0.0);
+    int iterations_double = 0;
+    for (int t = 0; t < 3; ++t)
+    {
+      int p = t ? 1 : 0;
+      db = get_db();
+      db->put<std::string>("linear_solver_type", "gmres");
+      db->put<int>("linear_solver_maxit", 2000);
+      db->put<int>("linear_solver_monitor_level", 0);
+      db->put<double>("linear_solver_atol", 0.0);
+      db->put<double>("linear_solver_rtol", 1e-10);
+      db->put<int>("linear_solver_gmres_restart", restarts[t]);
+      db->put<std::string>("linear_solver_gmres_basis_precision",
+                           precisions[p]);
+      solver = LinearSolverCreator::Create(db);
+      solver->set_operators(G);
+      Vector X(nx * nx, 0.0);
+      int status = solver->solve(b, X);
+      TEST(status == SUCCESS);
+      // the true residual meets the tolerance
+      Vector r(nx * nx, 0.0);
+      G->multiply(X, r);
+      TEST(r.norm_residual(b, L2) <= 1e-10 * b.norm(L2));
+      if (t == 0)
+      {
+        X_double.copy(X);
+        iterations_double = solver->number_iterations();
+      }
+      // rounding the basis costs (almost) no iterations
+      if (t == 1) TEST(solver->number_iterations() <= iterations_double + 2);
+      for (int i = 0; i < nx * nx; ++i)
+        TEST(soft_equiv(X[i], X_double[i], 1e-8));
+      std::size_t bytes =
+        dynamic_cast<GMRES*>(solver.bp())->basis_bytes(nx * nx);
+      printf("  %-10s %-8s %7i %10i %14.1f\n", c ? "nonsym" : "sym",
+             precisions[p], restarts[t], solver->number_iterations(),
+             bytes / 1.0e3);
+    }
+  }
+
+  // The threaded inner products against a single precision basis are
+  // combined in a fixed order, so they repeat exactly.
+  {
+    int nb = 3 * Vector::OMP_MINIMUM_SIZE + 7;
+    int m  = Vector::MULTI_BLOCK + 3;
+    KrylovBasis basis(m, nb, KrylovBasis::SINGLE);
+    Vector x(nb, 0.0);
+    Vector w(nb, 0.0);
+    for (int j = 0; j < m; ++j)
+    {
+      for (int i = 0; i < nb; ++i)
+        x[i] = std::cos(0.01 * i * (j + 1));
+      basis.set(j, x);
+    }
+    for (int i = 0; i < nb; ++i)
+      w[i] = std::sin(0.1 * i);
+    std::vector<double> d(m, 0.0);
+    basis.dot(m, w, &d[0]);
+    for (int r = 0; r < 100; ++r)
+    {
+      std::vector<double> d_again(m, 0.0);
+      basis.dot(m, w, &d_again[0]);
+      for (int j = 0; j < m; ++j)
+        TEST(d_again[j] == d[j]);
+    }
+  }
+  return 0;
+}
+
+int test_BlockGMRES(int argc, char *argv[])
+{
+  // A single right hand side, without and with a preconditioner
+  LinearSolver::SP_matrix A = test_matrix_1(n);
+  Vector B(n, 1.0);
+  Preconditioner::SP_preconditioner pcilu0;
+  pcilu0 = new PCILU0(A);
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "bgmres");
+  db->put<int>("linear_solver_maxit", 100);
+  db->put<int>("linear_solver_gmres_restart", 16);
+  solver = LinearSolverCreator::Create(db);
+  TEST(dynamic_cast<BlockGMRES*>(solver.bp()));
+  solver->set_operators(A);
+  for (int p = 0; p < 3; ++p)
+  {
+    if (p == 1) solver->set_preconditioner(pcilu0, LinearSolver::LEFT);
+    if (p == 2) solver->set_preconditioner(pcilu0, LinearSolver::RIGHT);
+    Vector X(n, 0.0);
+    int status = solver->solve(B, X);
+    TEST(status == SUCCESS);
+    for (int i = 0; i < 20; ++i)
+    {
+      TEST(soft_equiv(X[i],  X_ref[i], 1e-9));
+    }
+  }
+
+  // Several right hand sides solved together must match the solutions
+  // found one at a time, including a repeated right hand side, which
+  // makes the block Krylov basis rank deficient.
+  int nx = 40;
+  int nb = 5;
+  std::vector<Vector::SP_vector> Bs(nb), Xs(nb);
+  for (int s = 0; s < nb; ++s)
+  {
+    Bs[s] = new Vector(nx * nx, 0.0);
+    Xs[s] = new Vector(nx * nx, 0.0);
+  }
+  Bs[0]->set(1.0);
+  for (int i = 0; i < nx * nx; ++i)
+    (*Bs[1])[i] = std::sin(0.1 * i);
+  (*Bs[2])[nx * nx / 2 + nx / 2] = 20.0;
+  (*Bs[3])[7] = 20.0;
+  Bs[4]->copy(*Bs[0]);
+  printf("  operator   pc         gmres  applications   bgmres  applications\n");
+  for (int c = 0; c < 2; ++c)
+  {
+    Matrix::SP_matrix G = grid_matrix(nx, nx, 0.3 * c);
+    for (int p = 0; p < 2; ++p)
+    {
+      std::string pc = p ? "ilu0" : "";
+      int applications = 0;
+      int iterations = 0;
+      std::vector<Vector> X(nb);
+      for (int s = 0; s < nb; ++s)
+      {
+        X[s].resize(nx * nx, 0.0);
+        int it = krylov_solve(G, *Bs[s], X[s], "gmres", pc);
+        TEST(it > 0);
+        applications += it;
+        iterations = std::max(iterations, it);
+      }
+
+      db = get_db();
+      db->put<std::string>("linear_solver_type", "bgmres");
+      db->put<int>("linear_solver_maxit", 2000);
+      db->put<int>("linear_solver_monitor_level", 0);
+      db->put<double>("linear_solver_atol", 0.0);
+      db->put<double>("linear_solver_rtol", 1e-10);
+      db->put<int>("linear_solver_gmres_restart", 20);
+      db->put<std::string>("pc_type", pc);
+      solver = LinearSolverCreator::Create(db);
+      solver->set_operators(G, db);
+      solver->set_preconditioner(solver->preconditioner(),
+                                 LinearSolver::RIGHT);
+      BlockGMRES *bgmres = dynamic_cast<BlockGMRES*>(solver.bp());
+      for (int s = 0; s < nb; ++s)
+        Xs[s]->set(0.0);
+      int status = bgmres->solve_block(Bs, Xs);
+      TEST(status == SUCCESS);
+      for (int s = 0; s < nb; ++s)
+      {
+        Vector r(nx * nx, 0.0);
+        G->multiply(*Xs[s], r);
+        TEST(r.norm_residual(*Bs[s], L2) <= 1e-8 * Bs[s]->norm(L2));
+        TEST(Xs[s]->norm_residual(X[s], L2) <= 1e-6 * X[s].norm(L2));
+      }
+      printf("  %-10s %-10s %5i %13i %8i %13i\n", c ? "nonsym" : "sym",
+             p ? "ilu0" : "none", iterations, applications,
+             bgmres->number_iterations(), nb * bgmres->number_iterations());
+      // with a good preconditioner, the shared subspace needs fewer block
+      // steps than the hardest single system needs steps.  without one,
+      // restarts can discard that advantage.
+      if (p) TEST(bgmres->number_iterations() <= iterations);
+    }
+  }
+  return 0;
+}
+
 int test_PetscSolver(int argc, char *argv[])
 {
 #ifdef CALLOW_ENABLE_PETSC
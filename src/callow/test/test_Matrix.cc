@@ -10,6 +10,8 @@
 #define TEST_LIST             \
         FUNC(test_Matrix)     \
         FUNC(test_MatrixDiff) \
+        FUNC(test_MatrixAssembly) \
+        FUNC(test_MatrixTranspose)
 
 #include "TestDriver.hh"
 #include "matrix_fixture.hh"
@@ -234,6 +236,133 @@ int test_MatrixDiff(int argc, char *argv[])
   return 0;
 }
 
+// Test of repeated entries, batched triplets, and refilling a pattern
+int test_MatrixAssembly(int argc, char *argv[])
+{
+  int n = 4;
+  Matrix A(n, n, 2);
+
+  // Many repeated ADDs fit in a row of two, since repeats get merged.
+  for (int k = 0; k < 10; ++k)
+  {
+    TEST(A.insert(0, 0, 1.0, Matrix::ADD));
+    TEST(A.insert(0, 3, 0.5, Matrix::ADD));
+  }
+  // A third distinct column does not.
+  TEST(!A.insert(0, 1, 1.0, Matrix::ADD));
+
+  // Batched triplets, several per row and out of column order.
+  {
+    int    i[] = {1,   1,   1,   2,   3,   3};
+    int    j[] = {2,   1,   2,   2,   0,   3};
+    double v[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    TEST(A.insert(i, j, v, 6, Matrix::ADD));
+    // Row 2 has room for one more entry, but not for two.
+    int    ii[] = {2,   2};
+    int    jj[] = {0,   1};
+    TEST(!A.insert(ii, jj, v, 2));
+  }
+  A.assemble();
+  TEST(A.number_nonzeros() == 7);
+  TEST(soft_equiv(A(0, 0), 10.0));
+  TEST(soft_equiv(A(0, 3),  5.0));
+  TEST(soft_equiv(A(1, 1),  2.0));
+  TEST(soft_equiv(A(1, 2),  4.0));
+  TEST(soft_equiv(A(2, 2),  4.0));
+  TEST(soft_equiv(A(3, 0),  5.0));
+  TEST(soft_equiv(A(3, 3),  6.0));
+  for (int i = 0; i < n; ++i)
+  {
+    TEST(A.column(A.diagonal(i)) == i);
+    for (int p = A.start(i) + 1; p < A.end(i); ++p)
+      TEST(A.column(p - 1) < A.column(p));
+  }
+
+  // Refill the same pattern with new values.
+  int *columns = A.columns();
+  A.reset_values();
+  TEST(A.values_only());
+  TEST(A.insert(0, 0, 1.0));
+  TEST(A.insert(0, 0, 1.0, Matrix::ADD));
+  TEST(A.insert(1, 2, 3.0));
+  TEST(A.insert(3, 3, 4.0));
+  // Entries outside of the pattern are rejected.
+  TEST(!A.insert(2, 0, 1.0));
+  A.assemble();
+  TEST(!A.values_only());
+  TEST(A.columns() == columns);
+  TEST(A.number_nonzeros() == 7);
+  TEST(soft_equiv(A(0, 0), 2.0));
+  TEST(soft_equiv(A(0, 3), 0.0));
+  TEST(soft_equiv(A(1, 2), 3.0));
+  TEST(soft_equiv(A(3, 3), 4.0));
+
+  Vector x(n, 1.0);
+  Vector y(n, 0.0);
+  A.multiply(x, y);
+  TEST(soft_equiv(y[0], 2.0));
+  TEST(soft_equiv(y[1], 3.0));
+  TEST(soft_equiv(y[2], 0.0));
+  TEST(soft_equiv(y[3], 4.0));
+
+  // A large matrix assembles the same way with threads.
+  int m = 4 * Matrix::OMP_MINIMUM_ROWS;
+  Matrix B(m, m, 3);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int k = 0; k < 3; ++k)
+    {
+      if (i > 0)     TEST(B.insert(i, i - 1, -1.0, Matrix::ADD));
+      if (i < m - 1) TEST(B.insert(i, i + 1, -1.0, Matrix::ADD));
+      TEST(B.insert(i, i, 2.0, Matrix::ADD));
+    }
+  }
+  B.assemble();
+  TEST(B.number_nonzeros() == 3 * m - 2);
+  Vector xb(m, 1.0);
+  Vector yb(m, 0.0);
+  B.multiply(xb, yb);
+  TEST(soft_equiv(yb[0], 3.0));
+  TEST(soft_equiv(yb[m / 2], 0.0));
+  TEST(soft_equiv(yb[m - 1], 3.0));
+
+  return 0;
+}
+
+// Test of the threaded transpose product with varying team sizes
+int test_MatrixTranspose(int argc, char *argv[])
+{
+  // Lower bidiagonal matrix of ones, so A'*1 is 2 except for the last entry.
+  int m = 4 * Matrix::OMP_MINIMUM_ROWS;
+  Matrix A(m, m, 2);
+  for (int i = 0; i < m; ++i)
+  {
+    if (i > 0) A.insert(i, i - 1, 1.0);
+    A.insert(i, i, 1.0);
+  }
+  A.assemble();
+  Vector x(m, 1.0);
+  Vector y(m, 0.0);
+  A.multiply_transpose(x, y);
+  TEST(soft_equiv(y[0],     2.0));
+  TEST(soft_equiv(y[m / 2], 2.0));
+  TEST(soft_equiv(y[m - 1], 1.0));
+
+  // Called from within a parallel region, the product gets a smaller team,
+  // and partial sums left from the first product must not be added in.
+  y.set(0.0);
+  #pragma omp parallel
+  {
+    #pragma omp single
+    A.multiply_transpose(x, y);
+  }
+  for (int i = 0; i < m - 1; ++i)
+    TEST(soft_equiv(y[i], 2.0));
+  TEST(soft_equiv(y[m - 1], 1.0));
+
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_Matrix.cc
 //----------------------------------------------------------------------------//
@@ -0,0 +1,275 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_MatrixFormats.cc
+ *  @brief Test of MatrixSELL and MatrixBCSR
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                           \
+        FUNC(test_MatrixSELL)               \
+        FUNC(test_MatrixBCSR)               \
+        FUNC(test_MatrixFormat_solvers)     \
+        FUNC(test_MatrixFormat_benchmark)
+
+#include "TestDriver.hh"
+#include "matrix/MatrixSELL.hh"
+#include "matrix/MatrixBCSR.hh"
+#include "matrix/MatrixFormat.hh"
+#include "solver/LinearSolverCreator.hh"
+#include "solver/EigenSolverCreator.hh"
+#include "utils/Initialization.hh"
+#include "detran_config.hh"
+#include "utilities/Timer.hh"
+#include <cmath>
+#include <cstdio>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+using namespace callow;
+using namespace detran_test;
+using detran_utilities::soft_equiv;
+using detran_utilities::Timer;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/**
+ *  A multigroup diffusion-like operator on an nx by ny grid ordered by
+ *  group and then cell: a 5-point stencil within each group plus full
+ *  group-to-group coupling within each cell.  Boundary rows are shorter,
+ *  so the row lengths vary.
+ */
+Matrix::SP_matrix diffusion_matrix(const int nx, const int ny, const int ng)
+{
+  int nc = nx * ny;
+  int n  = nc * ng;
+  Matrix::SP_matrix A(new Matrix(n, n, 4 + ng));
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int j = 0; j < ny; ++j)
+    {
+      for (int i = 0; i < nx; ++i)
+      {
+        int cell = i + j * nx;
+        int row  = cell + g * nc;
+        if (i > 0)      A->insert(row, row - 1,  -1.0 - 0.1 * g);
+        if (i < nx - 1) A->insert(row, row + 1,  -1.1 - 0.1 * g);
+        if (j > 0)      A->insert(row, row - nx, -0.9 - 0.1 * g);
+        if (j < ny - 1) A->insert(row, row + nx, -1.2 - 0.1 * g);
+        for (int gp = 0; gp < ng; ++gp)
+        {
+          double v = (gp == g) ? 5.0 + 0.01 * cell : -0.1 / (1 + g + gp);
+          A->insert(row, cell + gp * nc, v);
+        }
+      }
+    }
+  }
+  A->assemble();
+  return A;
+}
+
+/// Are y and y_ref equal to within round off (relative to the largest entry)?
+bool same_vector(Vector &y, Vector &y_ref)
+{
+  double scale = y_ref.norm(LINF);
+  for (int i = 0; i < y.size(); ++i)
+    if (std::abs(y[i] - y_ref[i]) > 1e-12 * scale) return false;
+  return true;
+}
+
+/// Compare the products of B to those of the CSR matrix A
+bool same_products(Matrix &A, MatrixBase &B)
+{
+  int n = A.number_rows();
+  Vector x(n, 0.0), y_ref(n, 0.0), y(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    x[i] = std::sin(0.37 * i) + 1.0;
+  A.multiply(x, y_ref);
+  B.multiply(x, y);
+  if (!same_vector(y, y_ref)) return false;
+  A.multiply_transpose(x, y_ref);
+  B.multiply_transpose(x, y);
+  return same_vector(y, y_ref);
+}
+
+//----------------------------------------------------------------------------//
+int test_MatrixSELL(int argc, char *argv[])
+{
+  // The example in the class documentation
+  {
+    Matrix A(4, 4, 3);
+    A.insert(0, 0, 7.0); A.insert(0, 3, 2.0);
+    A.insert(1, 1, 2.0); A.insert(1, 3, 4.0);
+    A.insert(2, 0, 1.0);
+    A.insert(3, 0, 3.0); A.insert(3, 1, 8.0); A.insert(3, 3, 6.0);
+    A.assemble();
+    MatrixSELL B(A, 2, 4);
+    B.display();
+    TEST(B.number_chunks() == 2);
+    TEST(B.number_nonzeros() == A.number_nonzeros());
+    TEST(B.number_stored() == 10);
+    TEST(same_products(A, B));
+  }
+  // Small and large (threaded) operators, with a partial last chunk
+  int sizes[] = {5, 70};
+  for (int s = 0; s < 2; ++s)
+  {
+    Matrix::SP_matrix A = diffusion_matrix(sizes[s], sizes[s] + 1, 3);
+    for (int chunk = 1; chunk <= 16; chunk *= 4)
+    {
+      MatrixSELL B(*A, chunk, 16 * chunk);
+      TEST(B.number_stored() >= A->number_nonzeros());
+      TEST(same_products(*A, B));
+    }
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_MatrixBCSR(int argc, char *argv[])
+{
+  int ng = 3;
+  int sizes[] = {5, 70};
+  for (int s = 0; s < 2; ++s)
+  {
+    Matrix::SP_matrix A = diffusion_matrix(sizes[s], sizes[s] + 1, ng);
+    int nc = A->number_rows() / ng;
+
+    // Group blocks: each block holds the groups of one cell, so there is
+    // one block per stencil point.
+    MatrixBCSR B(*A, ng, true);
+    if (s == 0) B.display(true);
+    TEST(B.number_block_rows() == nc);
+    TEST(B.index(1, 2) == 1 + 2 * nc);
+    TEST(B.number_blocks() == nc * 5 - 2 * (sizes[s] + sizes[s] + 1));
+    TEST(same_products(*A, B));
+
+    // Contiguous blocks are valid for any divisor of the size.
+    MatrixBCSR C(*A, ng);
+    TEST(C.index(1, 2) == 5);
+    TEST(same_products(*A, C));
+    MatrixBCSR D(*A, 1);
+    TEST(D.number_blocks() == A->number_nonzeros());
+    TEST(same_products(*A, D));
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_MatrixFormat_solvers(int argc, char *argv[])
+{
+  int ng = 2;
+  Matrix::SP_matrix A = diffusion_matrix(8, 8, ng);
+  int n = A->number_rows();
+  Vector b(n, 1.0);
+  Vector x_ref(n, 0.0);
+
+  // Reference solution with CSR
+  LinearSolverCreator::SP_db db(new detran_utilities::InputDB());
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<double>("linear_solver_atol", 1e-12);
+  db->put<double>("linear_solver_rtol", 1e-12);
+  LinearSolver::SP_solver solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A);
+  solver->solve(b, x_ref);
+
+  const char *formats[] = {"sell", "bcsr"};
+  for (int f = 0; f < 2; ++f)
+  {
+    db->put<std::string>("linear_solver_matrix_format", formats[f]);
+    db->put<int>("linear_solver_matrix_block_size", ng);
+    db->put<int>("linear_solver_matrix_block_strided", 1);
+    solver = LinearSolverCreator::Create(db);
+    solver->set_operators(A, db);
+    Vector x(n, 0.0);
+    TEST(solver->solve(b, x) == SUCCESS);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(x[i], x_ref[i], 1e-9));
+  }
+
+  // Solvers that need L, D, and U reject other formats.
+  db->put<std::string>("linear_solver_type", "gauss-seidel");
+  bool caught = false;
+  try
+  {
+    solver = LinearSolverCreator::Create(db);
+  }
+  catch (...)
+  {
+    caught = true;
+  }
+  TEST(caught);
+
+  // Power iteration with both formats gives the same eigenvalue.
+  double lambda[3];
+  const char *eigen_formats[] = {"csr", "sell", "bcsr"};
+  for (int f = 0; f < 3; ++f)
+  {
+    EigenSolverCreator::SP_db edb(new detran_utilities::InputDB());
+    edb->put<std::string>("eigen_solver_type", "power");
+    edb->put<double>("eigen_solver_tol", 1e-10);
+    edb->put<int>("eigen_solver_maxit", 1000);
+    edb->put<std::string>("eigen_solver_matrix_format", eigen_formats[f]);
+    edb->put<int>("eigen_solver_matrix_block_size", ng);
+    EigenSolverCreator::SP_solver eigen = EigenSolverCreator::Create(edb);
+    eigen->set_operators(A);
+    Vector x(n, 1.0), x0(n, 1.0);
+    eigen->solve(x, x0);
+    lambda[f] = eigen->eigenvalue();
+  }
+  TEST(soft_equiv(lambda[1], lambda[0], 1e-9));
+  TEST(soft_equiv(lambda[2], lambda[0], 1e-9));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_MatrixFormat_benchmark(int argc, char *argv[])
+{
+  // Time the products of a 7-group operator on a 150 x 150 grid in each
+  // format.  Note, CSR multiply is only threaded within a parallel region.
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  int ng = 7;
+  Matrix::SP_matrix A = diffusion_matrix(150, 150, ng);
+  int n = A->number_rows();
+  MatrixBase::SP_matrix M[3];
+  M[0] = A;
+  M[1] = new MatrixSELL(*A);
+  M[2] = new MatrixBCSR(*A, ng, true);
+  const char *names[] = {"csr", "sell", "bcsr"};
+  Vector x(n, 1.0), y(n, 0.0);
+  int number_trials = 10;
+  printf(" threads = %i  n = %i  nnz = %i \n",
+         number_threads, n, A->number_nonzeros());
+  for (int f = 0; f < 3; ++f)
+  {
+    double t0 = Timer::wtime();
+    for (int t = 0; t < number_trials; ++t)
+      M[f]->multiply(x, y);
+    double time_multiply = Timer::wtime() - t0;
+    t0 = Timer::wtime();
+    for (int t = 0; t < number_trials; ++t)
+      M[f]->multiply_transpose(x, y);
+    double time_transpose = Timer::wtime() - t0;
+    printf("   %5s  multiply: %8.4f s  transpose: %8.4f s \n",
+           names[f], time_multiply, time_transpose);
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_MatrixFormats.cc
+//----------------------------------------------------------------------------//
@@ -1,28 +1,47 @@
 //----------------------------------*-C++-*-----------------------------------//
 /**
  *  @file  test_Preconditioners.cc
- *  @brief Test of Matrix class
+ *  @brief Test of preconditioners
  *  @note  Copyright(C) 2012-2013 Jeremy Roberts
  */
 //----------------------------------------------------------------------------//
 
 // LIST OF TEST FUNCTIONS
-#define TEST_LIST            \
-        FUNC(test_PCJacobi)  \
-        FUNC(test_PCILU0)
+#define TEST_LIST                   \
+        FUNC(test_PCJacobi)         \
+        FUNC(test_PCILU0)           \
+        FUNC(test_PCILU_exact)      \
+        FUNC(test_PCILUK)           \
+        FUNC(test_PCILU_levels)     \
+        FUNC(test_PCILU_benchmark)  \
+        FUNC(test_PCAMG)            \
+        FUNC(test_PCAMG_stalled)    \
+        FUNC(test_PCILU_fill)
 
 #include "TestDriver.hh"
 #include "preconditioner/PCJacobi.hh"
 #include "preconditioner/PCILU0.hh"
+#include "preconditioner/PCILUK.hh"
+#include "preconditioner/PCILUT.hh"
+#include "preconditioner/PCAMG.hh"
 
 #include "matrix_fixture.hh"
 #include "matrix/Matrix.hh"
+#include "solver/LinearSolverCreator.hh"
 #include "utils/Initialization.hh"
+#include "detran_config.hh"
+#include "utilities/Timer.hh"
+#include <cmath>
+#include <cstdio>
 #include <iostream>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace callow;
 using namespace detran_test;
 using detran_utilities::soft_equiv;
+using detran_utilities::Timer;
 using std::cout;
 using std::endl;
 
@@ -37,6 +56,66 @@ int main(int argc, char *argv[])
 // TEST DEFINITIONS
 //----------------------------------------------------------------------------//
 
+/**
+ *  A 5-point convection-diffusion operator on an nx by ny grid.  The
+ *  convection term c makes the operator nonsymmetric and, as it grows,
+ *  less diagonally dominant, which is where ILU(0) degrades.
+ */
+Matrix::SP_matrix grid_matrix(const int nx, const int ny, const double c)
+{
+  int n = nx * ny;
+  Matrix::SP_matrix A(new Matrix(n, n, 5));
+  for (int j = 0; j < ny; ++j)
+  {
+    for (int i = 0; i < nx; ++i)
+    {
+      int row = i + j * nx;
+      if (i > 0)      A->insert(row, row - 1,  -1.0 - c);
+      if (i < nx - 1) A->insert(row, row + 1,  -1.0 + c);
+      if (j > 0)      A->insert(row, row - nx, -1.0 - 0.5 * c);
+      if (j < ny - 1) A->insert(row, row + nx, -1.0 + 0.5 * c);
+      A->insert(row, row, 4.0 + 0.001 * row / n);
+    }
+  }
+  A->assemble();
+  return A;
+}
+
+/// Apply the factors of P with plain row-ordered substitution
+void natural_solve(PCILU &P, Vector &b, Vector &x)
+{
+  Matrix &LU = *P.factors();
+  int n = LU.number_rows();
+  Vector y(n, 0.0);
+  for (int i = 0; i < n; ++i)
+  {
+    y[i] = b[i];
+    for (int p = LU.start(i); p < LU.diagonal(i); ++p)
+      y[i] -= LU.values()[p] * y[LU.column(p)];
+  }
+  for (int i = n - 1; i >= 0; --i)
+  {
+    x[i] = y[i];
+    for (int p = LU.diagonal(i) + 1; p < LU.end(i); ++p)
+      x[i] -= LU.values()[p] * x[LU.column(p)];
+    x[i] /= LU.values()[LU.diagonal(i)];
+  }
+}
+
+/// Does P solve A x = b exactly (to round off)?
+bool is_exact(Matrix::SP_matrix A, Preconditioner &P)
+{
+  int n = A->number_rows();
+  Vector x_ref(n, 0.0), b(n, 0.0), x(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    x_ref[i] = 1.0 + std::sin(0.3 * i);
+  A->multiply(x_ref, b);
+  P.apply(b, x);
+  for (int i = 0; i < n; ++i)
+    if (!soft_equiv(x[i], x_ref[i], 1e-10)) return false;
+  return true;
+}
+
 //----------------------------------------------------------------------------//
 int test_PCJacobi(int argc, char *argv[])
 {
@@ -59,6 +138,293 @@ int test_PCILU0(int argc, char *argv[])
   return 0;
 }
 
+//----------------------------------------------------------------------------//
+int test_PCILU_exact(int argc, char *argv[])
+{
+  // ILU(0) of a tridiagonal matrix is its LU factorization.
+  {
+    Matrix::SP_matrix A = test_matrix_1(20);
+    PCILU0 P(A);
+    TEST(is_exact(A, P));
+    TEST(P.number_lower_levels() == 20);
+    TEST(P.number_upper_levels() == 20);
+  }
+  // With enough fill, ILU(k) and ILUT are exact for a 2-D operator, while
+  // ILU(0) is not.
+  {
+    int nx = 6, ny = 5;
+    Matrix::SP_matrix A = grid_matrix(nx, ny, 0.3);
+    PCILU0 P0(A);
+    TEST(!is_exact(A, P0));
+    PCILUK PK(A, nx * ny);
+    TEST(is_exact(A, PK));
+    PCILUT PT(A, 0.0, nx * ny);
+    TEST(is_exact(A, PT));
+    // Full LU fills the band of width nx.
+    TEST(PK.factors()->number_nonzeros() == PT.factors()->number_nonzeros());
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCILUK(int argc, char *argv[])
+{
+  Matrix::SP_matrix A = grid_matrix(10, 10, 0.3);
+
+  // ILU(0) by levels matches ILU(0) by pattern.
+  PCILU0 P0(A);
+  PCILUK PK0(A, 0);
+  Matrix &LU0 = *P0.factors();
+  Matrix &LUK = *PK0.factors();
+  TEST(LU0.number_nonzeros() == A->number_nonzeros());
+  TEST(LUK.number_nonzeros() == LU0.number_nonzeros());
+  for (int p = 0; p < LU0.number_nonzeros(); ++p)
+  {
+    TEST(LUK.column(p) == LU0.column(p));
+    TEST(soft_equiv(LUK.values()[p], LU0.values()[p], 1e-14));
+  }
+
+  // Fill grows with the level, and ILU(1) of a 5-point operator adds
+  // one diagonal to each of L and U.
+  PCILUK PK1(A, 1);
+  PCILUK PK2(A, 2);
+  TEST(PK1.factors()->number_nonzeros() == A->number_nonzeros() + 2 * 81);
+  TEST(PK2.factors()->number_nonzeros() > PK1.factors()->number_nonzeros());
+
+  // ILUT limits the fill per row.
+  PCILUT PT(A, 1e-6, 3);
+  for (int i = 0; i < A->number_rows(); ++i)
+  {
+    TEST(PT.factors()->diagonal(i) - PT.factors()->start(i) <= 3);
+    TEST(PT.factors()->end(i) - PT.factors()->diagonal(i) <= 4);
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCILU_levels(int argc, char *argv[])
+{
+  // The forward solve of a 5-point operator proceeds by anti-diagonals of
+  // the grid, so there are nx + ny - 1 levels.
+  int nx = 60, ny = 50;
+  Matrix::SP_matrix A = grid_matrix(nx, ny, 0.3);
+  PCILU0 P0(A);
+  TEST(P0.number_lower_levels() == nx + ny - 1);
+  TEST(P0.number_upper_levels() == nx + ny - 1);
+
+  // The scheduled solve, which is threaded for this size, does the same
+  // arithmetic as the natural order solve.
+  int n = nx * ny;
+  Vector b(n, 0.0), x(n, 0.0), x_ref(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    b[i] = std::cos(0.1 * i);
+  PCILU *P[] = {&P0, new PCILUK(A, 2), new PCILUT(A, 1e-3, 8)};
+  for (int k = 0; k < 3; ++k)
+  {
+    P[k]->apply(b, x);
+    natural_solve(*P[k], b, x_ref);
+    for (int i = 0; i < n; ++i)
+      TEST(x[i] == x_ref[i]);
+  }
+  delete P[1];
+  delete P[2];
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCILU_benchmark(int argc, char *argv[])
+{
+  // Compare setup time, apply time, and preconditioned GMRES iterations
+  // for the ILU variants on a strongly convective 200 x 200 operator.
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  int nx = 200;
+  Matrix::SP_matrix A = grid_matrix(nx, nx, 0.9);
+  int n = A->number_rows();
+  Vector b(n, 1.0), x(n, 0.0);
+  printf(" threads = %i  n = %i  nnz = %i \n",
+         number_threads, n, A->number_nonzeros());
+
+  const char *names[]  = {"none", "ilu0", "iluk", "iluk", "ilut"};
+  int         levels[] = {0, 0, 1, 2, 0};
+  int         iterations[5];
+  for (int k = 0; k < 5; ++k)
+  {
+    LinearSolverCreator::SP_db db(new detran_utilities::InputDB());
+    db->put<std::string>("linear_solver_type", "gmres");
+    db->put<double>("linear_solver_atol", 1e-10);
+    db->put<double>("linear_solver_rtol", 1e-10);
+    db->put<int>("linear_solver_maxit", 5000);
+    db->put<std::string>("pc_type", names[k]);
+    db->put<int>("pc_ilu_levels", levels[k]);
+    db->put<double>("pc_ilut_tolerance", 1e-3);
+    db->put<int>("pc_ilut_fill", 10);
+    LinearSolver::SP_solver solver = LinearSolverCreator::Create(db);
+
+    double t0 = Timer::wtime();
+    solver->set_operators(A, db);
+    solver->set_preconditioner(solver->preconditioner());
+    double time_setup = Timer::wtime() - t0;
+
+    double time_apply = 0.0;
+    int nnz = 0;
+    Preconditioner::SP_preconditioner P = solver->preconditioner();
+    if (P)
+    {
+      PCILU *ilu = dynamic_cast<PCILU*>(P.bp());
+      nnz = ilu->factors()->number_nonzeros();
+      t0 = Timer::wtime();
+      for (int t = 0; t < 10; ++t)
+        P->apply(b, x);
+      time_apply = (Timer::wtime() - t0) / 10.0;
+    }
+
+    x.set(0.0);
+    t0 = Timer::wtime();
+    TEST(solver->solve(b, x) == SUCCESS);
+    double time_solve = Timer::wtime() - t0;
+    iterations[k] = solver->number_iterations();
+    printf("   %4s(%i)  nnz: %8i  setup: %8.4f s  apply: %8.5f s  "
+           "iterations: %5i  solve: %8.4f s \n", names[k], levels[k], nnz,
+           time_setup, time_apply, iterations[k], time_solve);
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCAMG(int argc, char *argv[])
+{
+  // Preconditioned GMRES iterations on a diffusion operator should not
+  // grow with refinement for AMG, unlike for ILU(0).
+  int sizes[] = {32, 64, 128};
+  int iterations[3][2];
+  const char *names[] = {"amg", "ilu0"};
+  for (int s = 0; s < 3; ++s)
+  {
+    int nx = sizes[s];
+    Matrix::SP_matrix A = grid_matrix(nx, nx, 0.0);
+    int n = A->number_rows();
+
+    PCAMG P(A);
+    TEST(P.number_levels() > 2);
+    TEST(P.level_operator(P.number_levels() - 1)->number_rows() <= 100);
+    TEST(P.operator_complexity() < 2.0);
+    printf(" n = %6i  levels = %i  complexity = %6.3f \n",
+           n, P.number_levels(), P.operator_complexity());
+
+    for (int k = 0; k < 2; ++k)
+    {
+      LinearSolverCreator::SP_db db(new detran_utilities::InputDB());
+      db->put<std::string>("linear_solver_type", "gmres");
+      db->put<double>("linear_solver_atol", 1e-10);
+      db->put<double>("linear_solver_rtol", 1e-10);
+      db->put<int>("linear_solver_maxit", 2000);
+      db->put<std::string>("pc_type", names[k]);
+      LinearSolver::SP_solver solver = LinearSolverCreator::Create(db);
+      solver->set_operators(A, db);
+      solver->set_preconditioner(solver->preconditioner(),
+                                 LinearSolver::RIGHT);
+      Vector b(n, 1.0), x(n, 0.0);
+      TEST(solver->solve(b, x) == SUCCESS);
+      iterations[s][k] = solver->number_iterations();
+      // check the residual directly
+      Vector r(n, 0.0);
+      A->multiply(x, r);
+      r.subtract(b);
+      TEST(r.norm(L2) < 1e-8 * b.norm(L2));
+    }
+    printf("   iterations: amg = %4i  ilu0 = %4i \n",
+           iterations[s][0], iterations[s][1]);
+  }
+  TEST(iterations[2][0] <= iterations[0][0] + 4);
+  TEST(iterations[2][0] < iterations[2][1]);
+  TEST(iterations[2][1] > 2 * iterations[0][1]);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCAMG_stalled(int argc, char *argv[])
+{
+  // A large, diagonally dominant operator with no strong couplings
+  // yields only singleton aggregates, so coarsening stalls on A itself.
+  // That level is too large for dense LU and must be smoothed instead.
+  int n = 2 * PCAMG::MAX_DENSE_COARSE_SIZE;
+  Matrix::SP_matrix A(new Matrix(n, n, 3));
+  for (int i = 0; i < n; ++i)
+  {
+    if (i > 0)     A->insert(i, i - 1, -0.01);
+    if (i < n - 1) A->insert(i, i + 1, -0.02);
+    A->insert(i, i, 1.0 + 0.001 * i);
+  }
+  A->assemble();
+
+  PCAMG P(A);
+  TEST(P.number_levels() == 1);
+  TEST(!P.dense_coarse());
+
+  // The smoother sweeps alone nearly invert such an operator.
+  Vector x_ref(n, 0.0), b(n, 0.0), x(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    x_ref[i] = 1.0 + std::sin(0.3 * i);
+  A->multiply(x_ref, b);
+  P.apply(b, x);
+  x.subtract(x_ref);
+  TEST(x.norm(L2) < 1e-3 * x_ref.norm(L2));
+
+  LinearSolverCreator::SP_db db(new detran_utilities::InputDB());
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<double>("linear_solver_atol", 1e-12);
+  db->put<double>("linear_solver_rtol", 1e-12);
+  db->put<std::string>("pc_type", "amg");
+  LinearSolver::SP_solver solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A, db);
+  solver->set_preconditioner(solver->preconditioner(), LinearSolver::RIGHT);
+  x.set(0.0);
+  TEST(solver->solve(b, x) == SUCCESS);
+  TEST(solver->number_iterations() <= 3);
+  x.subtract(x_ref);
+  TEST(x.norm(L2) < 1e-10 * x_ref.norm(L2));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_PCILU_fill(int argc, char *argv[])
+{
+  // More fill gives fewer preconditioned GMRES iterations on a strongly
+  // convective operator.
+  Matrix::SP_matrix A = grid_matrix(60, 60, 0.9);
+  int n = A->number_rows();
+  const char *names[]  = {"none", "ilu0", "iluk", "iluk", "ilut"};
+  int         levels[] = {0, 0, 1, 2, 0};
+  int         iterations[5];
+  for (int k = 0; k < 5; ++k)
+  {
+    LinearSolverCreator::SP_db db(new detran_utilities::InputDB());
+    db->put<std::string>("linear_solver_type", "gmres");
+    db->put<double>("linear_solver_atol", 1e-10);
+    db->put<double>("linear_solver_rtol", 1e-10);
+    db->put<int>("linear_solver_maxit", 5000);
+    db->put<int>("linear_solver_monitor_level", 0);
+    db->put<std::string>("pc_type", names[k]);
+    db->put<int>("pc_ilu_levels", levels[k]);
+    db->put<double>("pc_ilut_tolerance", 1e-3);
+    db->put<int>("pc_ilut_fill", 10);
+    LinearSolver::SP_solver solver = LinearSolverCreator::Create(db);
+    solver->set_operators(A, db);
+    solver->set_preconditioner(solver->preconditioner());
+    Vector b(n, 1.0), x(n, 0.0);
+    TEST(solver->solve(b, x) == SUCCESS);
+    iterations[k] = solver->number_iterations();
+  }
+  TEST(iterations[1] < iterations[0]);
+  TEST(iterations[2] < iterations[1]);
+  TEST(iterations[3] < iterations[2]);
+  TEST(iterations[4] < iterations[1]);
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_Preconditioners.cc
 //----------------------------------------------------------------------------//
@@ -8,19 +8,29 @@
 //---------------------------------------------------------------------------//
 
 // LIST OF TEST FUNCTIONS
-#define TEST_LIST               \
-        FUNC(test_Vector)       \
-        FUNC(test_Vector_resize)
+#define TEST_LIST                 \
+        FUNC(test_Vector)         \
+        FUNC(test_Vector_resize)  \
+        FUNC(test_Vector_fused)   \
+        FUNC(test_Vector_benchmark)
 
 #include "TestDriver.hh"
 #include "callow/vector/Vector.hh"
 #include "callow/utils/Initialization.hh"
 #include "utilities/Definitions.hh"
+#include "utilities/Timer.hh"
+#include <cmath>
+#include <cstdio>
 #include <iostream>
+#include <vector>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace callow;
 using namespace detran_test;
 using detran_utilities::soft_equiv;
+using detran_utilities::Timer;
 using std::cout;
 using std::endl;
 
@@ -97,6 +107,138 @@ int test_Vector_resize(int argc, char *argv[])
   return 0;
 }
 
+// Test of the fused operations against their unfused equivalents
+int test_Vector_fused(int argc, char *argv[])
+{
+  // Long enough to be threaded, with a block count that is not a multiple
+  // of MULTI_BLOCK
+  int n = 3 * Vector::OMP_MINIMUM_SIZE + 7;
+  int k = Vector::MULTI_BLOCK + 3;
+  std::vector<Vector> x(k, Vector(n, 0.0));
+  Vector y(n, 0.0);
+  std::vector<double> a(k, 0.0);
+  for (int i = 0; i < n; ++i)
+  {
+    y[i] = std::sin(0.1 * i);
+    for (int j = 0; j < k; ++j)
+      x[j][i] = std::cos(0.01 * i * (j + 1));
+  }
+  for (int j = 0; j < k; ++j)
+    a[j] = 1.0 / (j + 1);
+
+  // multi-dot
+  std::vector<double> d(k, 0.0);
+  y.multi_dot(k, &x[0], &d[0]);
+  for (int j = 0; j < k; ++j)
+    TEST(soft_equiv(d[j], y.dot(x[j]), 1.0e-12));
+  // The threaded partial sums are combined in a fixed order.
+  for (int r = 0; r < 100; ++r)
+  {
+    std::vector<double> d_again(k, 0.0);
+    y.multi_dot(k, &x[0], &d_again[0]);
+    for (int j = 0; j < k; ++j)
+      TEST(d_again[j] == d[j]);
+  }
+
+  // multi-axpy
+  Vector z(y);
+  z.multi_add_a_times_x(k, &a[0], &x[0]);
+  Vector z_ref(y);
+  for (int j = 0; j < k; ++j)
+    z_ref.add_a_times_x(a[j], x[j]);
+  TEST(soft_equiv(z.norm_residual(z_ref, LINF), 0.0, 1.0e-12));
+
+  // axpy and norm
+  double norm = z.add_a_times_x_norm(-2.0, x[1]);
+  z_ref.add_a_times_x(-2.0, x[1]);
+  TEST(soft_equiv(norm, z_ref.norm(L2), 1.0e-12));
+  TEST(soft_equiv(z.norm_residual(z_ref, LINF), 0.0, 1.0e-12));
+
+  return 0;
+}
+
+// Compare the threaded and fused kernels to plain serial loops for one
+// classical Gram-Schmidt step: k dots, k axpy's, and a norm.
+int test_Vector_benchmark(int argc, char *argv[])
+{
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  int n = 1000000;
+  int k = 20;
+  int number_trials = 5;
+  std::vector<Vector> x(k, Vector(n, 0.0));
+  Vector y(n, 0.0);
+  for (int i = 0; i < n; ++i)
+  {
+    y[i] = std::sin(0.1 * i);
+    for (int j = 0; j < k; ++j)
+      x[j][i] = std::cos(0.01 * i * (j + 1)) / n;
+  }
+  std::vector<double> h(k, 0.0);
+
+  // serial loops, as the kernels were previously written
+  Vector z(y);
+  double t0 = Timer::wtime();
+  double norm_serial = 0.0;
+  for (int t = 0; t < number_trials; ++t)
+  {
+    z.copy(y);
+    for (int j = 0; j < k; ++j)
+    {
+      h[j] = 0.0;
+      for (int i = 0; i < n; ++i)
+        h[j] += z[i] * x[j][i];
+    }
+    for (int j = 0; j < k; ++j)
+      for (int i = 0; i < n; ++i)
+        z[i] -= h[j] * x[j][i];
+    norm_serial = 0.0;
+    for (int i = 0; i < n; ++i)
+      norm_serial += z[i] * z[i];
+    norm_serial = std::sqrt(norm_serial);
+  }
+  double time_serial = Timer::wtime() - t0;
+
+  // threaded kernels, one vector at a time
+  t0 = Timer::wtime();
+  double norm_threaded = 0.0;
+  for (int t = 0; t < number_trials; ++t)
+  {
+    z.copy(y);
+    for (int j = 0; j < k; ++j)
+      h[j] = z.dot(x[j]);
+    for (int j = 0; j < k; ++j)
+      z.add_a_times_x(-h[j], x[j]);
+    norm_threaded = z.norm(L2);
+  }
+  double time_threaded = Timer::wtime() - t0;
+
+  // fused kernels
+  t0 = Timer::wtime();
+  double norm_fused = 0.0;
+  for (int t = 0; t < number_trials; ++t)
+  {
+    z.copy(y);
+    z.multi_dot(k, &x[0], &h[0]);
+    for (int j = 0; j < k - 1; ++j)
+      h[j] = -h[j];
+    z.multi_add_a_times_x(k - 1, &h[0], &x[0]);
+    norm_fused = z.add_a_times_x_norm(-h[k - 1], x[k - 1]);
+  }
+  double time_fused = Timer::wtime() - t0;
+
+  TEST(soft_equiv(norm_threaded, norm_serial, 1.0e-10));
+  TEST(soft_equiv(norm_fused,    norm_serial, 1.0e-10));
+
+  printf(" threads = %i  n = %i  k = %i \n", number_threads, n, k);
+  printf("   serial loops:     %8.4f s \n", time_serial);
+  printf("   threaded kernels: %8.4f s \n", time_threaded);
+  printf("   fused kernels:    %8.4f s \n", time_fused);
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_Vector.cc
 //---------------------------------------------------------------------------//
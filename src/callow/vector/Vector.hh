@@ -20,12 +20,24 @@ namespace callow
 /**
  *  @class Vector
  *  @brief Dense vector object
+ *
+ *  When built with OpenMP, the BLAS-1 style operations open their own
+ *  parallel region for vectors longer than OMP_MINIMUM_SIZE.  Called
+ *  from within an existing parallel region, they run on the calling
+ *  thread as before.  The fused operations combine several sweeps over
+ *  memory into one, e.g. the dot products of a Gram-Schmidt step.
  */
 class CALLOW_EXPORT Vector
 {
 
 public:
 
+  /// Vectors no longer than this are not threaded
+  enum {OMP_MINIMUM_SIZE = 10000};
+
+  /// Number of vectors processed per pass by the multi-vector operations
+  enum {MULTI_BLOCK = 8};
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -124,6 +136,39 @@ public:
   void add_a_times_x(const double a, const Vector& x);
   void add_a_times_x(const double a, SP_vector x);
 
+  //-------------------------------------------------------------------------//
+  // FUSED OPERATIONS
+  //-------------------------------------------------------------------------//
+
+  /// Add a vector x times a scalar a to this vector and return the L2 norm
+  double add_a_times_x_norm(const double a, const Vector& x);
+  /**
+   *  @brief Inner products of this vector with several vectors
+   *
+   *  Computes d[j] = (this, x[j]) for j < k in one pass over this vector.
+   *
+   *  @param k  number of vectors
+   *  @param x  array of k vectors, e.g. the first k in a std::vector
+   *  @param d  array of k inner products
+   */
+  void multi_dot(const int k, const Vector *x, double *d);
+  /// Inner products with k vectors stored one after another in X
+  void multi_dot(const int k, const double *X, double *d);
+  /// Inner products with k vectors given by pointers to their values
+  void multi_dot(const int k, const double * const *x, double *d);
+  /**
+   *  @brief Add a linear combination of several vectors to this vector
+   *
+   *  Computes this += sum_j a[j] * x[j] for j < k.
+   *
+   *  @param k  number of vectors
+   *  @param a  array of k coefficients
+   *  @param x  array of k vectors
+   */
+  void multi_add_a_times_x(const int k, const double *a, const Vector *x);
+  /// Add a linear combination of k vectors stored one after another in X
+  void multi_add_a_times_x(const int k, const double *a, const double *X);
+
   //-------------------------------------------------------------------------//
   // QUERY
   //-------------------------------------------------------------------------//
@@ -158,6 +203,17 @@ protected:
   // Is this also temporary around an extant PETSC vector?
   bool d_temporary_petsc;
 
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Inner products with at most MULTI_BLOCK vectors in one pass
+  void multi_dot_block(const int nj, const double * const *x, double *d);
+  /// Add a linear combination of at most MULTI_BLOCK vectors in one pass
+  void multi_add_a_times_x_block(const int             nj,
+                                 const double         *a,
+                                 const double * const *x);
+
 };
 
 CALLOW_TEMPLATE_EXPORT(detran_utilities::SP<Vector>);
@@ -11,9 +11,14 @@
 #define callow_VECTOR_I_HH_
 
 #include "utilities/DBC.hh"
+#include <algorithm>
 #include <cmath>
 #include <stdio.h>
 #include <iostream>
+#include <vector>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace callow
 {
@@ -82,21 +87,26 @@ inline double Vector::norm(const int type)
   else
     THROW("Unsupported norm type");
 #else
+  const double *v = d_value;
+  const int     n = d_size;
   if (type == L1 || type == L1GRID)
   {
-    for (int i = 0; i < d_size; i++)
-      val += std::abs(d_value[i]);
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += std::abs(v[i]);
   }
   else if (type == L2 || type == L2GRID)
   {
-    for (int i = 0; i < d_size; i++)
-      val += d_value[i] * d_value[i];
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += v[i] * v[i];
     val = std::sqrt(val);
   }
   else if (type == LINF)
   {
-    for (int i = 0; i < d_size; i++)
-      val = std::max(val, std::abs(d_value[i]));
+    #pragma omp parallel for reduction(max:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val = std::max(val, std::abs(v[i]));
   }
 #endif
   // divide by N or sqrt(N) for the grid norms
@@ -117,39 +127,48 @@ inline double Vector::norm_residual(const Vector& x, const int type)
   // and take its norm
   val = tmp.norm(type);
 #else
+  const double *v  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
   // basic norms
   if (type == L1)
   {
-    for (int i = 0; i < d_size; i++)
-      val += std::abs(d_value[i] - x[i]);
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += std::abs(v[i] - xv[i]);
   }
   else if (type == L2)
   {
-    for (int i = 0; i < d_size; i++)
-      val += (d_value[i] - x[i])*(d_value[i] - x[i]);
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += (v[i] - xv[i])*(v[i] - xv[i]);
     val = std::sqrt(val);
   }
   else if (type == LINF)
   {
-    for (int i = 0; i < d_size; i++)
-      val = std::max(val, std::abs(d_value[i] - x[i]));
+    #pragma omp parallel for reduction(max:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val = std::max(val, std::abs(v[i] - xv[i]));
   }
   // relative norms
   else if (type == L1REL)
   {
-    for (int i = 0; i < d_size; i++)
-      val += std::abs((d_value[i] - x[i])/d_value[i]);
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += std::abs((v[i] - xv[i])/v[i]);
   }
   else if (type == L2REL)
   {
-    for (int i = 0; i < d_size; i++)
-      val += ((d_value[i] - x[i])/d_value[i])*((d_value[i] - x[i])/d_value[i]);
+    #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val += ((v[i] - xv[i])/v[i])*((v[i] - xv[i])/v[i]);
     val = std::sqrt(val);
   }
   else if (type == LINFREL)
   {
-    for (int i = 0; i < d_size; i++)
-      val = std::max(val, std::abs(d_value[i] - x[i]));
+    #pragma omp parallel for reduction(max:val) if (n > OMP_MINIMUM_SIZE)
+    for (int i = 0; i < n; i++)
+      val = std::max(val, std::abs(v[i] - xv[i]));
   }
   else
     THROW("Unsupported norm residual type");
@@ -169,8 +188,11 @@ inline void Vector::set(const double v)
 #ifdef CALLOW_ENABLE_PETSC_OPS2
   VecSet(d_petsc_vector, v);
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] = v;
+  double   *y = d_value;
+  const int n = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] = v;
 #endif
 }
 
@@ -180,8 +202,11 @@ inline void Vector::scale(const double v)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecScale(d_petsc_vector, v);
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] *= v;
+  double   *y = d_value;
+  const int n = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] *= v;
 #endif
 }
 
@@ -193,8 +218,12 @@ inline double Vector::dot(const Vector& x)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecDot(d_petsc_vector, const_cast<Vector* >(&x)->petsc_vector(), &val);
 #else
-  for (int i = 0; i < d_size; i++)
-    val += d_value[i] * x[i];
+  const double *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    val += y[i] * xv[i];
 #endif
   return val;
 }
@@ -212,8 +241,12 @@ inline void Vector::add(const Vector &x)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecAXPY(d_petsc_vector, 1.0, const_cast<Vector* >(&x)->petsc_vector());
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] += x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] += xv[i];
 #endif
 }
 
@@ -230,8 +263,12 @@ inline void Vector::add_a_times_x(const double a, const Vector& x)
 #ifdef CALLOW_ENABLE_PETSC_OPS2
   VecAXPY(d_petsc_vector, a, const_cast<Vector* >(&x)->petsc_vector());
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] += a*x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] += a*xv[i];
 #endif
 }
 
@@ -248,8 +285,12 @@ inline void Vector::subtract(const Vector &x)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecAXPY(d_petsc_vector, -1.0, const_cast<Vector* >(&x)->petsc_vector());
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] -= x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] -= xv[i];
 #endif
 }
 
@@ -267,8 +308,12 @@ inline void Vector::multiply(const Vector &x)
   Vector tmp(*this);
   VecPointwiseMult(d_petsc_vector, tmp.petsc_vector(), const_cast<Vector* >(&x)->petsc_vector());
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] *= x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] *= xv[i];
 #endif
 }
 
@@ -286,8 +331,12 @@ inline void Vector::divide(const Vector &x)
   Vector tmp(*this);
   VecPointwiseDivide(d_petsc_vector, tmp.petsc_vector(), const_cast<Vector* >(&x)->petsc_vector());
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] /= x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] /= xv[i];
 #endif
 }
 
@@ -304,8 +353,12 @@ inline void Vector::copy(const Vector &x)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecCopy(const_cast<Vector* >(&x)->petsc_vector(), d_petsc_vector);
 #else
-  for (int i = 0; i < d_size; i++)
-    d_value[i] = x[i];
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+    y[i] = xv[i];
 #endif
 }
 
@@ -315,6 +368,183 @@ inline void Vector::copy(SP_vector x)
   copy(*x);
 }
 
+//---------------------------------------------------------------------------//
+// FUSED OPERATIONS
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+inline double Vector::add_a_times_x_norm(const double a, const Vector& x)
+{
+  Require(x.size() == d_size);
+  double val = 0.0;
+  double       *y  = d_value;
+  const double *xv = x.d_value;
+  const int     n  = d_size;
+  #pragma omp parallel for reduction(+:val) if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; i++)
+  {
+    y[i] += a*xv[i];
+    val += y[i]*y[i];
+  }
+  return std::sqrt(val);
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_dot(const int k, const Vector *x, double *d)
+{
+  Require(k >= 0);
+  Require(!k || x);
+  Require(!k || d);
+  const double *columns[MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+    {
+      Require(x[j0 + j].size() == d_size);
+      columns[j] = x[j0 + j].d_value;
+    }
+    multi_dot_block(nj, columns, d + j0);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_dot(const int k, const double *X, double *d)
+{
+  Require(k >= 0);
+  Require(!k || X);
+  Require(!k || d);
+  const double *columns[MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+      columns[j] = X + (j0 + j) * d_size;
+    multi_dot_block(nj, columns, d + j0);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_dot(const int             k,
+                              const double * const *x,
+                              double               *d)
+{
+  Require(k >= 0);
+  Require(!k || x);
+  Require(!k || d);
+  for (int j0 = 0; j0 < k; j0 += MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)MULTI_BLOCK);
+    multi_dot_block(nj, x + j0, d + j0);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_add_a_times_x(const int     k,
+                                        const double *a,
+                                        const Vector *x)
+{
+  Require(k >= 0);
+  Require(!k || x);
+  Require(!k || a);
+  const double *columns[MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+    {
+      Require(x[j0 + j].size() == d_size);
+      columns[j] = x[j0 + j].d_value;
+    }
+    multi_add_a_times_x_block(nj, a + j0, columns);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_add_a_times_x(const int     k,
+                                        const double *a,
+                                        const double *X)
+{
+  Require(k >= 0);
+  Require(!k || X);
+  Require(!k || a);
+  const double *columns[MULTI_BLOCK];
+  for (int j0 = 0; j0 < k; j0 += MULTI_BLOCK)
+  {
+    int nj = std::min(k - j0, (int)MULTI_BLOCK);
+    for (int j = 0; j < nj; ++j)
+      columns[j] = X + (j0 + j) * d_size;
+    multi_add_a_times_x_block(nj, a + j0, columns);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_dot_block(const int            nj,
+                                    const double * const *x,
+                                    double              *d)
+{
+  Require(nj <= MULTI_BLOCK);
+  for (int j = 0; j < nj; ++j)
+    d[j] = 0.0;
+  const double *y = d_value;
+  const int     n = d_size;
+  // Each element of this vector is read once and dotted with every x[j]
+  // while in cache.  Each thread stores its partial sums in its own slot,
+  // and the slots are added in thread order so that repeated products
+  // give the same bits.
+  int number_threads = 1;
+  std::vector<double> partial;
+  #pragma omp parallel if (n > OMP_MINIMUM_SIZE)
+  {
+    #pragma omp single
+    {
+#ifdef DETRAN_ENABLE_OPENMP
+      number_threads = omp_get_num_threads();
+#endif
+      partial.assign(number_threads * MULTI_BLOCK, 0.0);
+    }
+    int thread = 0;
+#ifdef DETRAN_ENABLE_OPENMP
+    thread = omp_get_thread_num();
+#endif
+    double d_local[MULTI_BLOCK];
+    for (int j = 0; j < nj; ++j)
+      d_local[j] = 0.0;
+    #pragma omp for schedule(static) nowait
+    for (int i = 0; i < n; ++i)
+    {
+      double y_i = y[i];
+      for (int j = 0; j < nj; ++j)
+        d_local[j] += y_i * x[j][i];
+    }
+    for (int j = 0; j < nj; ++j)
+      partial[thread * MULTI_BLOCK + j] = d_local[j];
+  }
+  for (int t = 0; t < number_threads; ++t)
+    for (int j = 0; j < nj; ++j)
+      d[j] += partial[t * MULTI_BLOCK + j];
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::multi_add_a_times_x_block(const int            nj,
+                                              const double        *a,
+                                              const double * const *x)
+{
+  Require(nj <= MULTI_BLOCK);
+  double   *y = d_value;
+  const int n = d_size;
+  // Each element of this vector is loaded and stored once per block of
+  // vectors rather than once per vector.
+  #pragma omp parallel for if (n > OMP_MINIMUM_SIZE)
+  for (int i = 0; i < n; ++i)
+  {
+    double y_i = y[i];
+    for (int j = 0; j < nj; ++j)
+      y_i += a[j] * x[j][i];
+    y[i] = y_i;
+  }
+}
+
 } // end namespace callow
 
 #endif /* callow_VECTOR_I_HH_ */
@@ -17,6 +17,7 @@ namespace detran_geometry
 TrackDB::TrackDB(SP_quadrature q)
   : d_quadrature(q)
   , d_number_polar(1)
+  , d_is_flat(false)
 {
   Require(d_quadrature);
 
@@ -39,6 +40,7 @@ TrackDB::TrackDB(SP_quadrature q)
 //----------------------------------------------------------------------------//
 TrackDB::SP_track TrackDB::track(c_size_t a, c_size_t p, c_size_t t)
 {
+  Insist(!d_is_flat, "The track objects are released by flatten().");
   Require(a < d_tracks.size());
   Require(p < d_tracks[a].size());
   Require(t < d_tracks[a][p].size());
@@ -48,6 +50,7 @@ TrackDB::SP_track TrackDB::track(c_size_t a, c_size_t p, c_size_t t)
 //----------------------------------------------------------------------------//
 TrackDB::iterator_angle TrackDB::begin(c_size_t a, c_size_t p)
 {
+  Insist(!d_is_flat, "The track objects are released by flatten().");
   Require(d_dimension = 2 ? p == 0 : true);
   size_t aa = a % d_quadrature->number_azimuths_octant();
   size_t pp = p % d_quadrature->number_polar_octant();
@@ -59,6 +62,7 @@ TrackDB::iterator_angle TrackDB::begin(c_size_t a, c_size_t p)
 //----------------------------------------------------------------------------//
 TrackDB::iterator_angle TrackDB::end(c_size_t a, c_size_t p)
 {
+  Insist(!d_is_flat, "The track objects are released by flatten().");
   Require(d_dimension = 2 ? p == 0 : true);
   size_t aa = a % d_quadrature->number_azimuths_octant();
   size_t pp = p % d_quadrature->number_polar_octant();
@@ -70,6 +74,13 @@ TrackDB::iterator_angle TrackDB::end(c_size_t a, c_size_t p)
 //----------------------------------------------------------------------------//
 TrackDB::size_t TrackDB::number_tracks(c_size_t a, c_size_t p) const
 {
+  if (d_is_flat)
+  {
+    Require(a < d_number_azimuths);
+    Require(p < d_number_polar);
+    return d_track_offset[a * d_number_polar + p + 1] -
+           d_track_offset[a * d_number_polar + p];
+  }
   Require(a < d_tracks.size());
   Require(p < d_tracks[a].size());
   return d_tracks[a][p].size();
@@ -82,12 +93,18 @@ void TrackDB::add_track(c_size_t a, c_size_t p, SP_track t)
   Requirev(a < d_tracks.size(), AsString(a)+" !< "+AsString(d_tracks.size()));
   Require(p < d_tracks[a].size());
   Require(t);
+  Insist(!d_is_flat, "Tracks cannot be added after flatten().");
   d_tracks[a][p].push_back(t);
 }
 
 //----------------------------------------------------------------------------//
 void TrackDB::normalize(const vec_dbl &volume)
 {
+  if (d_is_flat)
+  {
+    normalize_flat(volume);
+    return;
+  }
   vec_dbl volume_appx(volume.size(), 0.0);
   size_t na = d_quadrature->number_azimuths_octant();
   for (size_t a = 0; a < d_tracks.size(); ++a)
@@ -131,6 +148,34 @@ void TrackDB::normalize(const vec_dbl &volume)
   }
 }
 
+//----------------------------------------------------------------------------//
+void TrackDB::normalize_flat(const vec_dbl &volume)
+{
+  vec_dbl volume_appx(volume.size(), 0.0);
+  size_t na = d_quadrature->number_azimuths_octant();
+  for (size_t a = 0; a < d_number_azimuths; ++a)
+  {
+    double a_wt = d_quadrature->azimuth_weight(a % na) / detran_utilities::pi;
+    for (size_t p = 0; p < d_number_polar; ++p)
+    {
+      if (d_dimension == 3) a_wt *= d_quadrature->polar_weight(p)/2.0;
+      size_t i = d_track_offset[a * d_number_polar + p];
+      for (; i < d_track_offset[a * d_number_polar + p + 1]; ++i)
+      {
+        for (size_t s = d_segment_offset[i]; s < d_segment_offset[i+1]; ++s)
+        {
+          size_t region = d_segment_region[s];
+          Assert(region < volume.size());
+          volume_appx[region] += d_segment_length[s] * d_track_width[i] * a_wt;
+        }
+      }
+    }
+  }
+  for (size_t s = 0; s < d_segment_length.size(); ++s)
+    d_segment_length[s] *= volume[d_segment_region[s]] /
+                           volume_appx[d_segment_region[s]];
+}
+
 //----------------------------------------------------------------------------//
 TrackDB::size_t TrackDB::number_azimuths() const
 {
@@ -197,6 +242,7 @@ struct TrackEntranceCompare
 //----------------------------------------------------------------------------//
 void TrackDB::sort()
 {
+  Insist(!d_is_flat, "The track objects are released by flatten().");
   size_t nq = (d_dimension == 2) ? 2 : 4;
   size_t na = d_quadrature->number_azimuths_octant();
   for (size_t q = 0; q < nq; ++q)
@@ -213,6 +259,61 @@ void TrackDB::sort()
   }
 }
 
+//----------------------------------------------------------------------------//
+void TrackDB::flatten()
+{
+  if (d_is_flat) return;
+
+  // Count tracks and segments so everything is allocated just once.
+  size_t number_tracks = 0;
+  size_t number_segments = 0;
+  for (size_t a = 0; a < d_tracks.size(); ++a)
+  {
+    for (size_t p = 0; p < d_tracks[a].size(); ++p)
+    {
+      number_tracks += d_tracks[a][p].size();
+      for (size_t t = 0; t < d_tracks[a][p].size(); ++t)
+        number_segments += d_tracks[a][p][t]->number_segments();
+    }
+  }
+
+  d_track_offset.assign(d_number_azimuths * d_number_polar + 1, 0);
+  d_segment_offset.assign(number_tracks + 1, 0);
+  d_track_width.assign(number_tracks, 0.0);
+  d_segment_region.assign(number_segments, 0);
+  d_segment_length.assign(number_segments, 0.0);
+
+  size_t i = 0;
+  size_t s = 0;
+  for (size_t a = 0; a < d_tracks.size(); ++a)
+  {
+    for (size_t p = 0; p < d_tracks[a].size(); ++p)
+    {
+      d_track_offset[a * d_number_polar + p] = i;
+      for (size_t t = 0; t < d_tracks[a][p].size(); ++t, ++i)
+      {
+        const Track &trk = *d_tracks[a][p][t];
+        d_segment_offset[i] = s;
+        d_track_width[i]    = trk.width();
+        for (size_t ss = 0; ss < trk.number_segments(); ++ss, ++s)
+        {
+          d_segment_region[s] = trk.segment(ss).region();
+          d_segment_length[s] = trk.segment(ss).length();
+        }
+      }
+    }
+  }
+  d_track_offset[d_number_azimuths * d_number_polar] = i;
+  d_segment_offset[number_tracks] = s;
+  Assert(i == number_tracks);
+  Assert(s == number_segments);
+
+  // The sweepers only need the flat layout, so the track objects and
+  // their segments are released rather than stored twice.
+  vec3_track().swap(d_tracks);
+  d_is_flat = true;
+}
+
 //----------------------------------------------------------------------------//
 void TrackDB::display() const
 {
@@ -225,6 +326,31 @@ void TrackDB::display() const
   cout << endl << endl;
   cout << "dimension: " << d_dimension << endl;
 
+  if (d_is_flat)
+  {
+    for (size_t a = 0; a < d_number_azimuths; ++a)
+    {
+      cout << "  azimuth = " << a << endl;
+      for (size_t p = 0; p < d_number_polar; ++p)
+      {
+        cout << "      polar = " << p << endl;
+        size_t i0 = d_track_offset[a * d_number_polar + p];
+        for (size_t t = 0; t < number_tracks(a, p); ++t)
+        {
+          size_t i = i0 + t;
+          cout << "        track = " << t
+               << " width = " << d_track_width[i] << endl;
+          for (size_t s = d_segment_offset[i]; s < d_segment_offset[i+1]; ++s)
+          {
+            cout << "          region = " << d_segment_region[s]
+                 << " length = " << d_segment_length[s] << endl;
+          }
+        }
+      }
+    }
+    return;
+  }
+
   for (size_t a = 0; a < d_tracks.size(); ++a)
   {
     cout << "  azimuth = " << a << endl;
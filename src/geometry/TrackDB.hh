@@ -93,6 +93,7 @@ public:
    *  @param    a       azimuth index
    *  @param    p       polar index
    *  @param    t       track index within [a, p]
+   *  @note     Only available before flatten().
    */
   SP_track track(c_size_t a, c_size_t p, c_size_t t);
 
@@ -144,6 +145,42 @@ public:
   /// Pretty display of all track
   void display() const;
 
+  //@{
+  /**
+   *  @brief Flat, contiguous track layout
+   *
+   *  The tracks are stored as shared pointers to objects that each own
+   *  a vector of segments, which leads to a lot of pointer chasing in the
+   *  sweep.  After tracking (and normalization), the segments can be
+   *  compiled into structure-of-arrays storage, i.e. flat vectors of
+   *  regions and lengths indexed by a global segment index.  The tracks
+   *  of angle [a, p] are numbered contiguously starting from
+   *  track_offset(a, p), and the segments of track i are found in
+   *  [segment_offset(i), segment_offset(i+1)).
+   *
+   *  The track objects are released once compiled, since keeping both
+   *  layouts would cost more memory per segment than either alone.
+   *  After flattening, only the flat accessors, number_tracks, normalize,
+   *  and display remain available; tracks can no longer be accessed,
+   *  sorted, or added.
+   */
+  void flatten();
+  /// Has the flat layout been built?
+  bool is_flat() const {return d_is_flat;}
+  /// Global index of the first track for an angle
+  inline size_t track_offset(c_size_t a, c_size_t p = 0) const;
+  /// Global index of the first segment along a track
+  inline size_t segment_offset(c_size_t i) const;
+  /// Flat source region of a segment
+  inline size_t segment_region(c_size_t s) const;
+  /// Length of a segment
+  inline double segment_length(c_size_t s) const;
+  /// Width of a track
+  inline double track_width(c_size_t i) const;
+  /// Total number of segments
+  size_t number_segments() const {return d_segment_region.size();}
+  //@}
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -160,6 +197,25 @@ private:
   size_t d_number_polar;
   /// Tracks by [azimuth][polar][space]
   vec3_track d_tracks;
+  /// Flag indicating the flat layout is current
+  bool d_is_flat;
+  /// First track index by azimuth-polar pair, [a * number_polar + p]
+  std::vector<size_t> d_track_offset;
+  /// First segment index by track (plus one past the end)
+  std::vector<size_t> d_segment_offset;
+  /// Track widths by track
+  vec_dbl d_track_width;
+  /// Segment regions by segment
+  std::vector<size_t> d_segment_region;
+  /// Segment lengths by segment
+  vec_dbl d_segment_length;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Normalize the flat segment lengths
+  void normalize_flat(const vec_dbl &volume);
 
 };
 
@@ -167,6 +223,12 @@ GEOMETRY_TEMPLATE_EXPORT(detran_utilities::SP<TrackDB>)
 
 } // end namespace detran_geometry
 
+//----------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//----------------------------------------------------------------------------//
+
+#include "TrackDB.i.hh"
+
 #endif // detran_geometry_TRACKDB_HH_
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  TrackDB.i.hh
+ *  @brief TrackDB inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_geometry_TRACKDB_I_HH_
+#define detran_geometry_TRACKDB_I_HH_
+
+namespace detran_geometry
+{
+
+//----------------------------------------------------------------------------//
+inline TrackDB::size_t TrackDB::track_offset(c_size_t a, c_size_t p) const
+{
+  Require(d_is_flat);
+  Require(a < d_number_azimuths);
+  Require(p < d_number_polar);
+  return d_track_offset[a * d_number_polar + p];
+}
+
+//----------------------------------------------------------------------------//
+inline TrackDB::size_t TrackDB::segment_offset(c_size_t i) const
+{
+  Require(d_is_flat);
+  Require(i < d_segment_offset.size());
+  return d_segment_offset[i];
+}
+
+//----------------------------------------------------------------------------//
+inline TrackDB::size_t TrackDB::segment_region(c_size_t s) const
+{
+  Require(s < d_segment_region.size());
+  return d_segment_region[s];
+}
+
+//----------------------------------------------------------------------------//
+inline double TrackDB::segment_length(c_size_t s) const
+{
+  Require(s < d_segment_length.size());
+  return d_segment_length[s];
+}
+
+//----------------------------------------------------------------------------//
+inline double TrackDB::track_width(c_size_t i) const
+{
+  Require(i < d_track_width.size());
+  return d_track_width[i];
+}
+
+} // end namespace detran_geometry
+
+#endif /* detran_geometry_TRACKDB_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file TrackDB.i.hh
+//----------------------------------------------------------------------------//
@@ -94,6 +94,42 @@ int test_Tracker_2d_mesh(int argc, char *argv[])
     }
   }
 
+  // The flat layout should reproduce the same segments in the same order.
+  TrackDB::SP_trackdb tracks = tracker.trackdb();
+  TEST(!tracks->is_flat());
+  vec_dbl widths(12, 0.0);
+  for (int t = 0; t < 12; ++t)
+    widths[t] = tracks->track(t / 6, 0, t % 6)->width();
+  tracks->flatten();
+  TEST(tracks->is_flat());
+  TEST(tracks->number_segments() == 20);
+  TEST(tracks->track_offset(1, 0) == 6);
+  // The counts remain available once the track objects are released.
+  TEST(tracks->number_tracks(0, 0) == 6);
+  TEST(tracks->number_tracks(1, 0) == 6);
+  for (int t = 0; t < 12; ++t)
+  {
+    TEST(tracks->segment_offset(t + 1) - tracks->segment_offset(t) == ns[t]);
+    TEST(soft_equiv(tracks->track_width(t), widths[t]));
+  }
+  for (int s = 0; s < 20; ++s)
+  {
+    TEST(soft_equiv(tracks->segment_length(s), lengths[s]));
+    TEST(tracks->segment_region(s) == region[s]);
+  }
+
+  // Normalizing the flat layout matches normalizing the track objects.
+  Tracker tracker_2(db, q);
+  tracker_2.trackit(mesh);
+  tracker_2.normalize();
+  tracker_2.trackdb()->flatten();
+  tracker.normalize();
+  for (int s = 0; s < 20; ++s)
+  {
+    TEST(soft_equiv(tracks->segment_length(s),
+                    tracker_2.trackdb()->segment_length(s)));
+  }
+
   return 0;
 }
 
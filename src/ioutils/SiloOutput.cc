@@ -191,8 +191,15 @@ bool SiloOutput::write_angular_flux(SP_state state, SP_quadrature quad)
         char buffer[14];
         sprintf(buffer, "g%i_o%i_a%i", g, o, a);
 
-        // Get a pointer to the group flux
-        double *psi = &state->psi(g, o, a)[0];
+        // Get a pointer to the group flux, gathering it if strided
+        detran::State::angular_flux_type &psi_view = state->psi(g, o, a);
+        double *psi = psi_view.data();
+        vec_dbl psi_gathered;
+        if (!psi_view.is_contiguous())
+        {
+          psi_view.copy_to(psi_gathered);
+          psi = &psi_gathered[0];
+        }
 
         // Write to silo
         DBPutQuadvar1(d_silofile, buffer, "mesh", psi,
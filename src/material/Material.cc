@@ -10,6 +10,7 @@
 #include "utilities/Warning.hh"
 #include <iostream>
 #include <cstdio>
+#include <algorithm>
 #include <cmath>
 
 namespace detran_material
@@ -89,6 +90,7 @@ void Material::set_nu_sigma_f(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_nu_sigma_f[g][m] = v;
+  if (d_finalized) d_nu_sigma_f_block[m][g] = v;
 }
 
 //---------------------------------------------------------------------------//
@@ -98,6 +100,7 @@ void Material::set_sigma_f(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_sigma_f[g][m] = v;
+  if (d_finalized) update_nu_sigma_f(m, g);
 }
 
 //---------------------------------------------------------------------------//
@@ -107,6 +110,7 @@ void Material::set_nu(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_nu[g][m] = v;
+  if (d_finalized) update_nu_sigma_f(m, g);
 }
 
 //---------------------------------------------------------------------------//
@@ -116,6 +120,7 @@ void Material::set_chi(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_chi[g][m] = v;
+  if (d_finalized) d_chi_block[m][g] = v;
 }
 
 //---------------------------------------------------------------------------//
@@ -127,6 +132,7 @@ void Material::set_sigma_s(size_t m, size_t g, size_t gp, double v)
   Require(gp < d_number_groups);
   Require(v >= 0.0);
   d_sigma_s[g][gp][m] = v;
+  if (d_finalized) update_sigma_s(m, g, gp);
 }
 
 //---------------------------------------------------------------------------//
@@ -165,6 +171,9 @@ void Material::set_nu_sigma_f(size_t m, vec_dbl &v)
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
     d_nu_sigma_f[g][m] = v[g];
+  if (d_finalized)
+    for (size_t g = 0; g < d_number_groups; g++)
+      d_nu_sigma_f_block[m][g] = v[g];
 }
 
 //---------------------------------------------------------------------------//
@@ -174,6 +183,9 @@ void Material::set_sigma_f(size_t m, vec_dbl &v)
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
     d_sigma_f[g][m] = v[g];
+  if (d_finalized)
+    for (size_t g = 0; g < d_number_groups; g++)
+      update_nu_sigma_f(m, g);
 }
 
 //---------------------------------------------------------------------------//
@@ -183,6 +195,9 @@ void Material::set_nu(size_t m, vec_dbl &v)
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
     d_nu[g][m] = v[g];
+  if (d_finalized)
+    for (size_t g = 0; g < d_number_groups; g++)
+      update_nu_sigma_f(m, g);
 }
 
 //---------------------------------------------------------------------------//
@@ -192,6 +207,9 @@ void Material::set_chi(size_t m, vec_dbl &v)
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
     d_chi[g][m] = v[g];
+  if (d_finalized)
+    for (size_t g = 0; g < d_number_groups; g++)
+      d_chi_block[m][g] = v[g];
 }
 
 //---------------------------------------------------------------------------//
@@ -202,6 +220,9 @@ void Material::set_sigma_s(size_t m, size_t g, vec_dbl &v)
   Require(v.size() == d_number_groups);
   for (size_t gp = 0; gp < d_number_groups; gp++)
     d_sigma_s[g][gp][m] = v[gp];
+  if (d_finalized)
+    for (size_t gp = 0; gp < d_number_groups; gp++)
+      update_sigma_s(m, g, gp);
 }
 
 //---------------------------------------------------------------------------//
@@ -323,6 +344,76 @@ void Material::finalize()
     d_scatter_bounds[gp][3] = lower; // in reverse order for adjoint.
   }
 
+  compute_upscatter_cutoff();
+
+  // Compute nu*sigma_f
+  for (size_t g = 0; g < d_number_groups; g++)
+    for (size_t m = 0; m < d_number_materials; m++)
+      d_nu_sigma_f[g][m] = d_nu[g][m] * d_sigma_f[g][m];
+
+  // Dense blocks with the material outermost for source construction
+  size_t ng = d_number_groups;
+  d_sigma_s_block.assign(2, vec2_dbl(d_number_materials, vec_dbl(ng*ng, 0.0)));
+  d_nu_sigma_f_block.assign(d_number_materials, vec_dbl(ng, 0.0));
+  d_chi_block.assign(d_number_materials, vec_dbl(ng, 0.0));
+  for (size_t m = 0; m < d_number_materials; m++)
+  {
+    for (size_t g = 0; g < ng; g++)
+    {
+      for (size_t gp = 0; gp < ng; gp++)
+      {
+        d_sigma_s_block[0][m][g * ng + gp] = d_sigma_s[g][gp][m];
+        d_sigma_s_block[1][m][gp * ng + g] = d_sigma_s[g][gp][m];
+      }
+      d_nu_sigma_f_block[m][g] = d_nu_sigma_f[g][m];
+      d_chi_block[m][g] = d_chi[g][m];
+    }
+  }
+
+  d_finalized = true;
+}
+
+//----------------------------------------------------------------------------//
+void Material::update_nu_sigma_f(const size_t m, const size_t g)
+{
+  d_nu_sigma_f[g][m] = d_nu[g][m] * d_sigma_f[g][m];
+  d_nu_sigma_f_block[m][g] = d_nu_sigma_f[g][m];
+}
+
+//----------------------------------------------------------------------------//
+void Material::update_sigma_s(const size_t m, const size_t g, const size_t gp)
+{
+  const size_t ng = d_number_groups;
+  const double v  = d_sigma_s[g][gp][m];
+  d_sigma_s_block[0][m][g * ng + gp] = v;
+  d_sigma_s_block[1][m][gp * ng + g] = v;
+
+  // A zero within the bounds adds nothing, so the bounds only widen.
+  if (v <= 0.0) return;
+  if (gp < d_scatter_bounds[g][0] || gp > d_scatter_bounds[g][1] ||
+      g  > d_scatter_bounds[gp][2] || g  < d_scatter_bounds[gp][3])
+  {
+    d_scatter_bounds[g][0]  = std::min(gp, d_scatter_bounds[g][0]);
+    d_scatter_bounds[g][1]  = std::max(gp, d_scatter_bounds[g][1]);
+    d_scatter_bounds[gp][2] = std::max(g,  d_scatter_bounds[gp][2]);
+    d_scatter_bounds[gp][3] = std::min(g,  d_scatter_bounds[gp][3]);
+    compute_upscatter_cutoff();
+  }
+}
+
+//----------------------------------------------------------------------------//
+void Material::display()
+{
+  material_display();
+}
+
+//----------------------------------------------------------------------------//
+// IMPLEMENTATION
+//----------------------------------------------------------------------------//
+
+//----------------------------------------------------------------------------//
+void Material::compute_upscatter_cutoff()
+{
   /*
    * Go through the scatter bounds for each g.  If for some g, the
    * upper scatter bound is larger than g, then upscatter exists
@@ -354,24 +445,8 @@ void Material::finalize()
     d_downscatter[0] = true;
   if (d_upscatter_cutoff[1] == d_number_groups)
     d_downscatter[1] = true;
-
-  // Compute nu*sigma_f
-  for (size_t g = 0; g < d_number_groups; g++)
-    for (size_t m = 0; m < d_number_materials; m++)
-      d_nu_sigma_f[g][m] = d_nu[g][m] * d_sigma_f[g][m];
-
-  d_finalized = true;
-}
-
-void Material::display()
-{
-  material_display();
 }
 
-//----------------------------------------------------------------------------//
-// IMPLEMENTATION
-//----------------------------------------------------------------------------//
-
 //----------------------------------------------------------------------------//
 void Material::material_display()
 {
@@ -196,7 +196,26 @@ public:
    */
   void compute_diff_coef();
 
-  /// Computes scattering bounds and absorption cross section.
+  /**
+   *  @brief Dense scattering matrix of one material.
+   *
+   *  Element [g*G + g'] is \f$ \Sigma_s(m, g \leftarrow g') \f$ (or of
+   *  the transpose), so that the row for an outgoing group is contiguous.
+   *  The blocks are built by finalize() and kept current by the setters
+   *  called after it.
+   *
+   *  @param m        Material index
+   *  @param tran     Flag for accessing transpose of S
+   */
+  const double* sigma_s_block(size_t m, bool tran = false) const;
+
+  /// Contiguous \f$ \nu\Sigma_f \f$ of one material, built by finalize()
+  const double* nu_sigma_f_block(size_t m) const;
+
+  /// Contiguous \f$ \chi \f$ of one material, built by finalize()
+  const double* chi_block(size_t m) const;
+
+  /// Computes scattering bounds, nu*sigma_f, and the dense blocks.
   void finalize();
 
   /// Pretty print the material database.
@@ -234,6 +253,12 @@ protected:
   vec2_dbl d_diff_coef;
   /// Scatter bounds applied to all materials [group, 2]
   vec2_size_t d_scatter_bounds;
+  /// Dense scatter blocks [transpose, material, group<- * G + group']
+  vec3_dbl d_sigma_s_block;
+  /// Contiguous nu * fission [material, group]
+  vec2_dbl d_nu_sigma_f_block;
+  /// Contiguous fission spectrum [material, group]
+  vec2_dbl d_chi_block;
   /// Groups equal to or above cutoff are subject to upscatter iterations
   size_t d_upscatter_cutoff[2];
   /// Are we ready to be used?
@@ -245,6 +270,20 @@ protected:
 
   void material_display();
 
+  /// Recompute nu*sigma_f and its block entry after nu or sigma_f changes
+  void update_nu_sigma_f(const size_t m, const size_t g);
+
+  /**
+   *  @brief Update the blocks and bounds after one scatter entry changes
+   *
+   *  The bounds are only widened, since zeros within them add nothing.
+   *  Use finalize() to tighten them.
+   */
+  void update_sigma_s(const size_t m, const size_t g, const size_t gp);
+
+  /// Set the upscatter cutoffs and downscatter flags from the bounds
+  void compute_upscatter_cutoff();
+
 #ifdef DETRAN_ENABLE_BOOST
 
   /// Default constructor needed for serialization
@@ -267,6 +306,9 @@ protected:
     ar & d_sigma_s;
     ar & d_diff_coef;
     ar & d_scatter_bounds;
+    ar & d_sigma_s_block;
+    ar & d_nu_sigma_f_block;
+    ar & d_chi_block;
     ar & d_upscatter_cutoff;
     ar & d_finalized;
   }
@@ -71,6 +71,30 @@ inline double Material::sigma_s(size_t m, size_t g, size_t gp) const
   return d_sigma_s[g][gp][m];
 }
 
+//---------------------------------------------------------------------------//
+inline const double* Material::sigma_s_block(size_t m, bool tran) const
+{
+  Insist(d_finalized, "The material must be finalized before use.");
+  Require(m < d_number_materials);
+  return &d_sigma_s_block[tran ? 1 : 0][m][0];
+}
+
+//---------------------------------------------------------------------------//
+inline const double* Material::nu_sigma_f_block(size_t m) const
+{
+  Insist(d_finalized, "The material must be finalized before use.");
+  Require(m < d_number_materials);
+  return &d_nu_sigma_f_block[m][0];
+}
+
+//---------------------------------------------------------------------------//
+inline const double* Material::chi_block(size_t m) const
+{
+  Insist(d_finalized, "The material must be finalized before use.");
+  Require(m < d_number_materials);
+  return &d_chi_block[m][0];
+}
+
 //---------------------------------------------------------------------------//
 inline double Material::diff_coef(size_t m, size_t g) const
 {
@@ -10,7 +10,9 @@
 #define TEST_LIST                     \
         FUNC(test_Material_basic)     \
         FUNC(test_Material_bounds)    \
-        FUNC(test_Material_serialize)
+        FUNC(test_Material_serialize) \
+        FUNC(test_Material_blocks)    \
+        FUNC(test_Material_update)
 
 // Detran headers
 #include "TestDriver.hh"
@@ -167,6 +169,80 @@ int test_Material_serialize(int argc, char *argv[])
   return 0;
 }
 
+// Test of the dense per-material blocks
+int test_Material_blocks(int argc, char *argv[])
+{
+  SP_material mat = material_fixture_7g();
+  int ng = mat->number_groups();
+  for (int m = 0; m < mat->number_materials(); ++m)
+  {
+    const double *S  = mat->sigma_s_block(m);
+    const double *ST = mat->sigma_s_block(m, true);
+    for (int g = 0; g < ng; ++g)
+    {
+      for (int gp = 0; gp < ng; ++gp)
+      {
+        TEST(S[g * ng + gp]  == mat->sigma_s(m, g, gp));
+        TEST(ST[g * ng + gp] == mat->sigma_s(m, gp, g));
+      }
+      TEST(mat->nu_sigma_f_block(m)[g] == mat->nu_sigma_f(m, g));
+      TEST(mat->chi_block(m)[g]        == mat->chi(m, g));
+    }
+  }
+  return 0;
+}
+
+// Test that changes after finalize reach the blocks
+int test_Material_update(int argc, char *argv[])
+{
+  SP_material mat = material_fixture_7g();
+  int ng = mat->number_groups();
+  TEST(mat->upper(0) == 0);
+
+  // Add upscatter 0 <- 6, which also moves the scattering bounds.
+  mat->set_sigma_s(0, 0, ng - 1, 0.25);
+  TEST(mat->sigma_s_block(0)[ng - 1] == 0.25);
+  TEST(mat->sigma_s_block(0, true)[(ng - 1) * ng] == 0.25);
+  TEST(mat->upper(0) == ng - 1);
+
+  // The bounds and cutoffs kept by the setter match a full finalize.
+  mat->set_sigma_s(1, ng - 1, 0, 0.5);
+  vec_int bounds;
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int t = 0; t < 2; ++t)
+    {
+      bounds.push_back(mat->lower(g, t));
+      bounds.push_back(mat->upper(g, t));
+    }
+  }
+  int cutoff[] = {mat->upscatter_cutoff(false), mat->upscatter_cutoff(true)};
+  mat->finalize();
+  for (int g = 0, i = 0; g < ng; ++g)
+  {
+    for (int t = 0; t < 2; ++t)
+    {
+      TEST(bounds[i++] == mat->lower(g, t));
+      TEST(bounds[i++] == mat->upper(g, t));
+    }
+  }
+  TEST(cutoff[0] == mat->upscatter_cutoff(false));
+  TEST(cutoff[1] == mat->upscatter_cutoff(true));
+
+  mat->set_nu(0, 0, 2.0);
+  mat->set_sigma_f(0, 0, 0.5);
+  TEST(soft_equiv(mat->nu_sigma_f(0, 0), 1.0));
+  TEST(soft_equiv(mat->nu_sigma_f_block(0)[0], 1.0));
+  mat->set_nu_sigma_f(0, 1, 3.0);
+  TEST(mat->nu_sigma_f_block(0)[1] == 3.0);
+
+  vec_dbl chi(ng, 0.0);
+  chi[2] = 1.0;
+  mat->set_chi(0, chi);
+  for (int g = 0; g < ng; ++g)
+    TEST(mat->chi_block(0)[g] == chi[g]);
+  return 0;
+}
 
 //---------------------------------------------------------------------------//
 //              end of test_Material.cc
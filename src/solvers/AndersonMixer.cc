@@ -0,0 +1,168 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  AndersonMixer.cc
+ *  @brief AndersonMixer member definitions
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "AndersonMixer.hh"
+#include "utilities/DBC.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+AndersonMixer::AndersonMixer(const size_t depth, const double regularization)
+  : d_depth(depth)
+  , d_regularization(regularization)
+  , d_dF(depth)
+  , d_dG(depth)
+  , d_number_stored(0)
+  , d_next(0)
+  , d_have_previous(false)
+{
+  Insist(d_regularization >= 0.0,
+         "The Anderson regularization must be nonnegative.");
+}
+
+//----------------------------------------------------------------------------//
+AndersonMixer::SP_mixer
+AndersonMixer::Create(SP_input input, const std::string &prefix)
+{
+  Require(input);
+  SP_mixer mixer;
+  int depth = 0;
+  if (input->check(prefix + "_anderson_depth"))
+    depth = input->get<int>(prefix + "_anderson_depth");
+  Insist(depth >= 0, "The Anderson depth must be nonnegative.");
+  if (!depth) return mixer;
+  double regularization = 1.0e-12;
+  if (input->check(prefix + "_anderson_regularization"))
+    regularization = input->get<double>(prefix + "_anderson_regularization");
+  mixer = new AndersonMixer(depth, regularization);
+  return mixer;
+}
+
+//----------------------------------------------------------------------------//
+void AndersonMixer::update(const vec_dbl &x, vec_dbl &g)
+{
+  Require(x.size() == g.size());
+  const size_t n = x.size();
+
+  // Start over if the problem size has changed.
+  if (d_have_previous && d_f.size() != n) reset();
+
+  d_f_new.resize(n);
+  for (size_t i = 0; i < n; ++i)
+    d_f_new[i] = g[i] - x[i];
+
+  // Store the newest differences, overwriting the oldest.
+  if (d_have_previous && d_depth > 0)
+  {
+    vec_dbl &dF = d_dF[d_next];
+    vec_dbl &dG = d_dG[d_next];
+    dF.resize(n);
+    dG.resize(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      dF[i] = d_f_new[i] - d_f[i];
+      dG[i] = g[i] - d_g[i];
+    }
+    d_next = (d_next + 1) % d_depth;
+    d_number_stored = std::min(d_number_stored + 1, d_depth);
+  }
+  d_f = d_f_new;
+  d_g = g;
+  d_have_previous = true;
+  if (!d_number_stored) return;
+
+  // Normal equations of the least squares problem.
+  const size_t m = d_number_stored;
+  vec_dbl A(m * m, 0.0);
+  vec_dbl b(m, 0.0);
+  for (size_t p = 0; p < m; ++p)
+  {
+    for (size_t q = 0; q <= p; ++q)
+    {
+      double v = 0.0;
+      for (size_t i = 0; i < n; ++i)
+        v += d_dF[p][i] * d_dF[q][i];
+      A[p * m + q] = A[q * m + p] = v;
+    }
+    for (size_t i = 0; i < n; ++i)
+      b[p] += d_dF[p][i] * d_f[i];
+  }
+  double scale = 0.0;
+  for (size_t p = 0; p < m; ++p)
+    scale = std::max(scale, A[p * m + p]);
+  for (size_t p = 0; p < m; ++p)
+    A[p * m + p] += d_regularization * scale;
+
+  // Restart from the plain update if the differences are degenerate.
+  if (scale == 0.0 || !solve_spd(m, A, b))
+  {
+    d_number_stored = 0;
+    d_next = 0;
+    return;
+  }
+
+  for (size_t p = 0; p < m; ++p)
+    for (size_t i = 0; i < n; ++i)
+      g[i] -= b[p] * d_dG[p][i];
+}
+
+//----------------------------------------------------------------------------//
+void AndersonMixer::reset()
+{
+  d_number_stored = 0;
+  d_next = 0;
+  d_have_previous = false;
+}
+
+//----------------------------------------------------------------------------//
+bool AndersonMixer::solve_spd(const size_t m, vec_dbl &A, vec_dbl &b)
+{
+  // Factor A = L*L', with L stored in the lower triangle of A.
+  double max_diag = 0.0;
+  for (size_t p = 0; p < m; ++p)
+    max_diag = std::max(max_diag, A[p * m + p]);
+  for (size_t j = 0; j < m; ++j)
+  {
+    double d = A[j * m + j];
+    for (size_t k = 0; k < j; ++k)
+      d -= A[j * m + k] * A[j * m + k];
+    if (d <= 1.0e-14 * max_diag) return false;
+    d = std::sqrt(d);
+    A[j * m + j] = d;
+    for (size_t i = j + 1; i < m; ++i)
+    {
+      double v = A[i * m + j];
+      for (size_t k = 0; k < j; ++k)
+        v -= A[i * m + k] * A[j * m + k];
+      A[i * m + j] = v / d;
+    }
+  }
+  // Solve L*y = b and then L'*x = y.
+  for (size_t i = 0; i < m; ++i)
+  {
+    for (size_t k = 0; k < i; ++k)
+      b[i] -= A[i * m + k] * b[k];
+    b[i] /= A[i * m + i];
+  }
+  for (size_t i = m; i-- > 0;)
+  {
+    for (size_t k = i + 1; k < m; ++k)
+      b[i] -= A[k * m + i] * b[k];
+    b[i] /= A[i * m + i];
+  }
+  return true;
+}
+
+} // end namespace detran
+
+//----------------------------------------------------------------------------//
+//              end of file AndersonMixer.cc
+//----------------------------------------------------------------------------//
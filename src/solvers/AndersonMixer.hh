@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  AndersonMixer.hh
+ *  @brief AndersonMixer class definition
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_ANDERSONMIXER_HH_
+#define detran_ANDERSONMIXER_HH_
+
+#include "solvers/solvers_export.hh"
+#include "utilities/Definitions.hh"
+#include "utilities/InputDB.hh"
+#include "utilities/SP.hh"
+#include <string>
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+/**
+ *  @class AndersonMixer
+ *  @brief Anderson acceleration of a fixed point iteration
+ *
+ *  Consider the fixed point iteration @f$ x^{k+1} = G(x^k) @f$ with the
+ *  residual @f$ f^k = G(x^k) - x^k @f$.  Anderson mixing keeps the
+ *  differences of the last m residuals and images,
+ *  @f$ \Delta f^i = f^{i+1} - f^i @f$ and
+ *  @f$ \Delta G^i = G(x^{i+1}) - G(x^i) @f$, and finds the coefficients
+ *  @f[
+ *      \gamma = \arg\min_\gamma \| f^k - \Delta F \gamma \|^2
+ *             + \lambda s \| \gamma \|^2 \, ,
+ *  @f]
+ *  where @f$ s @f$ is the largest diagonal of
+ *  @f$ \Delta F^T \Delta F @f$, so that the regularization @f$ \lambda @f$
+ *  is relative.  The next iterate is then
+ *  @f[
+ *      x^{k+1} = G(x^k) - \Delta G \gamma \, .
+ *  @f]
+ *  With m = 0, this is the plain fixed point iteration.  The small
+ *  least squares problem is solved via its normal equations, and if these
+ *  are numerically singular, the history is dropped and the iteration
+ *  restarts from the plain update.
+ *
+ *  Only two vectors per level of depth are kept, which makes this a
+ *  cheap alternative to Krylov solvers for fixed point iterations that
+ *  are nonlinear (e.g. with nonlinear acceleration) or that are not
+ *  easily cast as a linear operator.
+ *
+ *  Relevant database entries, for a given prefix:
+ *    - <prefix>_anderson_depth [int] m (default 0, i.e. off)
+ *    - <prefix>_anderson_regularization [double] lambda (default 1e-12)
+ */
+//----------------------------------------------------------------------------//
+
+class SOLVERS_EXPORT AndersonMixer
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<AndersonMixer>     SP_mixer;
+  typedef detran_utilities::InputDB::SP_input     SP_input;
+  typedef detran_utilities::vec_dbl               vec_dbl;
+  typedef detran_utilities::vec2_dbl              vec2_dbl;
+  typedef detran_utilities::size_t                size_t;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param depth            number of differences kept
+   *  @param regularization   relative Tikhonov regularization
+   */
+  AndersonMixer(const size_t depth = 5,
+                const double regularization = 1.0e-12);
+
+  /**
+   *  @brief Create a mixer from the database, or a null pointer if
+   *         the depth for the given prefix is zero or not set.
+   *  @param input    input database
+   *  @param prefix   key prefix, e.g. "inner" for inner_anderson_depth
+   */
+  static SP_mixer Create(SP_input input, const std::string &prefix);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Mix a new image into the next iterate.
+   *  @param x    the last iterate
+   *  @param g    on input, G(x); on output, the next iterate
+   */
+  void update(const vec_dbl &x, vec_dbl &g);
+
+  /// Drop all history, e.g. before a new solve.
+  void reset();
+
+  /// Maximum number of differences kept
+  size_t depth() const { return d_depth; }
+
+  /// Relative regularization
+  double regularization() const { return d_regularization; }
+
+  /// Number of differences currently kept
+  size_t number_stored() const { return d_number_stored; }
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Maximum number of differences
+  size_t d_depth;
+  /// Relative regularization
+  double d_regularization;
+  /// Residual and image differences, stored circularly, [depth][n]
+  vec2_dbl d_dF;
+  vec2_dbl d_dG;
+  /// Previous residual and image
+  vec_dbl d_f;
+  vec_dbl d_g;
+  /// Current residual
+  vec_dbl d_f_new;
+  /// Number of differences kept
+  size_t d_number_stored;
+  /// Index of the next difference slot
+  size_t d_next;
+  /// Is there a previous residual?
+  bool d_have_previous;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Solve the m x m symmetric positive definite system A*x = b in place
+  /// via Cholesky.  Returns false if A is numerically singular.
+  static bool solve_spd(const size_t m, vec_dbl &A, vec_dbl &b);
+
+};
+
+} // end namespace detran
+
+#endif /* detran_ANDERSONMIXER_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file AndersonMixer.hh
+//----------------------------------------------------------------------------//
@@ -83,6 +83,7 @@ public:
   SP_quadrature quadrature() const {return d_mg_solver->quadrature();}
   SP_fissionsource fissionsource() const {return d_mg_solver->fissionsource();}
   int number_sweeps() const { return d_mg_solver->number_sweeps(); }
+  SP_solver solver() const { return d_solver; }
 
 private:
 
@@ -15,9 +15,14 @@
 #include "geometry/Tracker.hh"
 // Multigroup solvers
 #include "MGSolverGS.hh"
+#include "MGSolverJacobi.hh"
 #include "MGDiffusionSolver.hh"
 #include "MGSolverGMRES.hh"
 #include "MGSolverCMFD.hh"
+#include "WGSolverGMRES.hh"
+#include "transport/ScatterSource.hh"
+#include "utilities/MathUtilities.hh"
+#include <algorithm>
 #include <string>
 
 
@@ -200,6 +205,11 @@ bool FixedSourceManager<D>::set_solver()
       d_solver = new MGSolverGS<D>(d_state, d_material, d_boundary,
                                    d_sources, d_fissionsource, d_multiply);
     }
+    else if (outer_solver == "Jacobi")
+    {
+      d_solver = new MGSolverJacobi<D>(d_state, d_material, d_boundary,
+                                       d_sources, d_fissionsource, d_multiply);
+    }
     else if (outer_solver == "CMFD")
     {
       d_solver = new MGSolverCMFD<D>(d_state, d_material, d_boundary,
@@ -296,6 +306,74 @@ double FixedSourceManager<D>::iterate(const int generation)
   return norm_delta_phi;
 }
 
+//----------------------------------------------------------------------------//
+template <class D>
+bool FixedSourceManager<D>::
+solve_block(const std::vector<vec_source>  &sources,
+            const vec_boundary             &boundaries,
+            std::vector<vec_moments_type>  &phi)
+{
+  Require(sources.size() > 0);
+  Require(boundaries.empty() || boundaries.size() == sources.size());
+
+  using detran_utilities::norm_residual;
+
+  if (!d_is_setup)
+  {
+    std::cout << "You must setup the manager before solving.  Skipping solve."
+              << std::endl;
+    return false;
+  }
+  Insist(d_discretization == SN, "Block solves require an SN discretization.");
+  Insist(!d_multiply, "Block solves do not support multiplying problems.");
+  Insist(!d_state->adjoint(), "Block solves do not support adjoint problems.");
+
+  int max_iters = 100;
+  double tolerance = 1e-5;
+  if (d_input->check("outer_max_iters"))
+    max_iters = d_input->template get<int>("outer_max_iters");
+  if (d_input->check("outer_tolerance"))
+    tolerance = d_input->template get<double>("outer_tolerance");
+
+  // A within-group solver with no sources of its own.
+  WGSolverGMRES<D> wg_solver(d_state, d_material, d_quadrature, d_boundary,
+                             vec_source(), SP_fissionsource(), false);
+  ScatterSource scatter(d_mesh, d_material, d_state);
+
+  const size_t m = sources.size();
+  const size_t n = d_mesh->number_cells();
+  const size_t number_groups = d_material->number_groups();
+  phi.assign(m, vec_moments_type(number_groups, moments_type(n, 0.0)));
+  vec_moments_type q(m), phi_g(m, moments_type(n, 0.0));
+
+  // Sweep all groups once and then iterate over the upscatter block.
+  const size_t upscatter = d_material->upscatter_cutoff(false);
+  for (int iteration = 0; iteration <= max_iters; ++iteration)
+  {
+    size_t g_first = iteration ? upscatter : 0;
+    double error = 0.0;
+    for (size_t g = g_first; g < number_groups; ++g)
+    {
+      for (size_t p = 0; p < m; ++p)
+      {
+        q[p].assign(n, 0.0);
+        for (size_t i = 0; i < sources[p].size(); ++i)
+          for (size_t cell = 0; cell < n; ++cell)
+            q[p][cell] += sources[p][i]->source(cell, g);
+        scatter.build_in_scatter_source(g, phi[p], q[p]);
+      }
+      wg_solver.solve_block(g, q, phi_g, boundaries);
+      for (size_t p = 0; p < m; ++p)
+      {
+        error = std::max(error, norm_residual(phi[p][g], phi_g[p], "Linf"));
+        phi[p][g].swap(phi_g[p]);
+      }
+    }
+    if (upscatter == number_groups || (iteration && error < tolerance)) break;
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //----------------------------------------------------------------------------//
@@ -69,7 +69,9 @@ public:
           ExternalSource::vec_externalsource            vec_source;
   typedef FissionSource::SP_fissionsource               SP_fissionsource;
   typedef State::moments_type                           moments_type;
+  typedef State::vec_moments_type                       vec_moments_type;
   typedef typename MGSolver<D>::SP_solver               SP_solver;
+  typedef std::vector<SP_boundary>                      vec_boundary;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -178,6 +180,32 @@ public:
    */
   double iterate(const int generation);
 
+  /**
+   *  @brief Solve several fixed source problems at once
+   *
+   *  Problem p has the external sources sources[p] and, if boundaries
+   *  is not empty and boundaries[p] is not null, the incident fluxes set
+   *  by the conditions of boundaries[p], which must be an SN boundary
+   *  built for the same mesh and quadrature (e.g. with fixed sides).  The
+   *  sources of this manager and the fixed conditions of its boundary
+   *  are not used, and its boundary may not be reflective.
+   *
+   *  The groups are visited in Gauss-Seidel order, and each group is
+   *  solved for all problems together by WGSolverGMRES::solve_block
+   *  using the inner solver settings.  Upscatter groups are iterated to
+   *  outer_tolerance.  Only forward, non-multiplying SN problems are
+   *  supported, and the state is not modified.  The manager must be
+   *  set up, but no solver need be set.
+   *
+   *  @param sources      external sources of each problem
+   *  @param boundaries   boundary source of each problem, or empty
+   *  @param phi          flux moments of each problem, [problem][group]
+   *  @return             false if the manager is not set up
+   */
+  bool solve_block(const std::vector<vec_source>  &sources,
+                   const vec_boundary             &boundaries,
+                   std::vector<vec_moments_type>  &phi);
+
   /// Update operators, etc.
   void update()
   {
@@ -10,6 +10,7 @@
 #define detran_EIGENPI_HH_
 
 #include "Eigensolver.hh"
+#include "solvers/AndersonMixer.hh"
 
 namespace detran
 {
@@ -45,6 +46,15 @@ namespace detran
  *  Note, this is a hand-coded power iteration implementation that
  *  can be used with nonlinear acceleration.
  *
+ *  The iteration can be accelerated by Anderson mixing of the fission
+ *  density (see \ref AndersonMixer).  The eigenvalue is updated from the
+ *  unmixed density, and the mixed density starts the next iteration.
+ *
+ *  Relevant db entries:
+ *  - eigen_pi_aitken (int) [default = 0]
+ *  - eigen_pi_omega (double) [default = 1.0]
+ *  - eigen_pi_anderson_depth (int) [default = 0, i.e. off]
+ *  - eigen_pi_anderson_regularization (double) [default = 1e-12]
  */
 //----------------------------------------------------------------------------//
 
@@ -67,6 +77,7 @@ public:
   typedef typename Base::SP_material                SP_material;
   typedef typename Base::SP_boundary                SP_boundary;
   typedef typename Base::SP_fissionsource           SP_fissionsource;
+  typedef AndersonMixer::SP_mixer                   SP_mixer;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -85,6 +96,13 @@ public:
   /// Solve the eigenvalue problem.
   void solve();
 
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Number of power iterations in the last solve
+  int number_iterations() const { return d_number_iterations; }
+
 protected:
 
   //--------------------------------------------------------------------------//
@@ -111,6 +129,12 @@ protected:
   /// Over-relaxation parameter
   double d_omega;
 
+  /// Anderson mixer for the fission density
+  SP_mixer d_mixer;
+
+  /// Number of power iterations in the last solve
+  int d_number_iterations;
+
 };
 
 } // namespace detran
@@ -34,6 +34,7 @@ void EigenPI<D>::solve()
 
   // Initialize the fission density
   d_fissionsource->initialize();
+  if (d_mixer) d_mixer->reset();
 //
 //  d_state->clear();
 //  for (int g = 0; g < d_number_groups; ++g)
@@ -96,7 +97,15 @@ void EigenPI<D>::solve()
     }
     if (error < d_tolerance) break;
 
+    // Mix the new density with the history.
+    if (d_mixer)
+    {
+      d_mixer->update(fd_old, fd);
+      d_fissionsource->set_density(fd);
+    }
+
   } // eigensolver loop
+  d_number_iterations = std::min(iteration, (int)d_maximum_iterations);
 
   if (d_print_level > 0)
   {
@@ -44,6 +44,12 @@ EnergyDependentEigenLHS(SP_mg_solver mg_solver)
                                    A.sweepsource(),
                                    0, // no cutoff for eigenvalue problems
                                    d_mg_solver->adjoint());
+  if (A.number_group_threads())
+  {
+    d_sweep->set_group_threads(A.thread_sweepers(),
+                               A.thread_sweepsources(),
+                               A.nested_threads());
+  }
 
   // Operator size
   set_size(d_sweep->number_rows());
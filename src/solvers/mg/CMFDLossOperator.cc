@@ -124,7 +124,12 @@ void CMFDLossOperator<D>::construct(const vec2_dbl &phi,
 {
   Require(phi.size() == d_number_groups);
   Require(phi[0].size() == d_group_size);
-  clear();
+  // The pattern depends only on the mesh and the scattering bounds, so it
+  // is reused unless the material changes.
+  if (is_ready() && !mat)
+    reset_values();
+  else
+    clear();
   d_keff = keff;
   if (mat)
   {
@@ -80,7 +80,8 @@ public:
    *  This allows the client to rebuild the matrix after initial
    *  construction.  This is useful for response function generation
    *  as a function of keff or for time-dependent problems in which
-   *  the pseudo-coefficients changes with time.
+   *  the pseudo-coefficients changes with time.  Unless a new material
+   *  is given, the existing sparsity pattern is reused.
    *
    *  @param keff   Scaling parameter for fission source
    */
@@ -53,10 +53,8 @@ DiffusionLossOperator::DiffusionLossOperator(SP_input       input,
   // overwritten by the default boundary.
   d_albedo.resize(6,  vec_dbl(d_number_groups, 1.0));
 
-  // Preallocate.  The number of nonzeros is
-  //   diagonal + 2*dim neighbors + num_groups coupling from scatter/fission
-  vec_int nnz(d_m, 1 + 2 * d_dimension + d_number_active_groups);
-  preallocate(&nnz[0]);
+  // Preallocate.
+  allocate();
 
   // Set the albedo.  First, check if the input has an albedo
   // entry.  If it does, this is the default way to set the
@@ -97,15 +95,26 @@ DiffusionLossOperator::DiffusionLossOperator(SP_input       input,
     }
   }
   // Build the matrix with the initial keff guess.
-  build();
+  Insist(build(), "Could not insert into the diffusion loss operator.");
 }
 
 //----------------------------------------------------------------------------//
 void DiffusionLossOperator::construct(const double keff, const size_t flag)
 {
+  // A new keff changes only the fission coefficients, but a material
+  // update can change any of them.  The existing pattern is refilled
+  // unless scatter is toggled, the scatter bounds have changed, or an
+  // entry falls outside of the pattern, in which case the operator is
+  // rebuilt from scratch.
   d_keff = keff;
+  if (is_ready() && flag == d_sf_flag && !scatter_bounds_changed())
+  {
+    reset_values();
+    if (build()) return;
+  }
   d_sf_flag = flag;
-  build();
+  allocate();
+  Insist(build(), "Could not insert into the diffusion loss operator.");
 }
 
 //----------------------------------------------------------------------------//
@@ -113,7 +122,34 @@ void DiffusionLossOperator::construct(const double keff, const size_t flag)
 //----------------------------------------------------------------------------//
 
 //----------------------------------------------------------------------------//
-void DiffusionLossOperator::build()
+void DiffusionLossOperator::allocate()
+{
+  // Drop any assembled storage before allocating again.
+  if (is_ready() || values_only()) clear();
+  d_allocated = false;
+
+  // The number of nonzeros is
+  //   diagonal + 2*dim neighbors + num_groups coupling from scatter/fission
+  vec_int nnz(d_m, 1 + 2 * d_dimension + d_number_active_groups);
+  preallocate(&nnz[0]);
+}
+
+//----------------------------------------------------------------------------//
+bool DiffusionLossOperator::scatter_bounds_changed() const
+{
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    if (d_scatter_bounds[g][0] != d_material->lower(g, d_adjoint) ||
+        d_scatter_bounds[g][1] != d_material->upper(g, d_adjoint))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------//
+bool DiffusionLossOperator::build()
 {
   using std::cout;
   using std::endl;
@@ -124,6 +160,14 @@ void DiffusionLossOperator::build()
 
   bool db = false;
 
+  // Keep the scatter bounds that shape the pattern.
+  d_scatter_bounds.resize(d_number_groups, vec_size_t(2, 0));
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    d_scatter_bounds[g][0] = d_material->lower(g, d_adjoint);
+    d_scatter_bounds[g][1] = d_material->upper(g, d_adjoint);
+  }
+
   for (groups_iter g_it = d_groups.begin(); g_it != d_groups.end(); ++g_it)
   {
     // actual group
@@ -167,9 +211,9 @@ void DiffusionLossOperator::build()
                         {0, d_mesh->number_cells_y()-1},
                         {0, d_mesh->number_cells_z()-1}};
 
-      // Flag for insertion status.  If false, it means we didn't add
-      // the value and should counter accordingly (here, we assert)
-      bool flag;
+      // An insertion fails if the value does not fit the allocation or,
+      // when refilling, the existing pattern.  The caller then decides
+      // whether to rebuild or give up.
 
       // For each spatial cell, there are 6 faces that connect the
       // cell to a neighbor or the global boundary.  Looping through
@@ -234,8 +278,7 @@ void DiffusionLossOperator::build()
 
           if (db) cout << "      col = " << neig_row << " " << neig_cell << endl;
 
-          flag = insert(row, neig_row, val, INSERT);
-          Assert(flag);
+          if (!insert(row, neig_row, val, INSERT)) return false;
         }
 
         // Compute leakage coefficient for this cell and surface.
@@ -253,8 +296,7 @@ void DiffusionLossOperator::build()
 
      if (db) cout << "      col = " << row << " " << gg <<  endl;
 
-     flag = insert(row, row, val, INSERT);
-     Assert(flag);
+     if (!insert(row, row, val, INSERT)) return false;
 
      // Add down/up scatter components
      if (d_sf_flag == 0)
@@ -277,8 +319,7 @@ void DiffusionLossOperator::build()
          if (db) cout << "  ds  col = " << col << endl;
          double val = d_adjoint ? -d_material->sigma_s(m, gp, g)
                                 : -d_material->sigma_s(m, g, gp);
-         flag = insert(row, col, val, INSERT);
-         Assert(flag);
+         if (!insert(row, col, val, INSERT)) return false;
        }
      }
 
@@ -326,8 +367,7 @@ void DiffusionLossOperator::build()
           }
           // Set the value. Note, we now have to add the value, since
           // in general fission contributes to nonzero cells.
-          bool flag = insert(row, col, v, ADD);
-          Assert(flag);
+          if (!insert(row, col, v, ADD)) return false;
         }
       } // row loop
     } // group loop
@@ -335,7 +375,7 @@ void DiffusionLossOperator::build()
 
   // Assemble.
   assemble();
-
+  return true;
 }
 
 //----------------------------------------------------------------------------//
@@ -56,6 +56,8 @@ public:
   typedef detran_utilities::vec_int                     vec_int;
   typedef detran_utilities::vec_dbl                     vec_dbl;
   typedef detran_utilities::vec2_dbl                    vec2_dbl;
+  typedef detran_utilities::vec_size_t                  vec_size_t;
+  typedef detran_utilities::vec2_size_t                 vec2_size_t;
   typedef detran_utilities::vec_size_t                  groups_t;
   typedef groups_t::iterator                            groups_iter;
 
@@ -92,7 +94,10 @@ public:
    *  This allows the client to rebuild the matrix after initial
    *  construction.  This is useful for response function generation
    *  as a function of keff or for time-dependent problems in which
-   *  the pseudo-coefficients changes with time.
+   *  the pseudo-coefficients changes with time.  The existing sparsity
+   *  pattern is refilled when the flag and the material scatter bounds
+   *  are unchanged and every entry fits it; otherwise, the operator is
+   *  rebuilt from scratch.
    *
    *  @param keff   Scaling parameter for fission source
    *  @param flag   Optionally omit any scatter and fission terms
@@ -135,13 +140,20 @@ private:
   bool d_adjoint;
   /// Skip scatter and fission
   size_t d_sf_flag;
+  /// Material scatter bounds [group][lower, upper] of the current pattern
+  vec2_size_t d_scatter_bounds;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
   //--------------------------------------------------------------------------//
 
+  /// Allocate rows for the full coupling, dropping any assembled storage
+  void allocate();
+  /// Do the material scatter bounds differ from those of the pattern?
+  bool scatter_bounds_changed() const;
   // All matrix operators need this.  Here, we have the client call construct.
-  void build();
+  // Returns false if an entry could not be inserted.
+  bool build();
 
 };
 
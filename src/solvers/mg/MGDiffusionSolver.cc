@@ -10,6 +10,8 @@
 #include "boundary/BoundaryTraits.hh"
 #include "DiffusionGainOperator.hh"
 #include "callow/preconditioner/PCILU0.hh"
+#include "utilities/MathUtilities.hh"
+#include "utilities/Warning.hh"
 #include <cstdio>
 #include <cmath>
 #include <iostream>
@@ -29,6 +31,12 @@ MGDiffusionSolver<D>::MGDiffusionSolver(SP_state                  state,
   , d_solver_type("gmres")
   , d_keff(1.0)
   , d_fill_boundary(false)
+  , d_block(false)
+  , d_lower(0)
+  , d_lower_upscatter(d_material->upscatter_cutoff(d_adjoint))
+  , d_upper(d_number_groups)
+  , d_iterate(false)
+  , d_number_block_iterations(0)
 {
   // Set the problem dimension
   d_problem_size = d_mesh->number_cells() * d_material->number_groups();
@@ -37,36 +45,44 @@ MGDiffusionSolver<D>::MGDiffusionSolver(SP_state                  state,
   d_phi = new Vector_T(d_problem_size, 0.0);
   d_Q   = new Vector_T(d_problem_size, 0.0);
 
-  // Create multigroup diffusion operator.  Note, the full energy range
-  // is included.
-  size_t cutoff = d_adjoint ? d_number_groups - 1 : 0;
-  d_M   = new DiffusionLossOperator(d_input,
-                                    d_material,
-                                    d_mesh,
-                                    d_multiply,
-                                    cutoff,
-                                    d_adjoint,
-                                    1.0);       // Default to k=1
+  // Select the full operator or block Gauss-Seidel over groups
+  if (d_input->check("diffusion_solver_type"))
+  {
+    std::string type =
+      d_input->template get<std::string>("diffusion_solver_type");
+    Insist(type == "full" || type == "block",
+           "Unsupported diffusion_solver_type: " + type);
+    d_block = (type == "block");
+  }
 
-  // Get or create solver database.
-  SP_input db;
-  if (d_input->check("outer_solver_db"))
+  if (d_block)
   {
-    db = d_input->template get<SP_input>("outer_solver_db");
+    build_group_solvers();
   }
   else
   {
-    db = new detran_utilities::InputDB("mgdiffusionsolver_db");
-    db->template put<double>("linear_solver_rtol", d_tolerance);
-    db->template put<double>("linear_solver_atol", d_tolerance);
-    db->template put<int>("linear_solver_maxit", d_maximum_iterations);
-    db->template put<int>("linear_solver_monitor_level", d_print_level);
-    d_input->template put<SP_input>("outer_solver_db", db);
-  }
+    build_lossoperator();
 
-  // Build solver
-  d_solver = Creator_T::Create(db);
-  d_solver->set_operators(d_M, db);
+    // Get or create solver database.
+    SP_input db;
+    if (d_input->check("outer_solver_db"))
+    {
+      db = d_input->template get<SP_input>("outer_solver_db");
+    }
+    else
+    {
+      db = new detran_utilities::InputDB("mgdiffusionsolver_db");
+      db->template put<double>("linear_solver_rtol", d_tolerance);
+      db->template put<double>("linear_solver_atol", d_tolerance);
+      db->template put<int>("linear_solver_maxit", d_maximum_iterations);
+      db->template put<int>("linear_solver_monitor_level", d_print_level);
+      d_input->template put<SP_input>("outer_solver_db", db);
+    }
+
+    // Build solver
+    d_solver = Creator_T::Create(db);
+    d_solver->set_operators(d_M, db);
+  }
 
   // Check whether we need boundary currents
   if (d_input->check("compute_boundary_flux"))
@@ -79,23 +95,49 @@ MGDiffusionSolver<D>::MGDiffusionSolver(SP_state                  state,
 template <class D>
 void MGDiffusionSolver<D>::refresh()
 {
-  // Easiest approach for now is simply to rebuild the operator.  This
-  // may be less than ideal, but the cost of building a diffusion operator
-  // should almost always be a small fraction of the solver cost.
-  d_M = new DiffusionLossOperator(d_input, d_material, d_mesh,
-                                  d_multiply, 0, d_adjoint, d_keff);
-  d_solver->set_operators(d_M);
+  // This runs for a new keff and after material updates (e.g. from
+  // TimeStepper), so the operator is reconstructed.  It reuses its
+  // sparsity pattern when it can.  Block solves apply fission on the
+  // right hand side, but an operator built on demand is kept current.
+  if (d_M) d_M->construct(d_keff);
+  if (!d_block)
+  {
+    d_solver->set_operators(d_M);
+    return;
+  }
+
+  // Refill the within-group operators, and give their solvers the new
+  // operators so that the preconditioners are rebuilt.
+  if (!d_multiply) d_lower_upscatter = d_material->upscatter_cutoff(d_adjoint);
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    d_group_operators[g]->construct();
+    d_group_solvers[g]->set_operators(d_group_operators[g]);
+  }
+}
+
+//----------------------------------------------------------------------------//
+template <class D>
+typename MGDiffusionSolver<D>::SP_lossoperator
+MGDiffusionSolver<D>::lossoperator()
+{
+  if (!d_M) build_lossoperator();
+  return d_M;
 }
 
 //----------------------------------------------------------------------------//
 template <class D>
 void MGDiffusionSolver<D>::solve(const double keff)
 {
-  // Note, if keff is new, we must refresh the operators
+  // Note, if keff is new, we must refresh the operators.  The group
+  // blocks do not depend on keff, so only the full operator is rebuilt.
   if (d_keff != keff)
   {
     d_keff = keff;
-    refresh();
+    if (!d_block)
+      refresh();
+    else if (d_M)
+      d_M->construct(d_keff);
   }
 
   // Reset and build the right hand side.
@@ -106,7 +148,10 @@ void MGDiffusionSolver<D>::solve(const double keff)
   // Solve the problem
 //  d_M->print_matlab("tran_diff.out");
 //  d_M->compute_explicit("tran_exp.out");
-  d_solver->solve(*d_Q, *d_phi);
+  if (d_block)
+    solve_block();
+  else
+    d_solver->solve(*d_Q, *d_phi);
 //  d_Q->print_matlab("Q.out");
 //  d_phi->print_matlab("phi.out");
 //
@@ -322,9 +367,10 @@ void MGDiffusionSolver<D>::fill_current()
         if (bound[leak] == nxyz[xyz_idx][dir_idx])
         {
 
-          dtilde = ( 2.0 * cell_dc * (1.0 - d_M->albedo(leak, g)  ) ) /
-                   ( 4.0 * cell_dc * (1.0 + d_M->albedo(leak, g)) +
-                    (1.0 - d_M->albedo(leak, g)) * cell_hxyz[xyz_idx] );
+          double a = albedo(leak, g);
+          dtilde = ( 2.0 * cell_dc * (1.0 - a) ) /
+                   ( 4.0 * cell_dc * (1.0 + a) +
+                    (1.0 - a) * cell_hxyz[xyz_idx] );
 
           J[leak] = dtilde * phi_g[cell];
 
@@ -447,6 +493,172 @@ void MGDiffusionSolver<D>::fill_boundary()
   } // end dim0 loop
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+void MGDiffusionSolver<D>::build_lossoperator()
+{
+  // Create multigroup diffusion operator.  Note, the full energy range
+  // is included.
+  size_t cutoff = d_adjoint ? d_number_groups - 1 : 0;
+  d_M   = new DiffusionLossOperator(d_input,
+                                    d_material,
+                                    d_mesh,
+                                    d_multiply,
+                                    cutoff,
+                                    d_adjoint,
+                                    d_keff);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void MGDiffusionSolver<D>::build_group_solvers()
+{
+  // Get or create the within-group solver database.
+  SP_input db;
+  bool default_db = false;
+  if (d_input->check("diffusion_group_solver_db"))
+  {
+    db = d_input->template get<SP_input>("diffusion_group_solver_db");
+  }
+  else
+  {
+    default_db = true;
+    db = new detran_utilities::InputDB("mgdiffusionsolver_group_db");
+    db->template put<std::string>("linear_solver_type", "cg");
+    db->template put<double>("linear_solver_rtol", d_tolerance);
+    db->template put<double>("linear_solver_atol", d_tolerance);
+    db->template put<int>("linear_solver_maxit", d_maximum_iterations);
+    db->template put<std::string>("pc_type", "amg");
+    d_input->template put<SP_input>("diffusion_group_solver_db", db);
+  }
+
+  d_group_operators.resize(d_number_groups);
+  d_group_solvers.resize(d_number_groups);
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    d_group_operators[g] =
+      new WGDiffusionLossOperator(d_input, d_material, d_mesh, g);
+    d_group_solvers[g] = Creator_T::Create(db);
+    d_group_solvers[g]->set_operators(d_group_operators[g], db);
+    // The solver builds the default preconditioner but leaves it off.
+    if (default_db)
+    {
+      d_group_solvers[g]->
+        set_preconditioner(d_group_solvers[g]->preconditioner());
+    }
+  }
+  d_group_source = new Vector_T(d_mesh->number_cells(), 0.0);
+
+  // Group order follows MGSolverGS, with adjoint problems in reverse.
+  if ((!d_downscatter && d_maximum_iterations > 0 && d_number_groups > 1)
+      || d_multiply)
+  {
+    d_iterate = true;
+  }
+  if (d_adjoint)
+  {
+    d_lower = d_number_groups - 1;
+    d_upper = -1;
+  }
+  if (d_multiply) d_lower_upscatter = d_lower;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void MGDiffusionSolver<D>::solve_block()
+{
+  using detran_utilities::range;
+
+  // Initial pass through all groups
+  detran_utilities::vec_int groups = range<int>(d_lower, d_upper);
+  for (int i = 0; i < groups.size(); ++i)
+    solve_group(groups[i]);
+
+  // Iterate over the upscatter block
+  d_number_block_iterations = 0;
+  if (!d_iterate) return;
+  groups = range<int>(d_lower_upscatter, d_upper);
+  Vector_T phi_old(d_problem_size, 0.0);
+  double error = 0.0;
+  int iteration = 1;
+  for (; iteration <= d_maximum_iterations; ++iteration)
+  {
+    phi_old.copy(*d_phi);
+    for (int i = 0; i < groups.size(); ++i)
+      solve_group(groups[i]);
+    error = d_phi->norm_residual(phi_old, callow::LINF);
+    double scale = d_phi->norm(callow::LINF);
+    if (scale > 0.0) error /= scale;
+    if (d_print_level > 1 && iteration % d_print_interval == 0)
+      printf("  Block GS Iter: %3i  Error: %12.9e \n", iteration, error);
+    if (error < d_tolerance) break;
+  }
+  d_number_block_iterations = std::min(iteration, (int)d_maximum_iterations);
+
+  if (error >= d_tolerance)
+  {
+    detran_utilities::warning(detran_utilities::SOLVER_CONVERGENCE,
+      "Block Gauss-Seidel diffusion did not converge.");
+  }
+  if (d_print_level > 0)
+  {
+    printf("  Block GS Final: Number Iters: %3i  Error: %12.9e \n",
+           d_number_block_iterations, error);
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void MGDiffusionSolver<D>::solve_group(const size_t g)
+{
+  using detran_utilities::range;
+
+  const vec_int &mat_map = d_mesh->mesh_map("MATERIAL");
+  size_t number_cells = d_mesh->number_cells();
+  Vector_T &b = *d_group_source;
+  const Vector_T &phi = *d_phi;
+
+  // Fixed source plus in-scatter and (implicit) fission from other groups
+  groups_t g_s = range<size_t>(d_material->lower(g, d_adjoint),
+                               d_material->upper(g, d_adjoint), true);
+  for (size_t cell = 0; cell < number_cells; ++cell)
+  {
+    size_t m = mat_map[cell];
+    double v = (*d_Q)[cell + g * number_cells];
+    for (size_t i = 0; i < g_s.size(); ++i)
+    {
+      size_t gp = g_s[i];
+      if (gp == g) continue;
+      double s = d_adjoint ? d_material->sigma_s(m, gp, g)
+                           : d_material->sigma_s(m, g, gp);
+      v += s * phi[cell + gp * number_cells];
+    }
+    if (d_multiply)
+    {
+      for (size_t gp = 0; gp < d_number_groups; ++gp)
+      {
+        double f = d_adjoint
+          ? d_material->nu_sigma_f(m, g) * d_material->chi(m, gp)
+          : d_material->nu_sigma_f(m, gp) * d_material->chi(m, g);
+        v += f * phi[cell + gp * number_cells] / d_keff;
+      }
+    }
+    b[cell] = v;
+  }
+
+  // Solve in place, starting from the latest group flux
+  Vector_T phi_g(number_cells, &(*d_phi)[g * number_cells]);
+  d_group_solvers[g]->solve(b, phi_g);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+double MGDiffusionSolver<D>::albedo(const size_t side, const size_t g)
+{
+  if (d_block) return d_group_operators[g]->albedo(side);
+  return d_M->albedo(side, g);
+}
+
 //----------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //----------------------------------------------------------------------------//
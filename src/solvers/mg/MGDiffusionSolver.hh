@@ -12,6 +12,7 @@
 #include "MGSolver.hh"
 #include "DiffusionLossOperator.hh"
 #include "DiffusionGainOperator.hh"
+#include "solvers/wg/WGDiffusionLossOperator.hh"
 #include "callow/vector/Vector.hh"
 #include "boundary/BoundaryDiffusion.hh"
 #include "external_source/ExternalSource.hh"
@@ -49,6 +50,20 @@ namespace detran
  *  by the user.
  *
  *  These three cases are selected via diffusion_fixed_type 0,1,2
+ *
+ *  By default (diffusion_solver_type "full"), the complete multigroup
+ *  loss operator is assembled and solved with one linear solver.  With
+ *  diffusion_solver_type "block", only the within-group operators are
+ *  built, and the groups are solved by block Gauss-Seidel in the
+ *  manner of MGSolverGS: one pass over all groups, followed by
+ *  iteration over the upscatter block (or all groups if fission is
+ *  implicit) until the relative change in the flux is below the outer
+ *  tolerance.  Scatter and implicit fission between groups are lagged
+ *  on the right hand side.  Each within-group solve uses the database
+ *  diffusion_group_solver_db if given, and otherwise CG with the AMG
+ *  preconditioner, since each group block is symmetric positive
+ *  definite.  This avoids storing the group-to-group
+ *  coupling, which dominates the full operator for many groups.
  */
 template <class D>
 class MGDiffusionSolver: public MGSolver<D>
@@ -74,6 +89,7 @@ public:
   typedef State::moments_type                       moments_type;
   typedef DiffusionLossOperator::SP_lossoperator    SP_lossoperator;
   typedef DiffusionGainOperator::SP_gainoperator    SP_gainoperator;
+  typedef WGDiffusionLossOperator::SP_operator      SP_groupoperator;
   typedef callow::Vector                            Vector_T;
   typedef Vector_T::SP_vector                       SP_vector;
   typedef callow::LinearSolverCreator               Creator_T;
@@ -82,6 +98,7 @@ public:
   typedef callow::MatrixBase::SP_matrix             SP_matrix;
   typedef detran_utilities::size_t                  size_t;
   typedef detran_utilities::vec_int                 vec_int;
+  typedef detran_utilities::vec_size_t              groups_t;
   typedef BoundaryDiffusion<D>                      Boundary_T;
 
   //--------------------------------------------------------------------------//
@@ -104,14 +121,14 @@ public:
                     SP_fissionsource          q_f,
                     bool                      multiply);
 
-  /// Refresh the solver.
+  /// Refresh the solver, e.g. after the material changes.
   void refresh();
 
-  /// Return the lossoperator
-  SP_lossoperator lossoperator()
-  {
-    return d_M;
-  }
+  /// Return the lossoperator, which is built on demand for block solves
+  SP_lossoperator lossoperator();
+
+  /// Number of block Gauss-Seidel iterations in the last solve
+  int number_block_iterations() const { return d_number_block_iterations; }
 
   //--------------------------------------------------------------------------//
   // ABSTRACT INTERFACE -- ALL MULTIGROUP SOLVERS MUST IMPLEMENT
@@ -163,6 +180,22 @@ private:
   double d_keff;
   /// Boundary fill flag
   bool d_fill_boundary;
+  /// Flag for block Gauss-Seidel over groups
+  bool d_block;
+  /// Within-group loss operators for block solves
+  std::vector<SP_groupoperator> d_group_operators;
+  /// Within-group linear solvers for block solves
+  std::vector<SP_linearsolver> d_group_solvers;
+  /// Right hand side of a within-group solve
+  SP_vector d_group_source;
+  /// Group bounds for the initial pass and the iteration block
+  int d_lower;
+  int d_lower_upscatter;
+  int d_upper;
+  /// Flag for iterating over the block
+  bool d_iterate;
+  /// Number of block Gauss-Seidel iterations in the last solve
+  int d_number_block_iterations;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -178,6 +211,16 @@ private:
   void fill_current();
   /// Fill the boundary with outgoing current
   void fill_boundary();
+  /// Build the full multigroup loss operator
+  void build_lossoperator();
+  /// Build the within-group operators and solvers
+  void build_group_solvers();
+  /// Solve by block Gauss-Seidel over groups
+  void solve_block();
+  /// Solve one group with the latest fluxes of the others
+  void solve_group(const size_t g);
+  /// Albedo of a boundary surface for a group
+  double albedo(const size_t side, const size_t g);
 
 };
 
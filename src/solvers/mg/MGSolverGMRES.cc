@@ -11,6 +11,7 @@
 #include "MGCMDSA.hh"
 #include "MGTCDSA.hh"
 #include "callow/solver/LinearSolverCreator.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -96,6 +97,33 @@ MGSolverGMRES<D>::MGSolverGMRES(SP_state                  state,
                                 d_adjoint);
     //d_operator->compute_explicit("transport.out");
 
+    // Optionally sweep the groups concurrently, with one state, sweeper,
+    // and sweep source per thread.
+    int number_threads = 0;
+    if (d_input->check("outer_group_threads"))
+      number_threads = d_input->template get<int>("outer_group_threads");
+    number_threads = std::min(number_threads, d_number_active_groups);
+    if (number_threads > 1)
+    {
+      bool nested = false;
+      if (d_input->check("outer_nested_threads"))
+        nested = d_input->template get<int>("outer_nested_threads");
+      typename Operator_T::vec_sweeper     sweepers(number_threads);
+      typename Operator_T::vec_sweepsource sources(number_threads);
+      d_thread_states.resize(number_threads);
+      d_thread_solvers.resize(number_threads);
+      for (int t = 0; t < number_threads; ++t)
+      {
+        d_thread_states[t]  = new State(*d_state);
+        d_thread_solvers[t] = this->create_wg_solver(d_thread_states[t]);
+        sweepers[t] = d_thread_solvers[t]->get_sweeper();
+        sources[t]  = d_thread_solvers[t]->get_sweepsource();
+        // The operator redirects reflected fluxes itself.
+        sweepers[t]->set_update_boundary(false);
+      }
+      d_operator->set_group_threads(sweepers, sources, nested);
+    }
+
     // Create temporary unknown and right hand size vectors
     d_x = new callow::Vector(d_operator->number_rows(), 0.0);
     d_b = new callow::Vector(d_operator->number_rows(), 0.0);
@@ -216,7 +244,10 @@ template <class D>
 int MGSolverGMRES<D>::number_sweeps() const
 {
   Require(d_sweeper);
-  return d_sweeper->number_sweeps();
+  int n = d_sweeper->number_sweeps();
+  for (size_t t = 0; t < d_thread_solvers.size(); ++t)
+    n += d_thread_solvers[t]->get_sweeper()->number_sweeps();
+  return n;
 }
 
 //----------------------------------------------------------------------------//
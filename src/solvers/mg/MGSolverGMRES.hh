@@ -75,6 +75,15 @@ namespace detran
  *  downscatter, it is used for the downscatter-only block.  The user can
  *  switch this using "outer_upscatter_cutoff".
  *
+ *  The group sweeps within one application of the operator are
+ *  independent, and they can be done concurrently by setting
+ *  "outer_group_threads" to the number of threads wanted (limited by the
+ *  number of Krylov groups).  Each thread then owns a copy of the state
+ *  and a sweeper and sweep source built on it.  With
+ *  "outer_nested_threads", the angle threading of each sweeper is kept,
+ *  which requires nested parallelism to be enabled (e.g. via
+ *  OMP_NUM_THREADS="4,2").
+ *
  *  Reference:
  *    Evans, T., Davidson, G. and Mosher, S. "Parallel Algorithms for
  *    Fixed-Source and Eigenvalue Problems", NSTD Seminar (ORNL), May 27, 2010.
@@ -240,6 +249,10 @@ private:
   SP_sweepsource d_sweepsource;
   /// Flag to update the angular flux, including boundary and cell values
   bool d_update_angular_flux;
+  /// Thread copies of the state for concurrent group sweeps
+  std::vector<SP_state> d_thread_states;
+  /// Thread within-group solvers providing the thread sweepers
+  std::vector<SP_wg_solver> d_thread_solvers;
 
   //-------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -27,10 +27,13 @@ MGSolverGS<D>::MGSolverGS(SP_state                  state,
   , d_upper(d_material->number_groups())
   , d_iterate(false)
   , d_norm_type("Linf")
+  , d_number_iterations(0)
 {
   if (d_input->check("outer_norm_type"))
     d_norm_type = d_input->template get<std::string>("outer_norm_type");
 
+  d_mixer = AndersonMixer::Create(d_input, "outer");
+
   if ((!d_downscatter && d_maximum_iterations > 0 && d_number_groups > 1)
       || d_multiply)
   {
@@ -10,6 +10,7 @@
 #define detran_MGSOLVERGS_HH_
 
 #include "MGTransportSolver.hh"
+#include "solvers/AndersonMixer.hh"
 
 namespace detran
 {
@@ -19,8 +20,13 @@ namespace detran
  *  @class MGSolverGS
  *  @brief Solves the multigroup transport equation via Gauss-Seidel.
  *
+ *  The upscatter iterations can be accelerated by Anderson mixing of the
+ *  fluxes of the upscatter block (see \ref AndersonMixer).
+ *
  *  Relevant db entries:
  *  - outer_norm_type (str) [default = "Linf"]
+ *  - outer_anderson_depth (int) [default = 0, i.e. off]
+ *  - outer_anderson_regularization (double) [default = 1e-12]
  */
 /**
  *  @example solvers/test/test_MGSolverGS
@@ -52,6 +58,7 @@ public:
   typedef typename Base::size_t                     size_t;
   typedef detran_utilities::vec_dbl                 vec_dbl;
   typedef detran_utilities::vec_size_t              vec_size_t;
+  typedef AndersonMixer::SP_mixer                   SP_mixer;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -87,6 +94,9 @@ public:
   /// Return number of sweeps
   int number_sweeps() const;
 
+  /// Number of upscatter iterations in the last solve
+  int number_iterations() const { return d_number_iterations; }
+
   /// Perform one downscatter sweep
   void sweep();
 
@@ -125,6 +135,10 @@ private:
   bool d_iterate;
   /// Determines which norm to use (default is Linf)
   std::string d_norm_type;
+  /// Anderson mixer for the upscatter iterations
+  SP_mixer d_mixer;
+  /// Number of upscatter iterations in the last solve
+  int d_number_iterations;
 
 };
 
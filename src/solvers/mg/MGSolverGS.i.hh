@@ -52,6 +52,10 @@ void MGSolverGS<D>::solve(const double keff)
     // Update group bounds for the possibly truncated iteration block.
     groups = range<size_t>(d_lower_upscatter, d_upper);
 
+    // Fluxes of the block before and after an iteration, for mixing.
+    vec_dbl x, gx;
+    if (d_mixer) d_mixer->reset();
+
     for (iteration = 1; iteration <= d_maximum_iterations; ++iteration)
     {
       detran_utilities::vec_scale(nres, 0.0);
@@ -75,7 +79,29 @@ void MGSolverGS<D>::solve(const double keff)
       }
       if (nres_tot < d_tolerance) break;
 
+      // Mix the block fluxes with the history.
+      if (d_mixer)
+      {
+        x.clear();
+        gx.clear();
+        for (g_it = groups.begin(); g_it != groups.end(); ++g_it)
+        {
+          x.insert(x.end(), phi_old[*g_it].begin(), phi_old[*g_it].end());
+          gx.insert(gx.end(), d_state->phi(*g_it).begin(),
+                    d_state->phi(*g_it).end());
+        }
+        d_mixer->update(x, gx);
+        vec_dbl::const_iterator it = gx.begin();
+        for (g_it = groups.begin(); g_it != groups.end(); ++g_it)
+        {
+          State::moments_type &phi = d_state->phi(*g_it);
+          std::copy(it, it + phi.size(), phi.begin());
+          it += phi.size();
+        }
+      }
+
     } // end upscatter iterations
+    d_number_iterations = std::min(iteration, d_maximum_iterations);
 
     if (nres_tot > d_tolerance)
     {
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MGSolverJacobi.cc
+ *  @brief MGSolverJacobi member definitions
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "MGSolverJacobi.hh"
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+template <class D>
+MGSolverJacobi<D>::MGSolverJacobi(SP_state                  state,
+                                  SP_material               material,
+                                  SP_boundary               boundary,
+                                  const vec_externalsource &q_e,
+                                  SP_fissionsource          q_f,
+                                  bool                      multiply)
+  : Base(state, material, boundary, q_e, q_f, multiply)
+  , d_lower(0)
+  , d_lower_upscatter(d_material->upscatter_cutoff(d_adjoint))
+  , d_upper(d_material->number_groups())
+  , d_iterate(false)
+  , d_norm_type("Linf")
+  , d_number_iterations(0)
+{
+  if (d_input->check("outer_norm_type"))
+    d_norm_type = d_input->template get<std::string>("outer_norm_type");
+
+  if ((!d_downscatter && d_maximum_iterations > 0 && d_number_groups > 1)
+      || d_multiply)
+  {
+    d_iterate = true;
+  }
+
+  // Adjoint problems are iterated in reverse, as for Gauss-Seidel.
+  if (d_adjoint)
+  {
+    d_lower = d_number_groups - 1;
+    d_lower_upscatter = d_material->upscatter_cutoff(d_adjoint);
+    d_upper = -1;
+  }
+
+  // For multiplying problems, we assume iterations are all groups
+  if (d_multiply) d_lower_upscatter = d_lower;
+
+  // One state and inner solver per thread, but no more than there are
+  // groups in the block.
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  int block_size = std::abs(d_upper - d_lower_upscatter);
+  number_threads = std::max(1, std::min(number_threads, block_size));
+  d_thread_states.resize(number_threads);
+  d_thread_solvers.resize(number_threads);
+  for (int t = 0; t < number_threads; ++t)
+  {
+    d_thread_states[t] = new State(*d_state);
+    d_thread_solvers[t] = this->create_wg_solver(d_thread_states[t]);
+  }
+
+  Ensure(d_norm_type == "Linf" || d_norm_type == "L1" || d_norm_type == "L2");
+}
+
+//----------------------------------------------------------------------------//
+template <class D>
+int MGSolverJacobi<D>::number_sweeps() const
+{
+  int n = d_wg_solver->get_sweeper()->number_sweeps();
+  for (size_t t = 0; t < d_thread_solvers.size(); ++t)
+    n += d_thread_solvers[t]->get_sweeper()->number_sweeps();
+  return n;
+}
+
+//----------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATIONS
+//----------------------------------------------------------------------------//
+
+template class MGSolverJacobi<_1D>;
+template class MGSolverJacobi<_2D>;
+template class MGSolverJacobi<_3D>;
+
+} // end namespace detran
+
+//----------------------------------------------------------------------------//
+//              end of file MGSolverJacobi.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,172 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MGSolverJacobi.hh
+ *  @brief MGSolverJacobi class definition
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_MGSOLVERJACOBI_HH_
+#define detran_MGSOLVERJACOBI_HH_
+
+#include "MGTransportSolver.hh"
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+/**
+ *  @class MGSolverJacobi
+ *  @brief Solves the multigroup transport equation via group Jacobi.
+ *
+ *  The first pass through the groups is identical to Gauss-Seidel.  Within
+ *  the upscatter block, however, each group is solved using the in-scatter
+ *  source of the previous outer iteration only, so that all groups of the
+ *  block are independent and are solved concurrently.  Each thread owns a
+ *  copy of the state and a within-group solver (with its own sweep source,
+ *  sweeper, and equations) built on that copy.  At the start of an outer,
+ *  the thread states receive the current moments, and at the end, the
+ *  new group moments (and angular fluxes, if stored) are gathered back.
+ *
+ *  Jacobi typically needs more outers than Gauss-Seidel, but for problems
+ *  with many thermal groups, the concurrency more than makes up for it.
+ *
+ *  Relevant db entries:
+ *  - outer_norm_type (str) [default = "Linf"]
+ */
+/**
+ *  @example solvers/test/test_MGSolverJacobi
+ */
+//----------------------------------------------------------------------------//
+
+template <class D>
+class MGSolverJacobi: public MGTransportSolver<D>
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef MGTransportSolver<D>                      Base;
+  typedef typename Base::SP_solver                  SP_solver;
+  typedef typename Base::SP_wg_solver               SP_wg_solver;
+  typedef typename Base::SP_input                   SP_input;
+  typedef typename Base::SP_state                   SP_state;
+  typedef typename Base::SP_mesh                    SP_mesh;
+  typedef typename Base::SP_material                SP_material;
+  typedef typename Base::SP_quadrature              SP_quadrature;
+  typedef typename Base::SP_boundary                SP_boundary;
+  typedef typename Base::SP_externalsource          SP_externalsource;
+  typedef typename Base::vec_externalsource         vec_externalsource;
+  typedef typename Base::SP_fissionsource           SP_fissionsource;
+  typedef typename Base::size_t                     size_t;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
+  typedef detran_utilities::vec_int                 vec_int;
+  typedef detran_utilities::vec_size_t              vec_size_t;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param state             State vectors, etc.
+   *  @param material          Material definitions.
+   *  @param boundary          Boundary fluxes.
+   *  @param q_e               Vector of user-defined external sources
+   *  @param q_f               Fission source.
+   *  @param multiply          Flag for a multiplying fixed source problem
+   */
+  MGSolverJacobi(SP_state                   state,
+                 SP_material                material,
+                 SP_boundary                boundary,
+                 const vec_externalsource  &q_e,
+                 SP_fissionsource           q_f,
+                 bool                       multiply = false);
+
+  //--------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL MULTIGROUP SOLVERS MUST IMPLEMENT
+  //--------------------------------------------------------------------------//
+
+  /// Solve the multigroup equations.
+  void solve(const double keff = 1.0);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Return number of sweeps, including those of all threads
+  int number_sweeps() const;
+
+  /// Return number of threads used for the upscatter block
+  int number_threads() const {return d_thread_solvers.size();}
+
+  /// Return number of outer iterations in the last solve
+  int number_iterations() const {return d_number_iterations;}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  // Expose base members.
+  using Base::d_input;
+  using Base::d_state;
+  using Base::d_mesh;
+  using Base::d_material;
+  using Base::d_quadrature;
+  using Base::d_boundary;
+  using Base::d_externalsources;
+  using Base::d_fissionsource;
+  using Base::d_downscatter;
+  using Base::d_number_groups;
+  using Base::d_maximum_iterations;
+  using Base::d_tolerance;
+  using Base::d_print_level;
+  using Base::d_print_interval;
+  using Base::d_adjoint;
+  using Base::d_wg_solver;
+  using Base::d_multiply;
+
+  /// Lower bound of energy loop
+  int d_lower;
+  /// Lower bound of energy loop for upscatter iterations
+  int d_lower_upscatter;
+  /// Upper bound of energy loop
+  int d_upper;
+  /// Flag to indicate upscatter iteration is required.
+  bool d_iterate;
+  /// Determines which norm to use (default is Linf)
+  std::string d_norm_type;
+  /// Thread copies of the state
+  std::vector<SP_state> d_thread_states;
+  /// Thread within-group solvers, each built on its thread state
+  std::vector<SP_wg_solver> d_thread_solvers;
+  /// Number of outer iterations in the last solve
+  int d_number_iterations;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Solve all groups of the block once, concurrently, from the old fluxes
+  void jacobi_sweep(const vec_size_t &groups);
+
+};
+
+} // namespace detran
+
+//----------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//----------------------------------------------------------------------------//
+
+#include "MGSolverJacobi.i.hh"
+
+#endif /* detran_MGSOLVERJACOBI_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file MGSolverJacobi.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  MGSolverJacobi.i.hh
+ *  @brief MGSolverJacobi inline member definitions
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_MGSOLVERJACOBI_I_HH_
+#define detran_MGSOLVERJACOBI_I_HH_
+
+#include "detran_config.hh"
+#include "utilities/MathUtilities.hh"
+#include "utilities/Warning.hh"
+#include <cstdio>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+template <class D>
+void MGSolverJacobi<D>::solve(const double keff)
+{
+  using detran_utilities::norm;
+  using detran_utilities::norm_residual;
+  using detran_utilities::range;
+
+  // Norm of the group-wise residuals and the total residual norm
+  vec_dbl nres(d_number_groups, 0.0);
+  double nres_tot = 0;
+
+  // Set the scaling factor for multiplying problems
+  if (d_multiply) d_fissionsource->setup_outer(1.0 / keff);
+
+  // Initial Gauss-Seidel sweep through all groups.
+  vec_size_t groups = range<size_t>(d_lower, d_upper);
+  for (size_t i = 0; i < groups.size(); ++i)
+    d_wg_solver->solve(groups[i]);
+
+  // Perform upscatter iterations.
+  size_t iteration = 0;
+  if (d_iterate)
+  {
+    groups = range<size_t>(d_lower_upscatter, d_upper);
+
+    for (iteration = 1; iteration <= d_maximum_iterations; ++iteration)
+    {
+      detran_utilities::vec_scale(nres, 0.0);
+
+      // Save current group flux.
+      State::group_moments_type phi_old = d_state->all_phi();
+
+      // Solve the block concurrently.
+      jacobi_sweep(groups);
+
+      for (size_t i = 0; i < groups.size(); ++i)
+      {
+        size_t g = groups[i];
+        nres[g] = norm_residual(d_state->phi(g), phi_old[g], d_norm_type);
+      }
+      nres_tot = norm(nres, d_norm_type);
+
+      if (d_print_level > 1  && iteration % d_print_interval == 0)
+      {
+        printf("  Jacobi Iter: %3i  Error: %12.9f \n",
+               (int)iteration, nres_tot);
+      }
+      if (nres_tot < d_tolerance) break;
+
+    } // end upscatter iterations
+
+    if (nres_tot > d_tolerance)
+    {
+      detran_utilities::warning(detran_utilities::SOLVER_CONVERGENCE,
+        "Jacobi upscatter did not converge.");
+    }
+
+  } // end upscatter block
+  d_number_iterations = iteration;
+
+  // Diagnostic output
+  if (d_print_level > 0)
+  {
+    printf("  Jacobi Final: Number Iters: %3i  Error: %12.9f  Sweeps: %6i \n",
+           (int)iteration, nres_tot, number_sweeps());
+  }
+}
+
+//----------------------------------------------------------------------------//
+template <class D>
+void MGSolverJacobi<D>::jacobi_sweep(const vec_size_t &groups)
+{
+  // Give each thread the moments of the last outer.
+  for (size_t t = 0; t < d_thread_states.size(); ++t)
+    d_thread_states[t]->all_phi() = d_state->all_phi();
+
+  // New group moments.  A thread restores the old moments of each group
+  // it solves so that its next group sees only the last outer's fluxes.
+  State::group_moments_type phi(d_number_groups);
+  int number_groups = groups.size();
+
+  #pragma omp parallel for default(shared) schedule(dynamic) \
+    num_threads(d_thread_solvers.size())
+  for (int i = 0; i < number_groups; ++i)
+  {
+#ifdef DETRAN_ENABLE_OPENMP
+    int t = omp_get_thread_num();
+#else
+    int t = 0;
+#endif
+    size_t g = groups[i];
+    State &s = *d_thread_states[t];
+    d_thread_solvers[t]->solve(g);
+    phi[g] = s.phi(g);
+    s.phi(g) = d_state->phi(g);
+    if (!d_state->store_angular_flux()) continue;
+    for (size_t o = 0; o < d_quadrature->number_octants(); ++o)
+      for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
+        d_state->psi(g, o, a) = s.psi(g, o, a);
+  }
+
+  // Synchronize the shared state.
+  for (size_t i = 0; i < groups.size(); ++i)
+    d_state->phi(groups[i]).swap(phi[groups[i]]);
+}
+
+} // end namespace detran
+
+#endif /* detran_MGSOLVERJACOBI_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file MGSolverJacobi.i.hh
+//----------------------------------------------------------------------------//
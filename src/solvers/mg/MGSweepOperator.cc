@@ -6,8 +6,12 @@
  */
 //----------------------------------------------------------------------------//
 
+#include "detran_config.hh"
 #include "MGSweepOperator.hh"
 #include "utilities/MathUtilities.hh"
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran
 {
@@ -31,6 +35,7 @@ MGSweepOperator<D>::MGSweepOperator(SP_state        state,
   , d_moments_size(0)
   , d_boundary_size(0)
   , d_adjoint(adjoint)
+  , d_nested_threads(false)
 {
   Require(d_state);
   Require(d_boundary);
@@ -85,62 +90,106 @@ void MGSweepOperator<D>::multiply(const Vector &x,  Vector &y)
   // where psi is the boundary angular flux, present only if there
   // are reflective conditions
 
-  // sweep each applicable group
-  for (groups_iter g = d_groups.begin(); g != d_groups.end(); ++g)
+  // sweep each applicable group, concurrently if threads are set
+  if (d_thread_sweepers.empty())
   {
-    // group index in applicable set
-    int g_index  = d_adjoint ? *g : *g - d_krylov_group_cutoff;
-    // moment offset, the starting moment index within the Krylov vector
-    int m_offset = g_index * d_moments_size;
-    // boundary offset, the starting boundary index within the Krylov vector
-    int b_offset = d_number_active_groups * d_moments_size +
-                   g_index * d_boundary_size;
-
-    // reset the source and place the original outgoing boundary flux.
-    d_boundary->clear(*g);
-
-    if (d_boundary->has_reflective())
-    {
-      // set the incident boundary flux.
-      d_boundary->psi(*g, const_cast<double*>(&x[0]) + b_offset,
-                      BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
-    }
+    for (groups_iter g = d_groups.begin(); g != d_groups.end(); ++g)
+      multiply_group(*g, x, y, d_sweeper, d_sweepsource);
+    return;
+  }
+
+#ifdef DETRAN_ENABLE_OPENMP
+  int max_levels = omp_get_max_active_levels();
+  if (d_nested_threads) omp_set_max_active_levels(2);
+#endif
+  int number_groups = d_groups.size();
+  #pragma omp parallel for default(shared) schedule(dynamic) \
+    num_threads(d_thread_sweepers.size())
+  for (int i = 0; i < number_groups; ++i)
+  {
+#ifdef DETRAN_ENABLE_OPENMP
+    int t = omp_get_thread_num();
+#else
+    int t = 0;
+#endif
+    multiply_group(d_groups[i], x, y, d_thread_sweepers[t],
+                   d_thread_sweepsources[t]);
+  }
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_max_active_levels(max_levels);
+#endif
+}
 
-    // reset the sweep source to zero and fill it with the input vector.
-    d_sweepsource->reset();
-    moments_type &Q = d_sweepsource->fixed_group_source();
-    for (int i = 0; i < d_moments_size; ++i)
-      Q[i] = x[i + m_offset];
+//----------------------------------------------------------------------------//
+template <class D>
+void MGSweepOperator<D>::set_group_threads(const vec_sweeper     &sweepers,
+                                           const vec_sweepsource &sources,
+                                           bool                   nested)
+{
+  Require(sweepers.size() == sources.size());
+  d_thread_sweepers     = sweepers;
+  d_thread_sweepsources = sources;
+  d_nested_threads      = nested;
+}
 
-    // copy group flux for sweep
-    typename State::moments_type phi_g(Q);
+//----------------------------------------------------------------------------//
+template <class D>
+void MGSweepOperator<D>::multiply_group(const size_t    g,
+                                        const Vector   &x,
+                                        Vector         &y,
+                                        SP_sweeper      sweeper,
+                                        SP_sweepsource  source)
+{
+  // group index in applicable set
+  int g_index  = d_adjoint ? g : g - d_krylov_group_cutoff;
+  // moment offset, the starting moment index within the Krylov vector
+  int m_offset = g_index * d_moments_size;
+  // boundary offset, the starting boundary index within the Krylov vector
+  int b_offset = d_number_active_groups * d_moments_size +
+                 g_index * d_boundary_size;
+
+  // reset the source and place the original outgoing boundary flux.
+  d_boundary->clear(g);
+
+  if (d_boundary->has_reflective())
+  {
+    // set the incident boundary flux.
+    d_boundary->psi(g, const_cast<double*>(&x[0]) + b_offset,
+                    BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
+  }
 
-    // set the sweeper and sweep.
-    d_sweeper->setup_group(*g);
-    d_sweeper->sweep(phi_g);
+  // reset the sweep source to zero and fill it with the input vector.
+  source->reset();
+  moments_type &Q = source->fixed_group_source();
+  for (int i = 0; i < d_moments_size; ++i)
+    Q[i] = x[i + m_offset];
 
-    // assign the moment values.
-    for (int i = 0; i < d_moments_size; i++)
-      y[i + m_offset] = phi_g[i];
+  // copy group flux for sweep
+  typename State::moments_type phi_g(Q);
 
-    // assign boundary fluxes, if applicable
-    if (d_boundary->has_reflective())
-    {
-      // update the boundary (redirect outgoing as incident)
-      d_boundary->update(*g);
+  // set the sweeper and sweep.
+  sweeper->setup_group(g);
+  sweeper->sweep(phi_g);
 
-      // extract the incident boundary
-      State::angular_flux_type psi_update(d_boundary_size, 0.0);
-      d_boundary->psi(*g, &psi_update[0],
-                      BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
+  // assign the moment values.
+  for (int i = 0; i < d_moments_size; i++)
+    y[i + m_offset] = phi_g[i];
 
-      // add the boundary values.
-      for (int a = 0; a < d_boundary_size; ++a)
-        y[a + b_offset] = psi_update[a];
-    }
+  // assign boundary fluxes, if applicable
+  if (d_boundary->has_reflective())
+  {
+    // update the boundary (redirect outgoing as incident)
+    d_boundary->update(g);
 
-  } // end groups
+    // extract the incident boundary
+    State::angular_flux_type psi_update(d_boundary_size, 0.0);
+    d_boundary->psi(g, &psi_update[0],
+                    BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
 
+    // add the boundary values.
+    for (int a = 0; a < d_boundary_size; ++a)
+      y[a + b_offset] = psi_update[a];
+  }
 }
 
 //----------------------------------------------------------------------------//
@@ -48,6 +48,8 @@ public:
   typedef groups_t::iterator                          groups_iter;
   typedef typename Sweeper<D>::SP_sweeper             SP_sweeper;
   typedef typename SweepSource<D>::SP_sweepsource     SP_sweepsource;
+  typedef std::vector<SP_sweeper>                     vec_sweeper;
+  typedef std::vector<SP_sweepsource>                 vec_sweepsource;
   typedef State::moments_type                         moments_type;
   typedef callow::Vector                              Vector;
 
@@ -64,6 +66,31 @@ public:
   /// Virtual destructor
   virtual ~MGSweepOperator(){}
 
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Sweep the groups concurrently
+   *
+   *  The sweeps of all groups within one application are independent.
+   *  Given one sweeper and sweep source per thread (each with its own
+   *  equations and source buffers, typically built on a copy of the
+   *  state), the groups are divided among the threads, which share only
+   *  the per-group boundary fluxes.  The sweepers' angle threading is
+   *  kept only if nested threading is requested.
+   *
+   *  @param sweepers   one sweeper per thread
+   *  @param sources    one sweep source per thread
+   *  @param nested     flag to allow nested angle threading
+   */
+  void set_group_threads(const vec_sweeper      &sweepers,
+                         const vec_sweepsource  &sources,
+                         bool                    nested = false);
+
+  /// Number of threads sweeping groups concurrently (zero if serial)
+  size_t number_group_threads() const { return d_thread_sweepers.size(); }
+
   //--------------------------------------------------------------------------//
   // ABSTRACT INTERFACE -- ALL MATRICES MUST IMPLEMENT THESE
   //--------------------------------------------------------------------------//
@@ -105,6 +132,23 @@ private:
   bool d_adjoint;
   /// Lower group bound
   groups_t d_groups;
+  /// Thread sweepers for concurrent groups
+  vec_sweeper d_thread_sweepers;
+  /// Thread sweep sources for concurrent groups
+  vec_sweepsource d_thread_sweepsources;
+  /// Flag to allow nested angle threading
+  bool d_nested_threads;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Apply the operator to the unknowns of one group
+  void multiply_group(const size_t    g,
+                      const Vector   &x,
+                      Vector         &y,
+                      SP_sweeper      sweeper,
+                      SP_sweepsource  source);
 
 
 };
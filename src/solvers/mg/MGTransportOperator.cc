@@ -6,8 +6,12 @@
  */
 //----------------------------------------------------------------------------//
 
+#include "detran_config.hh"
 #include "MGTransportOperator.hh"
 #include "utilities/MathUtilities.hh"
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran
 {
@@ -31,6 +35,7 @@ MGTransportOperator<D>::MGTransportOperator(SP_state        state,
   , d_moments_size(0)
   , d_boundary_size(0)
   , d_adjoint(adjoint)
+  , d_nested_threads(false)
 {
   Require(d_state);
   Require(d_boundary);
@@ -111,62 +116,107 @@ void MGTransportOperator<D>::multiply(const Vector &x,  Vector &y)
       phi[*g_it][i] = x[i + offset];
   }
 
-  // sweep each applicable group
-  for (groups_iter g = d_groups.begin(); g != d_groups.end(); ++g)
+  // sweep each applicable group, concurrently if threads are set
+  if (d_thread_sweepers.empty())
   {
-    // group index in applicable set
-    int g_index  = d_adjoint ? *g : *g - d_krylov_group_cutoff;
-    // moment offset, the starting moment index within the Krylov vector
-    int m_offset = g_index * d_moments_size;
-    // boundary offset, the starting boundary index within the Krylov vector
-    int b_offset = d_number_active_groups * d_moments_size +
-                   g_index * d_boundary_size;
-
-    // reset the source and place the original outgoing boundary flux.
-    d_boundary->clear(*g);
-
-    if (d_boundary->has_reflective())
-    {
-      // set the incident boundary flux.
-      d_boundary->psi(*g, const_cast<double*>(&x[0]) + b_offset,
-                      BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
-    }
+    for (groups_iter g = d_groups.begin(); g != d_groups.end(); ++g)
+      multiply_group(*g, x, y, d_sweeper, d_sweepsource, phi);
+    return;
+  }
+
+#ifdef DETRAN_ENABLE_OPENMP
+  int max_levels = omp_get_max_active_levels();
+  if (d_nested_threads) omp_set_max_active_levels(2);
+#endif
+  int number_groups = d_groups.size();
+  #pragma omp parallel for default(shared) schedule(dynamic) \
+    num_threads(d_thread_sweepers.size())
+  for (int i = 0; i < number_groups; ++i)
+  {
+#ifdef DETRAN_ENABLE_OPENMP
+    int t = omp_get_thread_num();
+#else
+    int t = 0;
+#endif
+    multiply_group(d_groups[i], x, y, d_thread_sweepers[t],
+                   d_thread_sweepsources[t], phi);
+  }
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_max_active_levels(max_levels);
+#endif
+}
 
-    // reset the source to zero.
-    d_sweepsource->reset();
-    d_sweepsource->build_total_scatter(*g, d_krylov_group_cutoff, phi);
+//----------------------------------------------------------------------------//
+template <class D>
+void MGTransportOperator<D>::set_group_threads(const vec_sweeper     &sweepers,
+                                               const vec_sweepsource &sources,
+                                               bool                   nested)
+{
+  Require(sweepers.size() == sources.size());
+  d_thread_sweepers     = sweepers;
+  d_thread_sweepsources = sources;
+  d_nested_threads      = nested;
+}
 
-    // copy group flux for sweep
-    typename State::moments_type phi_g(phi[*g]);
+//----------------------------------------------------------------------------//
+template <class D>
+void MGTransportOperator<D>::multiply_group(const size_t                   g,
+                                            const Vector                  &x,
+                                            Vector                        &y,
+                                            SP_sweeper                     sweeper,
+                                            SP_sweepsource                 source,
+                                            const State::vec_moments_type &phi)
+{
+  // group index in applicable set
+  int g_index  = d_adjoint ? g : g - d_krylov_group_cutoff;
+  // moment offset, the starting moment index within the Krylov vector
+  int m_offset = g_index * d_moments_size;
+  // boundary offset, the starting boundary index within the Krylov vector
+  int b_offset = d_number_active_groups * d_moments_size +
+                 g_index * d_boundary_size;
+
+  // reset the source and place the original outgoing boundary flux.
+  d_boundary->clear(g);
+
+  if (d_boundary->has_reflective())
+  {
+    // set the incident boundary flux.
+    d_boundary->psi(g, const_cast<double*>(&x[0]) + b_offset,
+                    BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
+  }
 
-    // set the sweeper and sweep.
-    d_sweepsource->set_discrete_external_source_flag(false);
-    d_sweeper->setup_group(*g);
-    d_sweeper->sweep(phi_g);
-    d_sweepsource->set_discrete_external_source_flag(true);
+  // reset the source to zero.
+  source->reset();
+  source->build_total_scatter(g, d_krylov_group_cutoff, phi);
 
-    // assign the moment values.
-    for (int i = 0; i < d_moments_size; i++)
-      y[i + m_offset] = x[i + m_offset] - phi_g[i];
+  // copy group flux for sweep
+  typename State::moments_type phi_g(phi[g]);
 
-    // assign boundary fluxes, if applicable
-    if (d_boundary->has_reflective())
-    {
-      // update the boundary (redirect outgoing as incident)
-      d_boundary->update(*g);
+  // set the sweeper and sweep.
+  source->set_discrete_external_source_flag(false);
+  sweeper->setup_group(g);
+  sweeper->sweep(phi_g);
+  source->set_discrete_external_source_flag(true);
 
-      // extract the incident boundary
-      State::angular_flux_type psi_update(d_boundary_size, 0.0);
-      d_boundary->psi(*g, &psi_update[0],
-                      BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
+  // assign the moment values.
+  for (int i = 0; i < d_moments_size; i++)
+    y[i + m_offset] = x[i + m_offset] - phi_g[i];
 
-      // add the boundary values.
-      for (int a = 0; a < d_boundary_size; a++)
-        y[a + b_offset] = x[a + b_offset] - psi_update[a];
-    }
+  // assign boundary fluxes, if applicable
+  if (d_boundary->has_reflective())
+  {
+    // update the boundary (redirect outgoing as incident)
+    d_boundary->update(g);
 
-  } // end groups
+    // extract the incident boundary
+    State::angular_flux_type psi_update(d_boundary_size, 0.0);
+    d_boundary->psi(g, &psi_update[0],
+                    BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
 
+    // add the boundary values.
+    for (int a = 0; a < d_boundary_size; a++)
+      y[a + b_offset] = x[a + b_offset] - psi_update[a];
+  }
 }
 
 //----------------------------------------------------------------------------//
@@ -29,29 +29,41 @@ MGTransportSolver<D>::MGTransportSolver(SP_state                  state,
   d_quadrature = d_state->get_quadrature();
   Ensure(d_quadrature);
 
+  // Create the inner solver on the shared state.
+  d_wg_solver = create_wg_solver(d_state);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+typename MGTransportSolver<D>::SP_wg_solver
+MGTransportSolver<D>::create_wg_solver(SP_state state)
+{
+  Require(state);
+
   // Get the inner solver type and create.
   std::string wg_solver = "SI";
   if (d_input->check("inner_solver"))
   {
     wg_solver = d_input->template get<std::string>("inner_solver");
   }
+  SP_wg_solver solver;
   if (wg_solver == "SI")
   {
-    d_wg_solver = new WGSolverSI<D>(d_state, d_material, d_quadrature,
-                                    d_boundary, d_externalsources,
-                                    d_fissionsource, d_multiply);
+    solver = new WGSolverSI<D>(state, d_material, d_quadrature,
+                               d_boundary, d_externalsources,
+                               d_fissionsource, d_multiply);
   }
   else if (wg_solver == "GMRES")
   {
-    d_wg_solver = new WGSolverGMRES<D>(d_state, d_material, d_quadrature,
-                                       d_boundary, d_externalsources,
-                                       d_fissionsource, d_multiply);
+    solver = new WGSolverGMRES<D>(state, d_material, d_quadrature,
+                                  d_boundary, d_externalsources,
+                                  d_fissionsource, d_multiply);
   }
   else
   {
     THROW("Unsupported inner solver type selected: " + wg_solver);
   }
-
+  return solver;
 }
 
 //---------------------------------------------------------------------------//
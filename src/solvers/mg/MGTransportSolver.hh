@@ -121,6 +121,16 @@ protected:
   /// Inner solver
   SP_wg_solver d_wg_solver;
 
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Create a within-group solver of the selected inner type
+   *  @param state  State vectors the solver reads and updates
+   */
+  SP_wg_solver create_wg_solver(SP_state state);
+
 };
 
 } // namespace detran
@@ -0,0 +1,199 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_BlockSweep.cc
+ *  @brief Test of block sweeps and block within-group solves
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                    \
+        FUNC(test_BlockSweep_1D)     \
+        FUNC(test_BlockSweep_2D)     \
+        FUNC(test_BlockSweep_3D)     \
+        FUNC(test_BlockSweep_manager)
+
+#include "TestDriver.hh"
+#include "solvers/FixedSourceManager.hh"
+#include "solvers/wg/WGSolverGMRES.hh"
+#include "external_source/IsotropicSource.hh"
+#include "boundary/BoundarySN.hh"
+#include "boundary/FixedBoundary.hh"
+#include "solvers/test/fixedsource_fixture.hh"
+#include <cmath>
+
+using namespace detran_test;
+using namespace detran;
+using namespace detran_utilities;
+using namespace std;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/// Compare block and single solves of one group with several sources.
+template <class D>
+int compare()
+{
+  typedef WGSolverGMRES<D>                    Solver_T;
+  typedef typename Solver_T::vec_externalsource vec_externalsource;
+  typedef callow::Vector::SP_vector           SP_vector;
+
+  FixedSourceData data =
+    get_fixedsource_data(D::dimension, 1, D::dimension == 1 ? 20 : 4);
+  data.input->put<std::string>("inner_solver",    "GMRES");
+  data.input->put<double>("inner_tolerance",      1e-12);
+  data.input->put<int>("inner_max_iters",         1000);
+  FixedSourceManager<D> manager(data.input, data.material, data.mesh);
+  manager.setup();
+  typename FixedSourceManager<D>::SP_state state = manager.state();
+  int n = data.mesh->number_cells();
+
+  // A uniform source, a smooth one, a point source, and a repeat of the
+  // first, which makes the block dependent.
+  int m = 4;
+  State::vec_moments_type q(m, State::moments_type(n, 1.0));
+  for (int i = 0; i < n; ++i)
+    q[1][i] = 1.0 + std::sin(0.3 * i);
+  q[2].assign(n, 0.0);
+  q[2][n / 2] = 10.0;
+
+  // Block solve.
+  vec_externalsource q_none;
+  Solver_T block(state, manager.material(), manager.quadrature(),
+                 manager.boundary(), q_none,
+                 typename Solver_T::SP_fissionsource(0), false);
+  State::vec_moments_type phi(m);
+  block.solve_block(0, q, phi);
+  TEST(block.block_solver()->status() == callow::SUCCESS);
+
+  // Single solves for reference.
+  vec_int map(n, 0);
+  for (int i = 0; i < n; ++i)
+    map[i] = i;
+  for (int s = 0; s < m; ++s)
+  {
+    vec2_dbl spectra(n, vec_dbl(1, 0.0));
+    for (int i = 0; i < n; ++i)
+      spectra[i][0] = q[s][i];
+    vec_externalsource q_e(1, IsotropicSource::Create(1, data.mesh,
+                                                      spectra, map));
+    Solver_T single(state, manager.material(), manager.quadrature(),
+                    manager.boundary(), q_e,
+                    typename Solver_T::SP_fissionsource(0), false);
+    single.solve(0);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(phi[s][i], state->phi(0)[i], 1.0e-9));
+  }
+  printf(" block iterations: %i\n", block.block_solver()->number_iterations());
+
+  // The block operator must agree with the single one.
+  Solver_T ref(state, manager.material(), manager.quadrature(),
+               manager.boundary(), q_none,
+               typename Solver_T::SP_fissionsource(0), false);
+  WGTransportOperator<D> A(state, manager.boundary(),
+                           ref.get_sweeper(), ref.get_sweepsource());
+  std::vector<SP_vector> x(m), y(m);
+  for (int s = 0; s < m; ++s)
+  {
+    x[s] = new callow::Vector(n, 0.0);
+    y[s] = new callow::Vector(n, 0.0);
+    for (int i = 0; i < n; ++i)
+      (*x[s])[i] = q[s][i];
+  }
+  A.multiply_block(x, y);
+  callow::Vector y_s(n, 0.0);
+  for (int s = 0; s < m; ++s)
+  {
+    A.multiply(*x[s], y_s);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv((*y[s])[i], y_s[i], 1.0e-12));
+  }
+  return 0;
+}
+
+int test_BlockSweep_1D(int argc, char *argv[])
+{
+  return compare<_1D>();
+}
+
+int test_BlockSweep_2D(int argc, char *argv[])
+{
+  return compare<_2D>();
+}
+
+int test_BlockSweep_3D(int argc, char *argv[])
+{
+  return compare<_3D>();
+}
+
+int test_BlockSweep_manager(int argc, char *argv[])
+{
+  typedef FixedSourceManager<_2D>             Manager_T;
+  typedef Manager_T::vec_source               vec_source;
+
+  // Seven groups with upscatter.  Problem 0 has a uniform volume source,
+  // and problem 1 has a fixed incident flux on the west side.
+  FixedSourceData data[2];
+  Manager_T::SP_manager manager[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    data[k] = get_fixedsource_data(2, 7, 3);
+    data[k].input->put<std::string>("inner_solver",  "GMRES");
+    data[k].input->put<double>("inner_tolerance",    1e-12);
+    data[k].input->put<int>("inner_max_iters",       1000);
+    data[k].input->put<double>("outer_tolerance",    1e-12);
+    data[k].input->put<int>("outer_max_iters",       1000);
+    data[k].input->put<int>("outer_print_level",     0);
+    if (k == 1) data[k].input->put<std::string>("bc_west", "fixed");
+    manager[k] = new Manager_T(data[k].input, data[k].material,
+                               data[k].mesh);
+    manager[k]->setup();
+  }
+  BoundarySN<_2D> &b = dynamic_cast<BoundarySN<_2D>&>(*manager[1]->boundary());
+  FixedBoundary<_2D> &west = dynamic_cast<FixedBoundary<_2D>&>(*b.bc(0));
+  for (int g = 0; g < 7; ++g)
+    for (int o = 0; o < 2; ++o)
+      for (int a = 0; a < manager[1]->quadrature()->number_angles_octant(); ++a)
+        west(o, a, g).assign(west(o, a, g).size(), 1.0 / (1.0 + g));
+
+  // Reference solutions, one problem at a time.
+  manager[0]->set_source(data[0].source);
+  State::group_moments_type phi_ref[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    manager[k]->set_solver();
+    manager[k]->solve();
+    phi_ref[k] = manager[k]->state()->all_phi();
+  }
+
+  // Both problems at once.
+  std::vector<vec_source> sources(2);
+  sources[0].push_back(data[0].source);
+  Manager_T::vec_boundary boundaries(2);
+  boundaries[1] = manager[1]->boundary();
+  std::vector<State::vec_moments_type> phi;
+  Manager_T block(data[0].input, data[0].material, data[0].mesh);
+  block.setup();
+  TEST(block.solve_block(sources, boundaries, phi));
+  TEST(phi.size() == 2);
+  TEST(phi[1][0][0] > 0.0);
+  for (int k = 0; k < 2; ++k)
+    for (int g = 0; g < 7; ++g)
+      for (int i = 0; i < data[0].mesh->number_cells(); ++i)
+        TEST(soft_equiv(phi[k][g][i], phi_ref[k][g][i], 1.0e-8));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_BlockSweep.cc
+//----------------------------------------------------------------------------//
@@ -10,7 +10,8 @@
 #define TEST_LIST                              \
         FUNC(test_EigenArnoldi_1g)                  \
         FUNC(test_EigenArnoldi_7g_forward)          \
-        FUNC(test_EigenArnoldi_7g_adjoint)
+        FUNC(test_EigenArnoldi_7g_adjoint)          \
+        FUNC(test_EigenArnoldi_7g_krylovschur)
 
 #include "TestDriver.hh"
 #include "solvers/EigenvalueManager.hh"
@@ -90,6 +91,34 @@ int test_EigenArnoldi_7g_adjoint(int argc, char *argv[])
   return 0;
 }
 
+int test_EigenArnoldi_7g_krylovschur(int argc, char *argv[])
+{
+  EigenvalueData data = get_eigenvalue_data(1, 7);
+  data.input->put<std::string>("eigen_solver", "arnoldi");
+  InputDB::SP_input db = InputDB::Create("eigen_solver_db");
+  db->put<std::string>("eigen_solver_type",  "krylovschur");
+  db->put<double>("eigen_solver_tol",        1e-9);
+  db->put<int>("eigen_solver_subspace_size", 10);
+  db->put<int>("eigen_number_values",        2);
+  data.input->put<InputDB::SP_input>("eigen_solver_db", db);
+  EigenvalueManager<_1D> manager(data.input, data.material, data.mesh);
+  manager.solve();
+  double ref[] =
+  { 7.641447918995387e-02, 9.959998182719878e-01, 4.630704325129503e-02,
+      9.200150683392864e-04, 2.626285787433469e-05, 3.927767793415337e-07,
+      8.670823991668230e-09 };
+  vec_dbl phi(7, 0.0);
+  for (int g = 0; g < 7; ++g) phi[g] = manager.state()->phi(g)[0];
+  detran_utilities::vec_scale(phi, 1.0 / detran_utilities::norm(phi, "L2"));
+  for (int g = 0; g < 7; ++g)
+  {
+    printf("%4i %20.12e  %20.12e \n", g, ref[g], phi[g]);
+    TEST(soft_equiv(ref[g], phi[g], 1.0e-8));
+  }
+  TEST(soft_equiv(1.038797451683334, manager.state()->eigenvalue(), 1.0e-8));
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_EigenArnoldi.cc
 //----------------------------------------------------------------------------//
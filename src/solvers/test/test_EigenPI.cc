@@ -10,10 +10,12 @@
 #define TEST_LIST                              \
         FUNC(test_EigenPI_1g)                  \
         FUNC(test_EigenPI_7g_forward)          \
-        FUNC(test_EigenPI_7g_adjoint)
+        FUNC(test_EigenPI_7g_adjoint)          \
+        FUNC(test_EigenPI_7g_anderson)
 
 #include "TestDriver.hh"
 #include "solvers/EigenvalueManager.hh"
+#include "solvers/eigen/EigenPI.hh"
 #include "solvers/test/eigenvalue_fixture.hh"
 #include "utilities/MathUtilities.hh"
 
@@ -90,6 +92,41 @@ int test_EigenPI_7g_adjoint(int argc, char *argv[])
   return 0;
 }
 
+int test_EigenPI_7g_anderson(int argc, char *argv[])
+{
+  // Anderson mixing of the density must give the same eigenvalue in
+  // fewer power iterations.  A thick slab with one vacuum side has a
+  // dominance ratio near one, unlike the reflected fixture.
+  int iterations[2];
+  double keff[2];
+  for (int depth = 0; depth < 2; ++depth)
+  {
+    EigenvalueData data = get_eigenvalue_data(1, 7);
+    vec_dbl cm(2, 0.0); cm[1] = 100.0;
+    vec_int fm(1, 50);
+    vec_int mt(1, 2);
+    data.mesh = Mesh1D::Create(fm, cm, mt);
+    data.input->put<std::string>("eigen_solver", "PI");
+    data.input->put<std::string>("bc_east", "vacuum");
+    data.input->put<double>("inner_tolerance", 1e-12);
+    data.input->put<double>("outer_tolerance", 1e-12);
+    data.input->put<double>("eigen_tolerance", 1e-10);
+    data.input->put<int>("outer_print_level", 0);
+    data.input->put<int>("eigen_pi_anderson_depth", 5 * depth);
+    EigenvalueManager<_1D> manager(data.input, data.material, data.mesh);
+    manager.solve();
+    EigenPI<_1D> &solver = *dynamic_cast<EigenPI<_1D>*>(manager.solver().bp());
+    iterations[depth] = solver.number_iterations();
+    keff[depth] = manager.state()->eigenvalue();
+    printf(" anderson depth: %2i  power iterations: %4i  sweeps: %6i "
+           " keff: %16.12f \n", 5 * depth, iterations[depth],
+           manager.number_sweeps(), keff[depth]);
+  }
+  TEST(soft_equiv(keff[0], keff[1], 1.0e-8));
+  TEST(iterations[1] < iterations[0]);
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_EigenPI.cc
 //----------------------------------------------------------------------------//
@@ -12,10 +12,13 @@
         FUNC(test_MGDiffusionSolver_7g_forward)          \
         FUNC(test_MGDiffusionSolver_7g_forward_multiply) \
         FUNC(test_MGDiffusionSolver_7g_adjoint)          \
-        FUNC(test_MGDiffusionSolver_7g_adjoint_multiply)
+        FUNC(test_MGDiffusionSolver_7g_adjoint_multiply) \
+        FUNC(test_MGDiffusionSolver_block)               \
+        FUNC(test_MGDiffusionSolver_refresh)
 
 #include "TestDriver.hh"
 #include "solvers/FixedSourceManager.hh"
+#include "solvers/mg/MGDiffusionSolver.hh"
 #include "solvers/test/fixedsource_fixture.hh"
 
 using namespace detran_test;
@@ -150,6 +153,128 @@ int test_MGDiffusionSolver_7g_adjoint_multiply(int argc, char *argv[])
   return 0;
 }
 
+/// Solve a 7 group problem with the full operator or by group blocks
+template <class D>
+State::SP_state solve_7g(const int  dim,
+                         const bool block,
+                         const bool adjoint,
+                         const bool multiply,
+                         int       &iterations)
+{
+  FixedSourceData data = get_fixedsource_data(dim, 7);
+  data.input->put<std::string>("equation", "diffusion");
+  data.input->put<std::string>("bc_west", "reflect");
+  data.input->put<std::string>("bc_east", "vacuum");
+  data.input->put<double>("outer_tolerance", 1e-12);
+  data.input->put<int>("outer_max_iters", 1000);
+  data.input->put<int>("adjoint", adjoint);
+  if (block)
+    data.input->put<std::string>("diffusion_solver_type", "block");
+  FixedSourceManager<D> manager(data.input, data.material, data.mesh,
+                                multiply);
+  manager.setup();
+  manager.set_source(data.source);
+  manager.set_solver();
+  manager.solve();
+  iterations = 0;
+  if (block)
+  {
+    MGDiffusionSolver<D> *solver =
+      dynamic_cast<MGDiffusionSolver<D>*>(manager.solver().bp());
+    iterations = solver->number_block_iterations();
+  }
+  return manager.state();
+}
+
+int test_MGDiffusionSolver_block(int argc, char *argv[])
+{
+  // Block Gauss-Seidel over groups matches the full operator in each
+  // mode.  Only upscatter or implicit fission requires iteration.
+  for (int dim = 1; dim <= 2; ++dim)
+  {
+    for (int c = 0; c < 4; ++c)
+    {
+      bool adjoint  = c / 2;
+      bool multiply = c % 2;
+      int iterations = 0;
+      State::SP_state ref, state;
+      if (dim == 1)
+      {
+        ref   = solve_7g<_1D>(dim, false, adjoint, multiply, iterations);
+        state = solve_7g<_1D>(dim, true,  adjoint, multiply, iterations);
+      }
+      else
+      {
+        ref   = solve_7g<_2D>(dim, false, adjoint, multiply, iterations);
+        state = solve_7g<_2D>(dim, true,  adjoint, multiply, iterations);
+      }
+      printf(" dim = %i  adjoint = %i  multiply = %i  iterations = %i \n",
+             dim, adjoint, multiply, iterations);
+      TEST(iterations > 0);
+      for (int g = 0; g < 7; ++g)
+      {
+        for (int i = 0; i < ref->phi(g).size(); ++i)
+          TEST(soft_equiv(state->phi(g)[i], ref->phi(g)[i], 1e-8));
+      }
+    }
+  }
+  return 0;
+}
+
+/// Solve a 2 group problem, optionally reusing an existing manager, and
+/// return the first thermal flux
+template <class D>
+double solve_2g(FixedSourceData &data, SP<FixedSourceManager<D> > &manager)
+{
+  if (!manager)
+  {
+    manager = new FixedSourceManager<D>(data.input, data.material, data.mesh);
+    manager->setup();
+    manager->set_source(data.source);
+    manager->set_solver();
+  }
+  manager->solve();
+  return manager->state()->phi(1)[0];
+}
+
+int test_MGDiffusionSolver_refresh(int argc, char *argv[])
+{
+  // Changing the cross sections after a solve changes the group blocks,
+  // and adding upscatter widens the scatter bounds of the full operator.
+  // (Upscatter is not added for block solves, since the material keeps
+  // its downscatter-only flag once set.)  Refreshing the solver must
+  // pick up the changes and match a new solver.
+  for (int block = 0; block < 2; ++block)
+  {
+    FixedSourceData data = get_fixedsource_data(1, 2);
+    data.input->put<std::string>("equation", "diffusion");
+    data.input->put<double>("outer_tolerance", 1e-12);
+    data.input->put<int>("outer_max_iters", 1000);
+    if (block)
+      data.input->put<std::string>("diffusion_solver_type", "block");
+    SP<FixedSourceManager<_1D> > manager, ref;
+    double phi_0 = solve_2g<_1D>(data, manager);
+    if (!block) data.material->set_sigma_s(0, 0, 1, 0.1);
+    data.material->set_sigma_s(0, 1, 0, 0.02);
+    data.material->set_sigma_t(0, 1, 2.0);
+    data.material->finalize();
+    manager->update();
+    double phi_1 = solve_2g<_1D>(data, manager);
+    double phi_ref = solve_2g<_1D>(data, ref);
+    TEST(!soft_equiv(phi_0, phi_ref, 1e-6));
+    for (int g = 0; g < 2; ++g)
+    {
+      for (int i = 0; i < ref->state()->phi(g).size(); ++i)
+      {
+        TEST(soft_equiv(manager->state()->phi(g)[i],
+                        ref->state()->phi(g)[i], 1e-8));
+      }
+    }
+    TEST(soft_equiv(phi_1, phi_ref, 1e-8));
+  }
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_MGDiffusionSolver.cc
 //----------------------------------------------------------------------------//
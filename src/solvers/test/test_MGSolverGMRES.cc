@@ -12,10 +12,12 @@
         FUNC(test_MGSolverGMRES_7g_forward)          \
         FUNC(test_MGSolverGMRES_7g_forward_multiply) \
         FUNC(test_MGSolverGMRES_7g_adjoint)          \
-        FUNC(test_MGSolverGMRES_7g_adjoint_multiply)
+        FUNC(test_MGSolverGMRES_7g_adjoint_multiply) \
+        FUNC(test_MGSolverGMRES_7g_group_threads)
 
 #include "TestDriver.hh"
 #include "solvers/FixedSourceManager.hh"
+#include "solvers/mg/MGSolverGMRES.hh"
 #include "solvers/test/fixedsource_fixture.hh"
 
 using namespace detran_test;
@@ -165,6 +167,39 @@ int test_MGSolverGMRES_7g_adjoint_multiply(int argc, char *argv[])
   return 0;
 }
 
+// Forward multiplying problem with the groups swept concurrently
+int test_MGSolverGMRES_7g_group_threads(int argc, char *argv[])
+{
+  FixedSourceData data = get_fixedsource_data(1, 7);
+  data.input->put<std::string>("outer_solver", "GMRES");
+  data.input->put<std::string>("bc_west", "reflect");
+  data.input->put<std::string>("bc_east", "reflect");
+  data.input->put<double>("inner_tolerance", 1e-14);
+  data.input->put<double>("outer_tolerance", 1e-14);
+  data.input->put<int>("inner_max_iters", 1000000);
+  data.input->put<int>("outer_max_iters", 1000000);
+  data.input->put<int>("outer_group_threads", 4);
+  data.input->put<int>("outer_nested_threads", 1);
+  FixedSourceManager<_1D> manager(data.input, data.material, data.mesh, true);
+  manager.setup();
+  manager.set_source(data.source);
+  manager.set_solver();
+  manager.solve();
+  MGSolverGMRES<_1D> &solver =
+    *dynamic_cast<MGSolverGMRES<_1D>*>(manager.solver().bp());
+  TEST(solver.get_operator()->number_group_threads() == 4);
+  double ref[] = {3.646729598901197e+02, 5.352648103971697e+03,
+                  3.309487533450470e+02, 1.856704021668497e+01,
+                  2.763765763929116e+01, 1.018645586459539e+01,
+                  4.020322297305944e+00 };
+  for (int g = 0; g < 7; ++g)
+  {
+    printf("%4i %20.12e  %20.12e \n", g, ref[g], manager.state()->phi(g)[0]);
+    TEST(soft_equiv(ref[g], manager.state()->phi(g)[0]));
+  }
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_MGSolverGMRES.cc
 //----------------------------------------------------------------------------//
@@ -12,10 +12,12 @@
         FUNC(test_MGSolverGS_7g_forward)          \
         FUNC(test_MGSolverGS_7g_forward_multiply) \
         FUNC(test_MGSolverGS_7g_adjoint)          \
-        FUNC(test_MGSolverGS_7g_adjoint_multiply)
+        FUNC(test_MGSolverGS_7g_adjoint_multiply) \
+        FUNC(test_MGSolverGS_7g_anderson)
 
 #include "TestDriver.hh"
 #include "solvers/FixedSourceManager.hh"
+#include "solvers/mg/MGSolverGS.hh"
 #include "solvers/test/fixedsource_fixture.hh"
 
 using namespace detran_test;
@@ -156,6 +158,43 @@ int test_MGSolverGS_7g_adjoint_multiply(int argc, char *argv[])
   return 0;
 }
 
+int test_MGSolverGS_7g_anderson(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  {
+    // Anderson mixing of the inner and then also of the upscatter
+    // iterations must give the same flux with less work.
+    int inner[] = {0, 5, 5};
+    int outer[] = {0, 0, 5};
+    int iterations[3], sweeps[3];
+    double ref[] =
+    { 3.646729598901197e+02, 5.352648103971697e+03, 3.309487533450470e+02,
+        1.856704021668497e+01, 2.763765763929116e+01, 1.018645586459539e+01,
+        4.020322297305944e+00 };
+    for (int c = 0; c < 3; ++c)
+    {
+      FixedSourceData data = get_fixedsource_data(1, 7);
+      set_data(data.input);
+      data.input->put<int>("inner_anderson_depth", inner[c]);
+      data.input->put<int>("outer_anderson_depth", outer[c]);
+      SP_manager manager = get_manager(data, true);
+      for (int g = 0; g < 7; ++g)
+        TEST(soft_equiv(ref[g], manager->state()->phi(g)[0], 1.0e-10));
+      MGSolverGS<_1D> &solver =
+        *dynamic_cast<MGSolverGS<_1D>*>(manager->solver().bp());
+      iterations[c] = solver.number_iterations();
+      sweeps[c] = solver.number_sweeps();
+      printf(" anderson depth inner: %2i  outer: %2i  outer iterations: %4i "
+             " sweeps: %6i \n", inner[c], outer[c], iterations[c], sweeps[c]);
+    }
+    TEST(sweeps[1] < sweeps[0]);
+    TEST(iterations[2] < iterations[1]);
+    TEST(sweeps[2] < sweeps[1]);
+  }
+  callow_finalize();
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_MGSolverGS.cc
 //----------------------------------------------------------------------------//
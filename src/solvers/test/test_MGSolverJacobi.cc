@@ -0,0 +1,166 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_MGSolverJacobi.cc
+ *  @brief Test of MGSolverJacobi
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                                     \
+        FUNC(test_MGSolverJacobi_7g_forward)          \
+        FUNC(test_MGSolverJacobi_7g_forward_multiply) \
+        FUNC(test_MGSolverJacobi_7g_adjoint)          \
+        FUNC(test_MGSolverJacobi_2D_psi)
+
+#include "TestDriver.hh"
+#include "solvers/FixedSourceManager.hh"
+#include "solvers/mg/MGSolverJacobi.hh"
+#include "solvers/test/fixedsource_fixture.hh"
+
+using namespace detran_test;
+using namespace detran;
+using namespace detran_utilities;
+using namespace std;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+typedef FixedSourceManager<_1D> Manager;
+typedef Manager::SP_manager SP_manager;
+
+void set_data(InputDB::SP_input db)
+{
+  db->put<std::string>("outer_solver", "Jacobi");
+  db->put<double>("inner_tolerance", 1e-14);
+  db->put<double>("outer_tolerance", 1e-14);
+  db->put<int>("inner_max_iters", 1000000);
+  db->put<int>("outer_max_iters", 1000000);
+  db->put<std::string>("bc_west", "reflect");
+  db->put<std::string>("bc_east", "reflect");
+}
+
+SP_manager get_manager(FixedSourceData &data, bool fiss)
+{
+  SP_manager manager(new Manager(data.input, data.material, data.mesh, fiss));
+  manager->setup();
+  manager->set_source(data.source);
+  manager->set_solver();
+  manager->solve();
+  MGSolverJacobi<_1D> &solver =
+    *dynamic_cast<MGSolverJacobi<_1D>*>(manager->solver().bp());
+  printf(" threads: %i  outers: %i  sweeps: %i \n", solver.number_threads(),
+         solver.number_iterations(), solver.number_sweeps());
+  return manager;
+}
+
+// The references are those of test_MGSolverGS.
+
+int test_MGSolverJacobi_7g_forward(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  {
+    FixedSourceData data = get_fixedsource_data(1, 7);
+    set_data(data.input);
+    SP_manager manager = get_manager(data, false);
+    double ref[] = {1.983654685392368e+01, 3.441079047626809e+02,
+         5.302787426165165e+01, 1.125133608569081e+01, 2.662710276585539e+01,
+         1.010604145062320e+01, 4.015682491688769e+00};
+    for (int g = 0; g < 7; ++g)
+    {
+      printf(" %10.12e  %10.12e \n", ref[g], manager->state()->phi(g)[0]);
+      TEST(soft_equiv(ref[g], manager->state()->phi(g)[0]));
+    }
+  }
+  callow_finalize();
+  return 0;
+}
+
+int test_MGSolverJacobi_7g_forward_multiply(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  {
+    FixedSourceData data = get_fixedsource_data(1, 7);
+    set_data(data.input);
+    SP_manager manager = get_manager(data, true);
+    double ref[] =
+    { 3.646729598901197e+02, 5.352648103971697e+03, 3.309487533450470e+02,
+        1.856704021668497e+01, 2.763765763929116e+01, 1.018645586459539e+01,
+        4.020322297305944e+00 };
+    for (int g = 0; g < 7; ++g)
+    {
+      TEST(soft_equiv(ref[g], manager->state()->phi(g)[0]));
+    }
+  }
+  callow_finalize();
+  return 0;
+}
+
+int test_MGSolverJacobi_7g_adjoint(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  {
+    FixedSourceData data = get_fixedsource_data(1, 7);
+    set_data(data.input);
+    data.input->put<int>("adjoint", 1);
+    SP_manager manager = get_manager(data, false);
+    double ref[] =
+    { 1.859700683043188e+02, 1.976212385028667e+02, 3.498588283183322e+01,
+        1.129601285153168e+01, 2.693961991801324e+01, 8.478379540507643e+00,
+        3.681286723043155e+00 };
+    for (int g = 0; g < 7; ++g)
+    {
+      printf("%4i %20.12e  %20.12e \n", g, ref[g], manager->state()->phi(g)[0]);
+      TEST(soft_equiv(ref[g], manager->state()->phi(g)[0]));
+    }
+  }
+  callow_finalize();
+  return 0;
+}
+
+// Compare the gathered scalar and angular fluxes to Gauss-Seidel in 2D.
+int test_MGSolverJacobi_2D_psi(int argc, char *argv[])
+{
+  typedef FixedSourceManager<_2D> Manager_2D;
+  callow_initialize(argc, argv);
+  {
+    Manager_2D::SP_manager manager[2];
+    std::string type[] = {"GS", "Jacobi"};
+    for (int i = 0; i < 2; ++i)
+    {
+      FixedSourceData data = get_fixedsource_data(2, 7);
+      set_data(data.input);
+      data.input->put<std::string>("outer_solver", type[i]);
+      data.input->put<int>("store_angular_flux", 1);
+      manager[i] = new Manager_2D(data.input, data.material, data.mesh);
+      manager[i]->setup();
+      manager[i]->set_source(data.source);
+      manager[i]->set_solver();
+      manager[i]->solve();
+    }
+    State::SP_state gs = manager[0]->state();
+    State::SP_state jacobi = manager[1]->state();
+    for (int g = 0; g < 7; ++g)
+    {
+      for (int i = 0; i < gs->phi(g).size(); ++i)
+        TEST(soft_equiv(gs->phi(g)[i], jacobi->phi(g)[i], 1.0e-10));
+      for (int o = 0; o < 4; ++o)
+        for (int i = 0; i < gs->psi(g, o, 0).size(); ++i)
+          TEST(soft_equiv(gs->psi(g, o, 0)[i], jacobi->psi(g, o, 0)[i], 1.0e-10));
+    }
+  }
+  callow_finalize();
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_MGSolverJacobi.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,161 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_SweepScheduler.cc
+ *  @brief Test of the sweep schedulers and prebuilt octant sources
+ *  @note  Copyright(C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                           \
+        FUNC(test_SweepScheduler_2D_SI)        \
+        FUNC(test_SweepScheduler_2D_GMRES)     \
+        FUNC(test_SweepScheduler_3D_SI)        \
+        FUNC(test_SweepScheduler_3D_GMRES)     \
+        FUNC(test_SweepScheduler_2D_batch)     \
+        FUNC(test_SweepScheduler_2D_batch_sc)  \
+        FUNC(test_SweepScheduler_2D_batch_sd)  \
+        FUNC(test_SweepScheduler_3D_batch)     \
+        FUNC(test_SweepScheduler_1D_octant_source) \
+        FUNC(test_SweepScheduler_2D_octant_source) \
+        FUNC(test_SweepScheduler_3D_octant_source)
+
+#include "TestDriver.hh"
+#include "solvers/FixedSourceManager.hh"
+#include "solvers/test/fixedsource_fixture.hh"
+
+using namespace detran_test;
+using namespace detran;
+using namespace detran_utilities;
+using namespace std;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/// Solve a 7 group problem with the given scheduler and return the state.
+template <class D>
+State::SP_state solve(const std::string &scheduler,
+                      const std::string &inner_solver,
+                      const std::string &equation,
+                      const bool         octant_source = false)
+{
+  FixedSourceData data = get_fixedsource_data(D::dimension, 7, 4);
+  data.input->put<std::string>("equation",         equation);
+  data.input->put<std::string>("outer_solver",     "GS");
+  data.input->put<std::string>("inner_solver",     inner_solver);
+  data.input->put<std::string>("sweep_scheduler",  scheduler);
+  data.input->put<int>("store_angular_flux",       1);
+  data.input->put<int>("sweep_octant_source",      octant_source);
+  // Nine angles per octant gives one full and one padded batch.
+  data.input->put<int>("quad_number_polar_octant",   3);
+  data.input->put<int>("quad_number_azimuth_octant", 3);
+  data.input->put<double>("inner_tolerance",       1e-12);
+  data.input->put<double>("outer_tolerance",       1e-12);
+  data.input->put<int>("inner_max_iters",          1000000);
+  data.input->put<int>("outer_max_iters",          1000000);
+  data.input->put<int>("outer_print_level",        0);
+  data.input->put<std::string>("bc_west",          "reflect");
+  data.input->put<std::string>("bc_south",         "reflect");
+  data.input->put<std::string>("bc_bottom",        "reflect");
+  FixedSourceManager<D> manager(data.input, data.material, data.mesh);
+  manager.setup();
+  manager.set_source(data.source);
+  manager.set_solver();
+  manager.solve();
+  return manager.state();
+}
+
+/// Compare the moments and angular fluxes to the default scheduler.
+template <class D>
+int compare(const std::string &inner_solver,
+            const std::string &scheduler = "kba",
+            const std::string &equation = "dd",
+            const bool         octant_source = false)
+{
+  State::SP_state ref = solve<D>("angle",   inner_solver, equation);
+  State::SP_state kba = solve<D>(scheduler, inner_solver, equation,
+                                 octant_source);
+  for (int g = 0; g < 7; ++g)
+  {
+    for (int i = 0; i < ref->phi(g).size(); ++i)
+      TEST(soft_equiv(kba->phi(g)[i], ref->phi(g)[i], 1.0e-10));
+    for (int o = 0; o < std::pow(2.0, D::dimension); ++o)
+    {
+      for (int a = 0; a < ref->get_quadrature()->number_angles_octant(); ++a)
+      {
+        for (int i = 0; i < ref->psi(g, o, a).size(); ++i)
+          TEST(soft_equiv(kba->psi(g, o, a)[i], ref->psi(g, o, a)[i], 1.0e-10));
+      }
+    }
+  }
+  return 0;
+}
+
+int test_SweepScheduler_2D_SI(int argc, char *argv[])
+{
+  return compare<_2D>("SI");
+}
+
+int test_SweepScheduler_2D_GMRES(int argc, char *argv[])
+{
+  return compare<_2D>("GMRES");
+}
+
+int test_SweepScheduler_3D_SI(int argc, char *argv[])
+{
+  return compare<_3D>("SI");
+}
+
+int test_SweepScheduler_3D_GMRES(int argc, char *argv[])
+{
+  return compare<_3D>("GMRES");
+}
+
+int test_SweepScheduler_2D_batch(int argc, char *argv[])
+{
+  return compare<_2D>("SI", "batch");
+}
+
+int test_SweepScheduler_2D_batch_sc(int argc, char *argv[])
+{
+  return compare<_2D>("GMRES", "batch", "sc");
+}
+
+int test_SweepScheduler_2D_batch_sd(int argc, char *argv[])
+{
+  return compare<_2D>("GMRES", "batch", "sd");
+}
+
+int test_SweepScheduler_3D_batch(int argc, char *argv[])
+{
+  return compare<_3D>("SI", "batch");
+}
+
+int test_SweepScheduler_1D_octant_source(int argc, char *argv[])
+{
+  return compare<_1D>("SI", "angle", "dd", true);
+}
+
+int test_SweepScheduler_2D_octant_source(int argc, char *argv[])
+{
+  return compare<_2D>("GMRES", "kba", "dd", true);
+}
+
+int test_SweepScheduler_3D_octant_source(int argc, char *argv[])
+{
+  return compare<_3D>("SI", "angle", "dd", true);
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_SweepScheduler.cc
+//----------------------------------------------------------------------------//
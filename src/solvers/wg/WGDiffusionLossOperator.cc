@@ -43,7 +43,11 @@ WGDiffusionLossOperator::WGDiffusionLossOperator(SP_input    input,
   // Preallocate the matrix.
   preallocate(&nnz[0]);
 
-  // Set the albedo based only on boundary condition.
+  // Set the albedo based only on boundary condition.  As for the
+  // multigroup operator, vacuum boundaries can impose zero flux.
+  bool zero_flux = false;
+  if (d_input->check("bc_zero_flux"))
+    zero_flux = d_input->get<int>("bc_zero_flux");
   std::vector<std::string> boundary_name(6, "");
   boundary_name[Mesh::WEST]   = "bc_west";
   boundary_name[Mesh::EAST]   = "bc_east";
@@ -57,8 +61,12 @@ WGDiffusionLossOperator::WGDiffusionLossOperator(SP_input    input,
     // we leave the "infinite" boundaries as reflective.
     d_albedo[b] = 0.0;
     if (d_input->check(boundary_name[b]))
+    {
       if (d_input->get<std::string>(boundary_name[b]) == "reflect")
         d_albedo[b] = 1.0;
+      else if (zero_flux)
+        d_albedo[b] = -1.0;
+    }
   }
 
   // Build the matrix.
@@ -71,6 +79,8 @@ WGDiffusionLossOperator::WGDiffusionLossOperator(SP_input    input,
 //---------------------------------------------------------------------------//
 void WGDiffusionLossOperator::construct()
 {
+  // The pattern is unchanged, so only the values are refilled.
+  if (is_ready()) reset_values();
   build();
 }
 
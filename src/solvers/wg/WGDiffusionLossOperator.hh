@@ -83,6 +83,13 @@ public:
   /// Rebuild the matrix based on the present material definitions.
   void construct();
 
+  /// Albedo of a boundary surface
+  double albedo(const size_t side) const
+  {
+    Require(side < 6);
+    return d_albedo[side];
+  }
+
 private:
 
   //---------------------------------------------------------------------------//
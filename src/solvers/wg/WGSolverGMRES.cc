@@ -56,6 +56,25 @@ WGSolverGMRES<D>::WGSolverGMRES(SP_state                  state,
   d_solver = callow::LinearSolverCreator::Create(db);
   Assert(d_solver);
 
+  // The block solver shares the tolerances and restart of the main solver.
+  {
+    double atol = d_tolerance, rtol = d_tolerance;
+    int maxit = d_maximum_iterations, restart = 20, monitor_level = 0;
+    if (db->check("linear_solver_atol"))
+      atol = db->template get<double>("linear_solver_atol");
+    if (db->check("linear_solver_rtol"))
+      rtol = db->template get<double>("linear_solver_rtol");
+    if (db->check("linear_solver_maxit"))
+      maxit = db->template get<int>("linear_solver_maxit");
+    if (db->check("linear_solver_gmres_restart"))
+      restart = db->template get<int>("linear_solver_gmres_restart");
+    if (db->check("linear_solver_monitor_level"))
+      monitor_level = db->template get<int>("linear_solver_monitor_level");
+    d_block_solver = new callow::BlockGMRES(atol, rtol, maxit, restart);
+    d_block_solver->set_monitor_level(monitor_level);
+    d_block_solver->set_operators(d_operator);
+  }
+
   // Set the transport operator.  Note, no second db argument
   // is given, since that is for setting PC's.  We do that
   // explicitly below.
@@ -110,6 +129,7 @@ WGSolverGMRES<D>::WGSolverGMRES(SP_state                  state,
   if (d_pc)
   {
     d_solver->set_preconditioner(d_pc, pc_side);
+    d_block_solver->set_preconditioner(d_pc, pc_side);
   }
 
 }
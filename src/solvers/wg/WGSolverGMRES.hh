@@ -13,6 +13,7 @@
 #include "WGTransportOperator.hh"
 #include "WGPreconditioner.hh"
 #include "callow/solver/LinearSolver.hh"
+#include "callow/solver/BlockGMRES.hh"
 
 namespace detran
 {
@@ -42,6 +43,10 @@ namespace detran
  *  is often required.  A good preconditioner @f$ \mathbf{M} @f$
  *  is in some way "similar" to the operator @f$ \mathbf{A} @f$, and
  *  applying its inverse @f$ \mathbf{M}^{-1} @f$ can be done cheaply.
+ *
+ *  Several within-group problems that differ only in their sources can
+ *  be solved together by solve_block, which uses block GMRES so that
+ *  each iteration sweeps all the sources at once.
  */
 //---------------------------------------------------------------------------//
 
@@ -70,6 +75,7 @@ public:
   typedef typename Base::SP_sweeper             SP_sweeper;
   typedef typename Base::SP_sweepsource         SP_sweepsource;
   typedef typename Base::moments_type           moments_type;
+  typedef State::vec_moments_type               vec_moments_type;
   typedef typename Base::size_t                 size_t;
   typedef detran_utilities::vec_dbl             vec_dbl;
   //
@@ -77,7 +83,9 @@ public:
   typedef typename Operator_T::SP_operator      SP_operator;
   typedef WGPreconditioner::SP_preconditioner   SP_preconditioner;
   typedef callow::LinearSolver::SP_solver       SP_linearsolver;
+  typedef detran_utilities::SP<callow::BlockGMRES> SP_blocksolver;
   typedef callow::Vector::SP_vector             SP_vector;
+  typedef std::vector<SP_boundary>              vec_boundary;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -108,6 +116,38 @@ public:
   /// Solve the within group equation.
   void solve(const size_t g);
 
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Solve the within-group equation for several moments sources.
+   *
+   *  Each problem is the within-group problem of group g with the
+   *  isotropic source q[s] in place of the external, fission, and
+   *  in-scatter sources.  The problems are solved together by block
+   *  GMRES with the tolerance, iteration limit, restart, and
+   *  preconditioner of this solver.  The boundary of this solver may
+   *  not be reflective, and its fixed conditions are not used.  Instead,
+   *  problem s has the incident fluxes set by the conditions of
+   *  incident[s], if given, which must be built for the same mesh and
+   *  quadrature.  Block sweeps carry no incident fluxes, so the
+   *  uncollided flux of each boundary source costs one ordinary sweep.
+   *  The state is not modified.
+   *
+   *  @param g          group
+   *  @param q          moments source of each problem
+   *  @param phi        moments of each solution
+   *  @param incident   boundary source of each problem, or empty
+   */
+  void solve_block(const size_t            g,
+                   const vec_moments_type &q,
+                   vec_moments_type       &phi,
+                   const vec_boundary     &incident = vec_boundary());
+
+  /// Block solver used by solve_block
+  SP_blocksolver block_solver() const { return d_block_solver; }
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -131,6 +171,8 @@ private:
 
   /// Main linear solver
   SP_linearsolver d_solver;
+  /// Block solver for several sources
+  SP_blocksolver d_block_solver;
   /// Preconditioner
   SP_preconditioner d_pc;
   /// Operator "A" in "Ax = b"
@@ -151,6 +193,10 @@ private:
   /// Build the right hand side.
   void build_rhs(State::moments_type &B);
 
+  /// Add the uncollided fluxes of the boundary sources to block sources.
+  void add_boundary_sources(const vec_boundary &incident,
+                            vec_moments_type   &B);
+
 };
 
 } // namespace detran
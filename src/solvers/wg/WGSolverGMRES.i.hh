@@ -106,6 +106,89 @@ inline void WGSolverGMRES<D>::solve(const size_t g)
 
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+inline void WGSolverGMRES<D>::solve_block(const size_t            g,
+                                          const vec_moments_type &q,
+                                          vec_moments_type       &phi,
+                                          const vec_boundary     &incident)
+{
+  Require(q.size() > 0);
+  Require(q.size() == phi.size());
+  Require(incident.empty() || incident.size() == q.size());
+  Insist(!d_boundary->has_reflective(),
+         "Block within-group solves require vacuum boundaries.");
+
+  // Set the group for this solve.
+  d_g = g;
+  d_sweeper->setup_group(g);
+  d_operator->set_group(g);
+  if (d_pc) d_pc->set_group(g);
+
+  // The right hand sides are the uncollided fluxes of the sources, which
+  // are also the initial guesses.
+  size_t m = q.size();
+  size_t n = d_mesh->number_cells();
+  vec_moments_type B(m, moments_type(n, 0.0));
+  d_sweeper->sweep_block(q, B);
+  if (!incident.empty()) add_boundary_sources(incident, B);
+  std::vector<SP_vector> b(m), x(m);
+  for (size_t s = 0; s < m; ++s)
+  {
+    b[s] = new callow::Vector(n, 0.0);
+    x[s] = new callow::Vector(n, 0.0);
+    for (size_t i = 0; i < n; ++i)
+      (*b[s])[i] = B[s][i];
+    x[s]->copy(b[s]);
+  }
+
+  d_block_solver->solve_block(b, x);
+
+  for (size_t s = 0; s < m; ++s)
+  {
+    phi[s].resize(n);
+    memcpy(&phi[s][0], &(*x[s])[0], n * sizeof(double));
+  }
+
+  if (d_print_level > 0)
+  {
+    printf(" Block GMRES Final: Number Iters: %3i  Sources: %3i  Sweeps: %6i \n",
+           d_block_solver->number_iterations(), (int)m,
+           d_sweeper->number_sweeps());
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+inline void WGSolverGMRES<D>::add_boundary_sources(const vec_boundary &incident,
+                                                   vec_moments_type   &B)
+{
+  size_t size = 0;
+  for (size_t side = 0; side < 2 * D::dimension; ++side)
+    size += d_boundary->boundary_flux_size(side);
+  vec_dbl psi(size, 0.0);
+  moments_type B_s(d_mesh->number_cells(), 0.0);
+
+  // Sweep each boundary source alone, with no volume sources.
+  d_sweepsource->reset();
+  d_sweepsource->set_discrete_external_source_flag(false);
+  for (size_t s = 0; s < incident.size(); ++s)
+  {
+    if (!incident[s]) continue;
+    incident[s]->clear(d_g);
+    incident[s]->set(d_g);
+    incident[s]->psi(d_g, &psi[0], BoundaryBase<D>::IN,
+                     BoundaryBase<D>::GET, false);
+    d_boundary->psi(d_g, &psi[0], BoundaryBase<D>::IN,
+                    BoundaryBase<D>::SET, false);
+    d_sweeper->sweep(B_s);
+    for (size_t i = 0; i < B_s.size(); ++i)
+      B[s][i] += B_s[i];
+  }
+  d_sweepsource->set_discrete_external_source_flag(true);
+  d_boundary->clear(d_g);
+}
+
 //---------------------------------------------------------------------------//
 template <class D>
 inline void WGSolverGMRES<D>::build_rhs(State::moments_type &B)
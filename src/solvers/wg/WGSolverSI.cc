@@ -21,8 +21,23 @@ WGSolverSI<D>::WGSolverSI(SP_state                  state,
                           SP_fissionsource          q_f,
                           bool                      multiply)
   : Base(state, material, quadrature, boundary, q_e, q_f, multiply)
+  , d_boundary_size(0)
+  , d_number_iterations(0)
 {
   d_sweeper->set_update_boundary(true);
+  d_mixer = AndersonMixer::Create(d_input, "inner");
+
+  // Reflected incident fluxes are mixed with the flux, so they must not
+  // change within a sweep.
+  if (d_mixer && d_boundary->has_reflective())
+  {
+    for (int side = 0; side < 2*D::dimension; ++side)
+    {
+      if (d_boundary->is_reflective(side))
+        d_boundary_size += d_boundary->boundary_flux_size(side) / 2;
+    }
+    d_sweeper->set_update_boundary(false);
+  }
 }
 
 //----------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 
 // Detran
 #include "WGSolver.hh"
+#include "solvers/AndersonMixer.hh"
 
 #include <iostream>
 
@@ -42,6 +43,16 @@ namespace detran
  *
  *  This implementation is useful because it provides access to various
  *  nonlinear acceleration schemes not applicable to nonstationary solvers.
+ *
+ *  The iteration can be accelerated by Anderson mixing of the flux (see
+ *  \ref AndersonMixer), which keeps a few past fluxes rather than a full
+ *  Krylov basis.  Incident fluxes on reflecting sides are part of the
+ *  iterate, so with mixing they are updated after each sweep (as for
+ *  the Krylov solvers) rather than on the fly, and mixed with the flux.
+ *
+ *  Relevant db entries:
+ *  - inner_anderson_depth (int) [default = 0, i.e. off]
+ *  - inner_anderson_regularization (double) [default = 1e-12]
  */
 
 template <class D>
@@ -70,6 +81,7 @@ public:
   typedef typename Base::SP_sweepsource         SP_sweepsource;
   typedef typename Base::moments_type           moments_type;
   typedef typename Base::size_t                 size_t;
+  typedef AndersonMixer::SP_mixer               SP_mixer;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -100,6 +112,16 @@ public:
   /// Solve the within group equation.
   void solve(const size_t g);
 
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Number of iterations in the last solve
+  int number_iterations() const { return d_number_iterations; }
+
+  /// Anderson mixer, if used
+  SP_mixer mixer() const { return d_mixer; }
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -122,6 +144,13 @@ private:
   using Base::d_adjoint;
   using Base::d_g;
 
+  /// Anderson mixer
+  SP_mixer d_mixer;
+  /// Number of reflected incident fluxes mixed with the flux
+  size_t d_boundary_size;
+  /// Number of iterations in the last solve
+  int d_number_iterations;
+
 };
 
 } // namespace detran
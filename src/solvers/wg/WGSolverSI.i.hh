@@ -43,6 +43,13 @@ void WGSolverSI<D>::solve(const size_t g)
   // Construct within group.
   d_sweepsource->build_within_group_scatter(g, phi);
 
+  // Each solve starts a new history.
+  if (d_mixer) d_mixer->reset();
+
+  // Reflected incident fluxes and the mixed iterates, if mixing.
+  moments_type psi(d_boundary_size, 0.0);
+  moments_type x, gx;
+
   // Iterate.
   double error = 1.0;
   size_t iteration;
@@ -64,13 +71,33 @@ void WGSolverSI<D>::solve(const size_t g)
     }
     if (error < d_tolerance) break;
 
-    // INSERT ACCELERATION HERE
-    // d_accelerate->update(g, phi)
+    // Mix the new flux and reflected incident fluxes with the history.
+    if (d_mixer && d_boundary_size)
+    {
+      x = phi_old;
+      d_boundary->psi(g, &psi[0], BoundaryBase<D>::IN,
+                      BoundaryBase<D>::GET, true);
+      x.insert(x.end(), psi.begin(), psi.end());
+      d_boundary->update(g);
+      gx = phi;
+      d_boundary->psi(g, &psi[0], BoundaryBase<D>::IN,
+                      BoundaryBase<D>::GET, true);
+      gx.insert(gx.end(), psi.begin(), psi.end());
+      d_mixer->update(x, gx);
+      std::copy(gx.begin(), gx.begin() + phi.size(), phi.begin());
+      d_boundary->psi(g, &gx[phi.size()], BoundaryBase<D>::IN,
+                      BoundaryBase<D>::SET, true);
+    }
+    else if (d_mixer)
+    {
+      d_mixer->update(phi_old, phi);
+    }
 
     // Construct within group
     d_sweepsource->build_within_group_scatter(g, phi);
 
   } // end iterations
+  d_number_iterations = std::min(iteration, d_maximum_iterations);
 
   if (d_print_level > 0)
   {
@@ -114,6 +114,41 @@ void WGTransportOperator<D>::multiply(const Vector &x,  Vector &y)
 
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+void WGTransportOperator<D>::
+multiply_block(const std::vector<SP_vector> &x, std::vector<SP_vector> &y)
+{
+  Require(x.size() == y.size());
+
+  // Reflected boundary fluxes couple each vector to its own incident
+  // fluxes, which a block sweep does not carry.
+  if (d_boundary->has_reflective() || !d_sweeper->has_block_sweep())
+  {
+    Base::multiply_block(x, y);
+    return;
+  }
+
+  // Build the scattering source of each vector.
+  vec_moments_type q(x.size(), moments_type(d_moments_size, 0.0));
+  vec_moments_type phi(x.size(), moments_type(d_moments_size, 0.0));
+  for (size_t s = 0; s < x.size(); ++s)
+  {
+    for (int i = 0; i < d_moments_size; i++) phi[s][i] = (*x[s])[i];
+    d_sweepsource->reset();
+    d_sweepsource->build_within_group_scatter(d_g, phi[s]);
+    q[s] = d_sweepsource->scatter_group_source();
+  }
+
+  // Sweep all sources.  This gives X <-- D*inv(L)*M*S*X
+  d_sweeper->sweep_block(q, phi);
+
+  // This gives X <- (I-D*inv(L)*M*S)*X
+  for (size_t s = 0; s < x.size(); ++s)
+    for (int i = 0; i < d_moments_size; i++)
+      (*y[s])[i] = (*x[s])[i] - phi[s][i];
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //---------------------------------------------------------------------------//
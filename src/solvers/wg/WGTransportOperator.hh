@@ -46,6 +46,7 @@ public:
   typedef typename Sweeper<D>::SP_sweeper             SP_sweeper;
   typedef typename SweepSource<D>::SP_sweepsource     SP_sweepsource;
   typedef State::moments_type                         moments_type;
+  typedef State::vec_moments_type                     vec_moments_type;
   typedef callow::Vector                              Vector;
 
   //-------------------------------------------------------------------------//
@@ -78,6 +79,16 @@ public:
   // the client must implement the action y <-- A * x
   virtual void multiply(const Vector &x,  Vector &y);
 
+  /**
+   *  @brief Apply the operator to a block of vectors
+   *
+   *  With vacuum boundaries and a sweeper that implements block sweeps,
+   *  the scattering sources of all vectors are swept together.
+   *  Otherwise, the vectors are applied one at a time.
+   */
+  virtual void multiply_block(const std::vector<SP_vector> &x,
+                              std::vector<SP_vector>       &y);
+
   // the client must implement the action y <-- A' * x
   virtual void multiply_transpose(const Vector &x, Vector &y)
   {
@@ -96,6 +96,8 @@ public:
    *  @param  o           octant
    *  @param  a           angle within octant
    *  @param  psi         edge angular flux
+   *  @param  thread      index of the calling sweep thread, or negative
+   *                      outside of threaded sweeps
    */
   virtual void tally(const size_t i,
                      const size_t j,
@@ -103,7 +105,8 @@ public:
                      const size_t g,
                      const size_t o,
                      const size_t a,
-                     const face_flux_type psi) = 0;
+                     const face_flux_type psi,
+                     const int thread = -1) = 0;
 
   /**
    *  @brief Add angular flux to the tally for a single incident direction
@@ -119,6 +122,7 @@ public:
    *  @param  a           angle within octant
    *  @param  d           axis index for the incident flux
    *  @param  psi         edge angular flux
+   *  @param  thread      index of the calling sweep thread, as above
    */
   virtual void tally(const size_t i,
                      const size_t j,
@@ -127,7 +131,8 @@ public:
                      const size_t o,
                      const size_t a,
                      const size_t d,
-                     const double psi) = 0;
+                     const double psi,
+                     const int thread = -1) = 0;
 
   /// Print all the partial currents (for debugging)
   virtual void display() = 0;
@@ -135,6 +140,22 @@ public:
   /// Reset a group
   virtual void reset(const size_t group) = 0;
 
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Allocate thread-local tally buffers for threaded sweeps.
+   *
+   *  Tallies made with a thread index are accumulated into the buffer
+   *  of that thread, which must be summed by calling reduce from all
+   *  threads of the sweep.  The default does nothing.
+   */
+  virtual void setup_threads() { /* ... */ }
+
+  /// Sum the thread-local tallies for a group.  The default does nothing.
+  virtual void reduce(const size_t group) { /* ... */ }
+
 protected:
 
   //--------------------------------------------------------------------------//
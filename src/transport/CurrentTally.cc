@@ -8,6 +8,9 @@
 //---------------------------------------------------------------------------//
 
 #include "CurrentTally.hh"
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran
 {
@@ -53,6 +56,56 @@ void CurrentTally<D>::reset(const size_t group)
       }
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+void CurrentTally<D>::setup_threads()
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  size_t number_threads = omp_get_max_threads();
+#else
+  size_t number_threads = 1;
+#endif
+  if (d_thread_current.size() >= number_threads) return;
+  vec3_dbl current(D::dimension, vec2_dbl(2));
+  for (size_t d = 0; d < D::dimension; ++d)
+    for (size_t s = 0; s < 2; ++s)
+      current[d][s].resize(d_partial_current[d][0][s].size(), 0.0);
+  d_thread_current.resize(number_threads, current);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void CurrentTally<D>::reduce(const size_t group)
+{
+  Require(group < d_number_groups);
+  // Each thread sums a block of edges over all threads and zeros the
+  // thread buffers for the next sweep.
+#ifdef DETRAN_ENABLE_OPENMP
+  int number_threads = omp_get_num_threads();
+#else
+  int number_threads = 1;
+#endif
+  Assert(number_threads <= (int) d_thread_current.size());
+  for (size_t d = 0; d < D::dimension; ++d)
+  {
+    for (size_t s = 0; s < 2; ++s)
+    {
+      int n = d_partial_current[d][group][s].size();
+      #pragma omp for
+      for (int i = 0; i < n; ++i)
+      {
+        double v = 0.0;
+        for (int t = 0; t < number_threads; ++t)
+        {
+          v += d_thread_current[t][d][s][i];
+          d_thread_current[t][d][s][i] = 0.0;
+        }
+        d_partial_current[d][group][s][i] += v;
+      }
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 template <class D>
 void CurrentTally<D>::display()
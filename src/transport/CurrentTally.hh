@@ -9,6 +9,7 @@
 #ifndef detran_CURRENTTALLY_HH_
 #define detran_CURRENTTALLY_HH_
 
+#include "detran_config.hh"
 #include "transport/BoundaryTally.hh"
 
 namespace detran
@@ -108,6 +109,9 @@ public:
    *  @param  o           octant
    *  @param  a           angle within octant
    *  @param  psi         edge angular flux
+   *  @param  thread      index of the calling sweep thread, whose buffer
+   *                      is incremented; if negative, the group currents
+   *                      are incremented directly
    */
   void tally(const size_t i,
              const size_t j,
@@ -115,7 +119,8 @@ public:
              const size_t g,
              const size_t o,
              const size_t a,
-             const face_flux_type psi);
+             const face_flux_type psi,
+             const int thread = -1);
 
   /**
    *  @brief Add angular flux to the tally for a single incident direction
@@ -131,6 +136,7 @@ public:
    *  @param  a           angle within octant
    *  @param  d           axis index for the incident flux
    *  @param  psi         edge angular flux
+   *  @param  thread      index of the calling sweep thread, as above
    */
   void tally(const size_t i,
              const size_t j,
@@ -139,7 +145,8 @@ public:
              const size_t o,
              const size_t a,
              const size_t d,
-             const double psi);
+             const double psi,
+             const int thread = -1);
 
   //--------------------------------------------------------------------------//
   // PUBLIC FUNCTIONS
@@ -167,6 +174,17 @@ public:
   /// Reset a group
   void reset(const size_t group);
 
+  /// Allocate one partial current buffer per sweep thread
+  void setup_threads();
+
+  /**
+   *  @brief Add the thread buffers to the partial currents of a group
+   *
+   *  Within a parallel region, all threads of the team must call this,
+   *  and the edges are divided among them.  The buffers are zeroed.
+   */
+  void reduce(const size_t group);
+
 private:
 
   //--------------------------------------------------------------------------//
@@ -184,6 +202,19 @@ private:
 
   /// Partial currents [dimension][group][sense][index]
   std::vector<vec3_dbl> d_partial_current;
+  /// Thread-local partial currents [thread][dimension][sense][index]
+  std::vector<vec3_dbl> d_thread_current;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  /// Partial current to increment, in the buffer of a nonnegative thread
+  inline double& current(const size_t d,
+                         const size_t g,
+                         const size_t sense,
+                         const size_t idx,
+                         const int    thread);
 
 };
 
@@ -45,7 +45,8 @@ CurrentTally<D>::tally(const size_t i,
                        const size_t g,
                        const size_t o,
                        const size_t a,
-                       const face_flux_type psi)
+                       const face_flux_type psi,
+                       const int thread)
 {
 
   // Make direction triplet
@@ -80,7 +81,7 @@ CurrentTally<D>::tally(const size_t i,
                     d_coarsemesh->get_fine_mesh()->width(d2, dim[d2]);
 
       // Tally
-      d_partial_current[d0][g][d_octant_shift[d0][o]][idx] +=
+      current(d0, g, d_octant_shift[d0][o], idx, thread) +=
         psi[d0] * d_quadrature->cosines(d0)[a] * d_quadrature->weight(a) * area;
 
     }
@@ -98,7 +99,8 @@ CurrentTally<_1D>::tally(const size_t i,
                          const size_t g,
                          const size_t o,
                          const size_t a,
-                         const face_flux_type psi)
+                         const face_flux_type psi,
+                         const int thread)
 {
   Require(j == 0);
   Require(k == 0);
@@ -111,7 +113,7 @@ CurrentTally<_1D>::tally(const size_t i,
   if (coarse_edge >= 0)
   {
     // Tally.
-    d_partial_current[0][g][d_octant_shift[0][o]][coarse_edge] +=
+    current(0, g, d_octant_shift[0][o], coarse_edge, thread) +=
       psi * d_quadrature->mu(0, a) * d_quadrature->weight(a);
   }
 }
@@ -127,7 +129,8 @@ CurrentTally<D>::tally(const size_t i,
                        const size_t o,
                        const size_t a,
                        const size_t d0,
-                       const double psi)
+                       const double psi,
+                       const int thread)
 {
 
   // Make direction triplet
@@ -163,10 +166,26 @@ CurrentTally<D>::tally(const size_t i,
                 d_coarsemesh->get_fine_mesh()->width(d2, dim[d2]);
 
   // Tally
-  d_partial_current[d0][g][d_octant_shift[d0][o]][idx] +=
+  current(d0, g, d_octant_shift[d0][o], idx, thread) +=
     psi * d_quadrature->cosines(d0)[a] * d_quadrature->weight(a) * area;
 }
 
+//----------------------------------------------------------------------------//
+template <class D>
+inline double& CurrentTally<D>::current(const size_t d,
+                                        const size_t g,
+                                        const size_t sense,
+                                        const size_t idx,
+                                        const int    thread)
+{
+  if (thread >= 0)
+  {
+    Assert((size_t) thread < d_thread_current.size());
+    return d_thread_current[thread][d][sense][idx];
+  }
+  return d_partial_current[d][g][sense][idx];
+}
+
 } // end namespace detran
 
 #endif // detran_CURRENTTALLY_I_HH_ 
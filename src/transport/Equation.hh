@@ -17,6 +17,7 @@
 #include "angle/Quadrature.hh"
 #include "utilities/Definitions.hh"
 #include "utilities/SP.hh"
+#include "utilities/StridedVector.hh"
 
 /**
  *  @namespace  detran
@@ -58,6 +59,9 @@ public:
   /// Dimension of equation.
   static const int dimension = D::dimension;
 
+  /// Number of angles processed together by the batched kernels.
+  enum {BATCH_SIZE = 8};
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -67,7 +71,7 @@ public:
   typedef detran_geometry::Mesh::SP_mesh                  SP_mesh;
   typedef detran_angle::Quadrature::SP_quadrature         SP_quadrature;
   typedef detran_utilities::vec_dbl                       moments_type;
-  typedef detran_utilities::vec_dbl                       angular_flux_type;
+  typedef detran_utilities::StridedVector<double>         angular_flux_type;
   typedef typename EquationTraits<D>::face_flux_type      face_flux_type;
   typedef detran_utilities::size_t                        size_t;
 
@@ -149,8 +153,46 @@ public:
    */
   virtual void setup_angle(const size_t angle) = 0;
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Is the angular flux updated?
+  bool update_psi() const { return d_update_psi; }
+
 protected:
 
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Gather the total cross section of every cell for a group.
+   *
+   *  Material::sigma_t is virtual and indirect through the material map,
+   *  so the kernels use this dense, cell-ordered copy instead.
+   */
+  void setup_sigma_t(const size_t g)
+  {
+    d_sigma_t.resize(d_mat_map.size());
+    for (size_t cell = 0; cell < d_mat_map.size(); ++cell)
+      d_sigma_t[cell] = d_material->sigma_t(d_mat_map[cell], g);
+  }
+
+  /**
+   *  @brief Set the quadrature weights of a batch of angles.
+   *
+   *  Lanes beyond the last angle get a zero weight so that the batched
+   *  kernels can always operate on full batches.
+   */
+  void setup_batch_weights(const size_t a0, const size_t n)
+  {
+    Require(n > 0 && n <= BATCH_SIZE);
+    Require(a0 + n <= d_quadrature->number_angles_octant());
+    for (size_t b = 0; b < BATCH_SIZE; ++b)
+      d_batch_weight[b] = b < n ? d_quadrature->weight(a0 + b) : 0.0;
+  }
+
   //-------------------------------------------------------------------------//
   // DATA
   //-------------------------------------------------------------------------//
@@ -169,6 +211,10 @@ protected:
   double d_ksi;
   /// Material map
   detran_utilities::vec_int d_mat_map;
+  /// Total cross section of each cell for the current group
+  detran_utilities::vec_dbl d_sigma_t;
+  /// Quadrature weights of the current batch of angles
+  double d_batch_weight[BATCH_SIZE];
   /// Update the angular flux?
   bool d_update_psi;
   /// Current group
@@ -19,6 +19,7 @@ Equation_DD_1D::Equation_DD_1D(SP_mesh mesh,
                                const bool update_psi)
   :  Equation<_1D>(mesh, material, quadrature, update_psi)
   ,  d_coef_x(mesh->number_cells_x())
+  ,  d_inv_denominator(mesh->number_cells())
 {
   /* ... */
 }
@@ -29,6 +30,7 @@ void Equation_DD_1D::setup_group(const size_t g)
   Require(g >= 0);
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
 }
 
 //---------------------------------------------------------------------------//
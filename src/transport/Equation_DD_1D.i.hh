@@ -20,9 +20,11 @@ inline void Equation_DD_1D::setup_angle(const size_t angle)
 {
   Require(angle < d_quadrature->number_angles_octant());
   double mu = d_quadrature->mu(0, angle);
+  Require(d_sigma_t.size() == d_mesh->number_cells());
   for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
   {
     d_coef_x[i] = 2.0 * mu / d_mesh->dx(i);
+    d_inv_denominator[i] = 1.0 / (d_sigma_t[i] + d_coef_x[i]);
   }
   d_angle = angle;
 }
@@ -41,10 +43,9 @@ inline void Equation_DD_1D::solve(const size_t       i,
   Require(k == 0);
 
   // Compute cell-center angular flux.
-  size_t cell = d_mesh->index(i);
-  double coef = 1.0 /
-                (d_material->sigma_t(d_mat_map[cell], d_g) + d_coef_x[i]);
-  double psi_center = coef * (source[cell] + d_coef_x[i] * psi_in);
+  size_t cell = i;
+  double psi_center = d_inv_denominator[cell] *
+                      (source[cell] + d_coef_x[i] * psi_in);
 
   // Compute outgoing fluxes.
   psi_out = 2.0*psi_center - psi_in;
@@ -28,9 +28,7 @@ inline void Equation_DD_2D::solve(const size_t       i,
 
   // Compute cell-center angular flux.
   int cell = d_mesh->index(i, j);
-  double coef = 1.0 / (d_material->sigma_t(d_mat_map[cell], d_g) +
-                       d_coef_x[i] + d_coef_y[j]);
-  double psi_center = coef * (source[cell] +
+  double psi_center = d_inv_denominator[cell] * (source[cell] +
                               d_coef_x[i] * psi_in[detran_geometry::Mesh::VERT] +
                               d_coef_y[j] * psi_in[detran_geometry::Mesh::HORZ] );
 
@@ -49,6 +47,37 @@ inline void Equation_DD_2D::solve(const size_t       i,
 
 }
 
+//---------------------------------------------------------------------------//
+inline void Equation_DD_2D::solve_batch(const size_t  i,
+                                        const size_t  j,
+                                        const double *source,
+                                        double       *psi_v,
+                                        double       *psi_h,
+                                        moments_type &phi,
+                                        double       *psi)
+{
+  size_t cell = d_mesh->index(i, j);
+  double sigma = d_sigma_t[cell];
+  const double *coef_x = &d_batch_coef_x[i * BATCH_SIZE];
+  const double *coef_y = &d_batch_coef_y[j * BATCH_SIZE];
+
+  // Same operations as solve, one angle per lane.
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    double coef = 1.0 / (sigma + coef_x[b] + coef_y[b]);
+    psi[b] = coef * (source[b] + coef_x[b] * psi_v[b] + coef_y[b] * psi_h[b]);
+    double two_psi_center = 2.0 * psi[b];
+    psi_v[b] = two_psi_center - psi_v[b];
+    psi_h[b] = two_psi_center - psi_h[b];
+  }
+
+  // Compute flux moments.
+  double phi_cell = 0.0;
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+    phi_cell += d_batch_weight[b] * psi[b];
+  phi[cell] += phi_cell;
+}
+
 } // end namespace detran
 
 #endif /* detran_EQUATION_DD_2D_I_HH_ */
@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "Equation_DD_3D.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -21,6 +22,10 @@ Equation_DD_3D::Equation_DD_3D(SP_mesh       mesh,
   ,  d_coef_x(mesh->number_cells_x())
   ,  d_coef_y(mesh->number_cells_y())
   ,  d_coef_z(mesh->number_cells_z())
+  ,  d_inv_denominator(mesh->number_cells())
+  ,  d_batch_coef_x(mesh->number_cells_x() * BATCH_SIZE)
+  ,  d_batch_coef_y(mesh->number_cells_y() * BATCH_SIZE)
+  ,  d_batch_coef_z(mesh->number_cells_z() * BATCH_SIZE)
 {
   /* ... */
 }
@@ -30,6 +35,7 @@ void Equation_DD_3D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,7 +65,40 @@ void Equation_DD_3D::setup_angle(const size_t angle)
   {
     d_coef_z[k] = 2.0 * xi / d_mesh->dz(k);
   }
+  // The cells are stored with x varying fastest.
+  Require(d_sigma_t.size() == d_mesh->number_cells());
+  size_t cell = 0;
+  for (size_t k = 0; k < d_mesh->number_cells_z(); ++k)
+  {
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+    {
+      for (size_t i = 0; i < d_mesh->number_cells_x(); ++i, ++cell)
+      {
+        d_inv_denominator[cell] =
+          1.0 / (d_sigma_t[cell] + d_coef_x[i] + d_coef_y[j] + d_coef_z[k]);
+      }
+    }
+  }
+}
 
+//---------------------------------------------------------------------------//
+void Equation_DD_3D::setup_batch(const size_t a0, const size_t n)
+{
+  setup_batch_weights(a0, n);
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    // Padded lanes repeat the last angle.
+    size_t a = a0 + std::min(b, n - 1);
+    double mu  = d_quadrature->mu(0, a);
+    double eta = d_quadrature->eta(0, a);
+    double xi  = d_quadrature->xi(0, a);
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+      d_batch_coef_x[i * BATCH_SIZE + b] = 2.0 * mu / d_mesh->dx(i);
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+      d_batch_coef_y[j * BATCH_SIZE + b] = 2.0 * eta / d_mesh->dy(j);
+    for (size_t k = 0; k < d_mesh->number_cells_z(); ++k)
+      d_batch_coef_z[k * BATCH_SIZE + b] = 2.0 * xi / d_mesh->dz(k);
+  }
 }
 
 } // end namespace detran
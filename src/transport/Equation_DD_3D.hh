@@ -73,6 +73,36 @@ public:
   /// Setup the equations for an angle.
   void setup_angle(const size_t angle);
 
+  /// Setup the batched kernel for angles [a0, a0 + n) of the octant.
+  void setup_batch(const size_t a0, const size_t n);
+
+  /**
+   *  @brief Solve one cell for a batch of angles.
+   *
+   *  All arrays are of length BATCH_SIZE, indexed by the angle within
+   *  the batch.  The face fluxes are incident on entry and outgoing on
+   *  exit.
+   *
+   *  @param   i           Cell x index
+   *  @param   j           Cell y index
+   *  @param   k           Cell z index
+   *  @param   source      Sweep source for this cell
+   *  @param   psi_yz      Fluxes on the yz face
+   *  @param   psi_xz      Fluxes on the xz face
+   *  @param   psi_xy      Fluxes on the xy face
+   *  @param   phi         Reference to flux moments for this group
+   *  @param   psi         Cell-center angular fluxes (output)
+   */
+  inline void solve_batch(const size_t  i,
+                          const size_t  j,
+                          const size_t  k,
+                          const double *source,
+                          double       *psi_yz,
+                          double       *psi_xz,
+                          double       *psi_xy,
+                          moments_type &phi,
+                          double       *psi);
+
 
 private:
 
@@ -84,6 +114,18 @@ private:
 
   /// Z-directed coefficient, \f$ 2|\xi|/\Delta_z \f$.
   detran_utilities::vec_dbl d_coef_z;
+
+  /// Reciprocal of the cell balance denominator for the current angle.
+  detran_utilities::vec_dbl d_inv_denominator;
+
+  /// X-directed coefficients of the current batch, [i][angle]
+  detran_utilities::vec_dbl d_batch_coef_x;
+
+  /// Y-directed coefficients of the current batch, [j][angle]
+  detran_utilities::vec_dbl d_batch_coef_y;
+
+  /// Z-directed coefficients of the current batch, [k][angle]
+  detran_utilities::vec_dbl d_batch_coef_z;
 };
 
 } // end namespace detran
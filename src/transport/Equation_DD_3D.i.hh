@@ -27,11 +27,10 @@ inline void Equation_DD_3D::solve(const size_t i,
 
   // Compute cell-center angular flux.
   int cell = d_mesh->index(i, j, k);
-  double coef = 1.0 / (d_material->sigma_t(d_mat_map[cell], d_g) +
-                       d_coef_x[i] + d_coef_y[j] + d_coef_z[k]);
-  double psi_center = coef * (source[cell] + d_coef_x[i] * psi_in[Mesh::YZ] +
-                                             d_coef_y[j] * psi_in[Mesh::XZ] +
-                                             d_coef_z[k] * psi_in[Mesh::XY]);
+  double psi_center = d_inv_denominator[cell] *
+                      (source[cell] + d_coef_x[i] * psi_in[Mesh::YZ] +
+                                      d_coef_y[j] * psi_in[Mesh::XZ] +
+                                      d_coef_z[k] * psi_in[Mesh::XY]);
 
   // Compute outgoing fluxes.
   double two_psi_center = 2.0 * psi_center;
@@ -47,6 +46,43 @@ inline void Equation_DD_3D::solve(const size_t i,
 
 }
 
+//---------------------------------------------------------------------------//
+inline void Equation_DD_3D::solve_batch(const size_t  i,
+                                        const size_t  j,
+                                        const size_t  k,
+                                        const double *source,
+                                        double       *psi_yz,
+                                        double       *psi_xz,
+                                        double       *psi_xy,
+                                        moments_type &phi,
+                                        double       *psi)
+{
+  size_t cell = d_mesh->index(i, j, k);
+  double sigma = d_sigma_t[cell];
+  const double *coef_x = &d_batch_coef_x[i * BATCH_SIZE];
+  const double *coef_y = &d_batch_coef_y[j * BATCH_SIZE];
+  const double *coef_z = &d_batch_coef_z[k * BATCH_SIZE];
+
+  // Same operations as solve, one angle per lane.
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    double coef = 1.0 / (sigma + coef_x[b] + coef_y[b] + coef_z[b]);
+    psi[b] = coef * (source[b] + coef_x[b] * psi_yz[b] +
+                                 coef_y[b] * psi_xz[b] +
+                                 coef_z[b] * psi_xy[b]);
+    double two_psi_center = 2.0 * psi[b];
+    psi_yz[b] = two_psi_center - psi_yz[b];
+    psi_xz[b] = two_psi_center - psi_xz[b];
+    psi_xy[b] = two_psi_center - psi_xy[b];
+  }
+
+  // Compute flux moments.
+  double phi_cell = 0.0;
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+    phi_cell += d_batch_weight[b] * psi[b];
+  phi[cell] += phi_cell;
+}
+
 } // end namespace detran
 
 #endif /* detran_EQUATION_DD_3D_I_HH_ */
@@ -12,6 +12,7 @@
 
 #include "transport/transport_export.hh"
 #include "DimensionTraits.hh"
+#include "transport/Exponential.hh"
 #include "angle/ProductQuadrature.hh"
 #include "material/Material.hh"
 #include "geometry/Mesh.hh"
@@ -19,6 +20,7 @@
 #include "geometry/Track.hh"
 #include "utilities/Definitions.hh"
 #include "utilities/SP.hh"
+#include "utilities/StridedVector.hh"
 
 namespace detran
 {
@@ -44,8 +46,9 @@ public:
   typedef detran_geometry::TrackDB::SP_trackdb            SP_trackdb;
   typedef detran_angle::ProductQuadrature::SP_quadrature  SP_quadrature;
   typedef detran_utilities::vec_dbl                       moments_type;
-  typedef detran_utilities::vec_dbl                       angular_flux_type;
+  typedef detran_utilities::StridedVector<double>         angular_flux_type;
   typedef detran_utilities::size_t                        size_t;
+  typedef Exponential::SP_exponential                     SP_exponential;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -66,6 +69,7 @@ public:
     ,  d_g(-1)
     ,  d_octant(-1)
     ,  d_angle(-1)
+    ,  d_exp(new Exponential())
   {
     Require(mesh);
     Require(material);
@@ -101,6 +105,52 @@ public:
                             moments_type      &phi,
                             angular_flux_type &psi) = 0;
 
+  /**
+   *  @brief Solve using precomputed attenuation coefficients.
+   *
+   *  @param   region      Flat source region (cardinal mesh index)
+   *  @param   length      Segment length
+   *  @param   width       Track width
+   *  @param   coef        Coefficients from coefficients() for this
+   *                       segment and the current group and polar angle
+   *  @param   source      Reference to sweep source vector for this group
+   *  @param   psi_in      Incident flux for this cell
+   *  @param   psi_out     Outgoing flux from this cell
+   *  @param   phi         Reference to flux moments for this group
+   *  @param   psi         Reference to angular flux for this group
+   */
+  virtual inline void solve(const size_t       region,
+                            const double       length,
+                            const double       width,
+                            const double      *coef,
+                            moments_type      &source,
+                            double            &psi_in,
+                            double            &psi_out,
+                            moments_type      &phi,
+                            angular_flux_type &psi) = 0;
+
+  /**
+   *  @brief Compute the attenuation coefficients of a segment.
+   *
+   *  @param   region      Flat source region (cardinal mesh index)
+   *  @param   length      Segment length
+   *  @param   coef        Coefficients for the current group and polar
+   *                       angle, of length number_coefficients()
+   */
+  virtual inline void coefficients(const size_t  region,
+                                   const double  length,
+                                   double       *coef) = 0;
+
+  /// Number of attenuation coefficients stored per segment
+  virtual size_t number_coefficients() const = 0;
+
+  /// Set the kernel used to evaluate exponentials.
+  void set_exponential(SP_exponential e)
+  {
+    Require(e);
+    d_exp = e;
+  }
+
   /**
    *  @brief Setup the equations for a group.
    *  @param g     Current group.
@@ -163,6 +213,8 @@ protected:
   size_t d_azimuth;
   /// Current polar.
   size_t d_polar;
+  /// Exponential kernel
+  SP_exponential d_exp;
 
 };
 
@@ -19,6 +19,8 @@ Equation_SC_1D::Equation_SC_1D(SP_mesh mesh,
                                bool update_psi)
   :  Equation<_1D>(mesh, material, quadrature, update_psi)
   ,  d_mu(-1.0)
+  ,  d_A(mesh->number_cells())
+  ,  d_F(mesh->number_cells())
 {
   /* ... */
 }
@@ -28,6 +30,10 @@ void Equation_SC_1D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
+  d_inv_sigma_t.resize(d_sigma_t.size());
+  for (size_t cell = 0; cell < d_sigma_t.size(); ++cell)
+    d_inv_sigma_t[cell] = 1.0 / d_sigma_t[cell];
 }
 
 //---------------------------------------------------------------------------//
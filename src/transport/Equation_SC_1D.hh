@@ -104,6 +104,15 @@ private:
   /// Cosine
   double d_mu;
 
+  /// Inverse total cross section of each cell for the current group
+  detran_utilities::vec_dbl d_inv_sigma_t;
+
+  /// Cell attenuation factors, \f$ e^{-\tau} \f$, for the current angle
+  detran_utilities::vec_dbl d_A;
+
+  /// Cell escape factors, \f$ (1 - e^{-\tau})/\tau \f$, for the current angle
+  detran_utilities::vec_dbl d_F;
+
 };
 
 } // end namespace detran
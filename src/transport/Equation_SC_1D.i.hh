@@ -10,6 +10,7 @@
 #ifndef EQUATION_SC_1D_I_HH_
 #define EQUATION_SC_1D_I_HH_
 
+#include <cmath>
 #include <iostream>
 
 namespace detran
@@ -21,6 +22,18 @@ inline void Equation_SC_1D::setup_angle(const size_t angle)
   Require(angle < d_quadrature->number_angles_octant());
   d_angle = angle;
   d_mu = d_quadrature->mu(0, d_angle);
+  Require(d_mu > 0.0);
+  Require(d_sigma_t.size() == d_mesh->number_cells());
+
+  // The exponentials depend only on the cell and angle, so they are
+  // evaluated here rather than in the sweep recurrence.
+  double inv_mu = 1.0 / d_mu;
+  for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+  {
+    double tau = d_sigma_t[i] * d_mesh->dx(i) * inv_mu;
+    d_A[i] = std::exp(-tau);
+    d_F[i] = (1.0 - d_A[i]) / tau;
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -39,18 +52,15 @@ inline void Equation_SC_1D::solve(const size_t i,
   Require(d_mu > 0.0);
 
   // Compute cell-center angular flux.
-  double sigma = d_material->sigma_t(d_mat_map[i], d_g);
-  double tau   = sigma * d_mesh->dx(i) / d_mu;
-  double A     = std::exp(-tau);
-  double q     = source[i];
+  double A = d_A[i];
+  double F = d_F[i];
+  double q = source[i] * d_inv_sigma_t[i];
 
   // Cell average flux
-  double psi_avg = psi_in * (1.0 - A) / tau +
-                   q * (sigma * d_mesh->dx(i) + d_mu * (A - 1.0)) /
-                       (sigma * sigma * d_mesh->dx(i));
+  double psi_avg = psi_in * F + q * (1.0 - F);
 
   // Compute outgoing fluxes.
-  psi_out = A * psi_in + q * (1.0 - A) / sigma;
+  psi_out = A * psi_in + q * (1.0 - A);
 
   // Compute flux moments.
   phi[i] += d_quadrature->weight(d_angle) * psi_avg;
@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "Equation_SC_2D.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -20,6 +21,12 @@ Equation_SC_2D::Equation_SC_2D(SP_mesh       mesh,
   :  Equation<_2D>(mesh, material, quadrature, update_psi)
   ,  d_alpha(mesh->number_cells_x())
   ,  d_beta(mesh->number_cells_y())
+  ,  d_inv_alpha(mesh->number_cells_x())
+  ,  d_inv_beta(mesh->number_cells_y())
+  ,  d_batch_alpha(mesh->number_cells_x() * BATCH_SIZE)
+  ,  d_batch_beta(mesh->number_cells_y() * BATCH_SIZE)
+  ,  d_batch_inv_alpha(mesh->number_cells_x() * BATCH_SIZE)
+  ,  d_batch_inv_beta(mesh->number_cells_y() * BATCH_SIZE)
 {
   /* ... */
 }
@@ -30,6 +37,10 @@ void Equation_SC_2D::setup_group(const size_t g)
   Require(g >= 0);
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
+  d_inv_sigma_t.resize(d_sigma_t.size());
+  for (size_t cell = 0; cell < d_sigma_t.size(); ++cell)
+    d_inv_sigma_t[cell] = 1.0 / d_sigma_t[cell];
 }
 
 //---------------------------------------------------------------------------//
@@ -50,10 +61,37 @@ void Equation_SC_2D::setup_angle(const size_t angle)
   for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
   {
     d_alpha[i] = d_mesh->dx(i) / mu;
+    d_inv_alpha[i] = 1.0 / d_alpha[i];
   }
   for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
   {
     d_beta[j] = d_mesh->dy(j) / eta;
+    d_inv_beta[j] = 1.0 / d_beta[j];
+  }
+}
+
+//---------------------------------------------------------------------------//
+void Equation_SC_2D::setup_batch(const size_t a0, const size_t n)
+{
+  setup_batch_weights(a0, n);
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    // Padded lanes repeat the last angle.
+    size_t a = a0 + std::min(b, n - 1);
+    double mu  = d_quadrature->mu(0, a);
+    double eta = d_quadrature->eta(0, a);
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+    {
+      d_batch_alpha[i * BATCH_SIZE + b] = d_mesh->dx(i) / mu;
+      d_batch_inv_alpha[i * BATCH_SIZE + b] =
+        1.0 / d_batch_alpha[i * BATCH_SIZE + b];
+    }
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+    {
+      d_batch_beta[j * BATCH_SIZE + b] = d_mesh->dy(j) / eta;
+      d_batch_inv_beta[j * BATCH_SIZE + b] =
+        1.0 / d_batch_beta[j * BATCH_SIZE + b];
+    }
   }
 }
 
@@ -35,11 +35,15 @@ inline void Equation_SC_2D::solve(const size_t       i,
   typedef detran_geometry::Mesh Mesh;
 
   int cell = d_mesh->index(i, j);
-  double sigma = d_material->sigma_t(d_mat_map[cell], d_g);
-  double Q = source[cell] / sigma;
+  double sigma = d_sigma_t[cell];
+  double inv_sigma = d_inv_sigma_t[cell];
+  double Q = source[cell] * inv_sigma;
   double alpha = sigma * d_alpha[i];
   double beta = sigma * d_beta[j];
-  double rho = alpha / beta; // \todo sigma cancels? precompute alpha/beta?
+  double inv_alpha = inv_sigma * d_inv_alpha[i];
+  double inv_beta = inv_sigma * d_inv_beta[j];
+  // Note sigma cancels in the ratio of optical thicknesses.
+  double rho = d_alpha[i] * d_inv_beta[j];
   double psi_in_V_minus_Q = psi_in[Mesh::VERT] - Q;
   double psi_in_H_minus_Q = psi_in[Mesh::HORZ] - Q;
 
@@ -47,7 +51,7 @@ inline void Equation_SC_2D::solve(const size_t       i,
   if (rho <= 1.0)
   {
     double expf = exp_appx(-alpha);
-    double one_m_exp_alpha = (1.0 - expf) / alpha;
+    double one_m_exp_alpha = (1.0 - expf) * inv_alpha;
     psi_out[Mesh::VERT] = Q + psi_in_V_minus_Q * (1.0 - rho) * expf
                             + psi_in_H_minus_Q * rho * one_m_exp_alpha;
     psi_out[Mesh::HORZ] = Q + psi_in_V_minus_Q * one_m_exp_alpha;
@@ -55,15 +59,16 @@ inline void Equation_SC_2D::solve(const size_t       i,
   else
   {
     double expf = exp_appx(-beta);
-    double one_m_exp_beta = (1.0 - expf) / beta;
+    double one_m_exp_beta = (1.0 - expf) * inv_beta;
+    double inv_rho = d_beta[j] * d_inv_alpha[i];
     psi_out[Mesh::VERT] = Q + psi_in_H_minus_Q * one_m_exp_beta;
-    psi_out[Mesh::HORZ] = Q + psi_in_V_minus_Q * one_m_exp_beta / rho
-                            + psi_in_H_minus_Q * (1.0 - 1.0/rho) * expf;
+    psi_out[Mesh::HORZ] = Q + psi_in_V_minus_Q * one_m_exp_beta * inv_rho
+                            + psi_in_H_minus_Q * (1.0 - inv_rho) * expf;
   }
 
   // Compute cell center flux.
-  double psi_center = Q - (psi_out[Mesh::VERT] - psi_in[Mesh::VERT])/alpha
-                        - (psi_out[Mesh::HORZ] - psi_in[Mesh::HORZ])/beta;
+  double psi_center = Q - (psi_out[Mesh::VERT] - psi_in[Mesh::VERT])*inv_alpha
+                        - (psi_out[Mesh::HORZ] - psi_in[Mesh::HORZ])*inv_beta;
 
   // Compute flux moments.
   phi[cell] += d_quadrature->weight(d_angle) * psi_center;
@@ -73,6 +78,65 @@ inline void Equation_SC_2D::solve(const size_t       i,
 
 }
 
+//---------------------------------------------------------------------------//
+inline void Equation_SC_2D::solve_batch(const size_t  i,
+                                        const size_t  j,
+                                        const double *source,
+                                        double       *psi_v,
+                                        double       *psi_h,
+                                        moments_type &phi,
+                                        double       *psi)
+{
+  size_t cell = d_mesh->index(i, j);
+  double sigma = d_sigma_t[cell];
+  double inv_sigma = d_inv_sigma_t[cell];
+  const double *alpha_0     = &d_batch_alpha[i * BATCH_SIZE];
+  const double *beta_0      = &d_batch_beta[j * BATCH_SIZE];
+  const double *inv_alpha_0 = &d_batch_inv_alpha[i * BATCH_SIZE];
+  const double *inv_beta_0  = &d_batch_inv_beta[j * BATCH_SIZE];
+
+  // Same operations as solve, one angle per lane.
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    double Q = source[b] * inv_sigma;
+    double alpha = sigma * alpha_0[b];
+    double beta = sigma * beta_0[b];
+    double inv_alpha = inv_sigma * inv_alpha_0[b];
+    double inv_beta = inv_sigma * inv_beta_0[b];
+    double rho = alpha_0[b] * inv_beta_0[b];
+    double psi_in_V = psi_v[b];
+    double psi_in_H = psi_h[b];
+    double psi_in_V_minus_Q = psi_in_V - Q;
+    double psi_in_H_minus_Q = psi_in_H - Q;
+    if (rho <= 1.0)
+    {
+      double expf = exp_appx(-alpha);
+      double one_m_exp_alpha = (1.0 - expf) * inv_alpha;
+      psi_v[b] = Q + psi_in_V_minus_Q * (1.0 - rho) * expf
+                   + psi_in_H_minus_Q * rho * one_m_exp_alpha;
+      psi_h[b] = Q + psi_in_V_minus_Q * one_m_exp_alpha;
+    }
+    else
+    {
+      double expf = exp_appx(-beta);
+      double one_m_exp_beta = (1.0 - expf) * inv_beta;
+      double inv_rho = beta_0[b] * inv_alpha_0[b];
+      psi_v[b] = Q + psi_in_H_minus_Q * one_m_exp_beta;
+      psi_h[b] = Q + psi_in_V_minus_Q * one_m_exp_beta * inv_rho
+                   + psi_in_H_minus_Q * (1.0 - inv_rho) * expf;
+    }
+    psi[b] = Q - (psi_v[b] - psi_in_V) * inv_alpha
+               - (psi_h[b] - psi_in_H) * inv_beta;
+  }
+
+  // Compute flux moments.
+  double phi_cell = 0.0;
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+    phi_cell += d_batch_weight[b] * psi[b];
+  phi[cell] += phi_cell;
+}
+
+//---------------------------------------------------------------------------//
 /// \todo It might be worth finding a faster exponential.
 inline double Equation_SC_2D::exp_appx(double x)
 {
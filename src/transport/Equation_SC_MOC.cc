@@ -20,11 +20,18 @@ Equation_SC_MOC::Equation_SC_MOC(SP_mesh       mesh,
   : Equation_MOC(mesh, material, quadrature, update_psi)
   , d_weights(quadrature->number_polar_octant(), 0.0)
   , d_inv_sin(quadrature->number_polar_octant(), 0.0)
+  , d_sin(quadrature->number_polar_octant(), 0.0)
+  , d_inv_volume(mesh->number_cells(), 0.0)
+  , d_sigma_t(mesh->number_cells(), 0.0)
+  , d_inv_sigma_t(mesh->number_cells(), 0.0)
 {
   for (size_t p = 0; p < d_quadrature->number_polar_octant(); ++p)
   {
-    d_inv_sin[p] = 1.0 / d_quadrature->sin_theta(p);
+    d_sin[p]     = d_quadrature->sin_theta(p);
+    d_inv_sin[p] = 1.0 / d_sin[p];
   }
+  for (size_t i = 0; i < d_mesh->number_cells(); ++i)
+    d_inv_volume[i] = 1.0 / d_mesh->volume(i);
 }
 
 //---------------------------------------------------------------------------//
@@ -32,6 +39,11 @@ void Equation_SC_MOC::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
   d_g = g;
+  for (size_t i = 0; i < d_mesh->number_cells(); ++i)
+  {
+    d_sigma_t[i]     = d_material->sigma_t(d_mat_map[i], g);
+    d_inv_sigma_t[i] = 1.0 / d_sigma_t[i];
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -89,6 +89,24 @@ public:
                     moments_type      &phi,
                     angular_flux_type &psi);
 
+  /// Solve using precomputed coefficients.
+  inline void solve(const size_t       region,
+                    const double       length,
+                    const double       width,
+                    const double      *coef,
+                    moments_type      &source,
+                    double            &psi_in,
+                    double            &psi_out,
+                    moments_type      &phi,
+                    angular_flux_type &psi);
+
+  /// Compute A, B, and C for a segment.
+  inline void coefficients(const size_t  region,
+                           const double  length,
+                           double       *coef);
+
+  /// Three coefficients (A, B, and C) are stored per segment.
+  size_t number_coefficients() const {return 3;}
 
   /// Setup the equations for a group.
   void setup_group(const size_t g);
@@ -114,6 +132,18 @@ private:
   /// Inverse polar sines
   detran_utilities::vec_dbl d_inv_sin;
 
+  /// Polar sines
+  detran_utilities::vec_dbl d_sin;
+
+  /// Inverse region volumes
+  detran_utilities::vec_dbl d_inv_volume;
+
+  /// Total cross section of each region in the current group
+  detran_utilities::vec_dbl d_sigma_t;
+
+  /// Inverse total cross section of each region in the current group
+  detran_utilities::vec_dbl d_inv_sigma_t;
+
 };
 
 } // end namespace detran
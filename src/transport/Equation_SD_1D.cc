@@ -19,6 +19,7 @@ Equation_SD_1D::Equation_SD_1D(SP_mesh mesh,
                                bool update_psi)
   :  Equation<_1D>(mesh, material, quadrature, update_psi)
   ,  d_coef_x(mesh->number_cells_x())
+  ,  d_inv_denominator(mesh->number_cells())
 {
   /* ... */
 }
@@ -28,6 +29,7 @@ void Equation_SD_1D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
 }
 
 //---------------------------------------------------------------------------//
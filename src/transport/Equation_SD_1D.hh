@@ -95,6 +95,9 @@ private:
   /// X-directed coefficient, \f$ 2|\mu|/\Delta_x \f$.
   detran_utilities::vec_dbl d_coef_x;
 
+  /// Reciprocal of the cell balance denominator for the current angle.
+  detran_utilities::vec_dbl d_inv_denominator;
+
 };
 
 } // end namespace detran
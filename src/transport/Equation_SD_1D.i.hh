@@ -21,9 +21,11 @@ inline void Equation_SD_1D::setup_angle(const size_t angle)
   Require(angle < d_quadrature->number_angles_octant());
   d_angle = angle;
   double mu  = d_quadrature->mu(0, d_angle);
+  Require(d_sigma_t.size() == d_mesh->number_cells());
   for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
   {
     d_coef_x[i] = mu / d_mesh->dx(i);
+    d_inv_denominator[i] = 1.0 / (d_sigma_t[i] + d_coef_x[i]);
   }
 
 }
@@ -43,10 +45,9 @@ inline void Equation_SD_1D::solve(const size_t i,
   Require(k == 0);
 
   // Compute cell-center angular flux.
-  int cell = d_mesh->index(i);
-  double coef = 1.0 /
-                (d_material->sigma_t(d_mat_map[cell], d_g) + d_coef_x[i]);
-  double psi_center = coef * (source[cell] + d_coef_x[i] * psi_in);
+  size_t cell = i;
+  double psi_center = d_inv_denominator[cell] *
+                      (source[cell] + d_coef_x[i] * psi_in);
 
   // Compute outgoing fluxes.
   psi_out = psi_center;
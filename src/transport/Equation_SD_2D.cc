@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "Equation_SD_2D.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -20,6 +21,9 @@ Equation_SD_2D::Equation_SD_2D(SP_mesh mesh,
   :  Equation<_2D>(mesh, material, quadrature, update_psi)
   ,  d_coef_x(mesh->number_cells_x())
   ,  d_coef_y(mesh->number_cells_y())
+  ,  d_inv_denominator(mesh->number_cells())
+  ,  d_batch_coef_x(mesh->number_cells_x() * BATCH_SIZE)
+  ,  d_batch_coef_y(mesh->number_cells_y() * BATCH_SIZE)
 {
   /* ... */
 }
@@ -30,6 +34,7 @@ void Equation_SD_2D::setup_group(const size_t g)
   Require(g >= 0);
   Require(g < d_material->number_groups());
   d_g = g;
+  setup_sigma_t(g);
 }
 
 //---------------------------------------------------------------------------//
@@ -55,7 +60,35 @@ void Equation_SD_2D::setup_angle(const size_t angle)
   {
     d_coef_y[j] = eta / d_mesh->dy(j);
   }
+  // The cells are stored with x varying fastest.
+  Require(d_sigma_t.size() == d_mesh->number_cells());
+  size_t cell = 0;
+  for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+  {
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i, ++cell)
+    {
+      d_inv_denominator[cell] =
+        1.0 / (d_sigma_t[cell] + d_coef_x[i] + d_coef_y[j]);
+    }
+  }
+
+}
 
+//---------------------------------------------------------------------------//
+void Equation_SD_2D::setup_batch(const size_t a0, const size_t n)
+{
+  setup_batch_weights(a0, n);
+  for (size_t b = 0; b < BATCH_SIZE; ++b)
+  {
+    // Padded lanes repeat the last angle.
+    size_t a = a0 + std::min(b, n - 1);
+    double mu  = d_quadrature->mu(0, a);
+    double eta = d_quadrature->eta(0, a);
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+      d_batch_coef_x[i * BATCH_SIZE + b] = mu / d_mesh->dx(i);
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+      d_batch_coef_y[j * BATCH_SIZE + b] = eta / d_mesh->dy(j);
+  }
 }
 
 } // end namespace detran
@@ -70,6 +70,32 @@ public:
   /// Setup the equations for an angle.
   void setup_angle(const size_t angle);
 
+  /// Setup the batched kernel for angles [a0, a0 + n) of the octant.
+  void setup_batch(const size_t a0, const size_t n);
+
+  /**
+   *  @brief Solve one cell for a batch of angles.
+   *
+   *  All arrays are of length BATCH_SIZE, indexed by the angle within
+   *  the batch.  The face fluxes are incident on entry and outgoing on
+   *  exit.
+   *
+   *  @param   i           Cell x index
+   *  @param   j           Cell y index
+   *  @param   source      Sweep source for this cell
+   *  @param   psi_v       Vertical face fluxes
+   *  @param   psi_h       Horizontal face fluxes
+   *  @param   phi         Reference to flux moments for this group
+   *  @param   psi         Cell-center angular fluxes (output)
+   */
+  inline void solve_batch(const size_t  i,
+                          const size_t  j,
+                          const double *source,
+                          double       *psi_v,
+                          double       *psi_h,
+                          moments_type &phi,
+                          double       *psi);
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -82,6 +108,15 @@ private:
   /// Y-directed coefficient, \f$ 2|\eta|/\Delta_y \f$.
   detran_utilities::vec_dbl d_coef_y;
 
+  /// Reciprocal of the cell balance denominator for the current angle.
+  detran_utilities::vec_dbl d_inv_denominator;
+
+  /// X-directed coefficients of the current batch, [i][angle]
+  detran_utilities::vec_dbl d_batch_coef_x;
+
+  /// Y-directed coefficients of the current batch, [j][angle]
+  detran_utilities::vec_dbl d_batch_coef_y;
+
 };
 
 } // end namespace detran
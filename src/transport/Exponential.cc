@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  Exponential.cc
+ *  @brief Exponential member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#include "Exponential.hh"
+#include "utilities/DBC.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+Exponential::Exponential(const int type, const double tolerance)
+  : d_type(type)
+  , d_tau_max(0.0)
+  , d_inv_delta(0.0)
+{
+  Insist(d_type < END_EXP_TYPES, "Unsupported exponential type");
+  Require(tolerance > 0.0);
+
+  if (d_type == TABLE)
+  {
+    // The error of linear interpolation on [x, x + h] is bounded by
+    // h^2 max|f''| / 8, and |f''| <= 1 for exp(-x), x >= 0.  Beyond
+    // tau_max, exp(-tau) is itself below the tolerance, but the exact
+    // value is used there since those segments are rare.
+    d_tau_max = std::max(-std::log(tolerance), 1.0);
+    double delta = std::sqrt(8.0 * tolerance);
+    size_t n = size_t(std::ceil(d_tau_max / delta));
+    delta = d_tau_max / n;
+    d_inv_delta = 1.0 / delta;
+    d_table.resize(2 * n, 0.0);
+    for (size_t i = 0; i < n; ++i)
+    {
+      double x_0 = i * delta;
+      double f_0 = std::exp(-x_0);
+      double f_1 = std::exp(-x_0 - delta);
+      double slope = (f_1 - f_0) * d_inv_delta;
+      d_table[2 * i    ] = f_0 - slope * x_0;
+      d_table[2 * i + 1] = slope;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+Exponential::SP_exponential Exponential::Create(SP_input input)
+{
+  int type = EXACT;
+  double tolerance = 1e-6;
+  if (input)
+  {
+    if (input->check("moc_exp_type"))
+    {
+      std::string s = input->get<std::string>("moc_exp_type");
+      if (s == "exact")
+        type = EXACT;
+      else if (s == "table")
+        type = TABLE;
+      else if (s == "rational")
+        type = RATIONAL;
+      else
+        THROW("Unsupported moc_exp_type: " + s);
+    }
+    if (input->check("moc_exp_tolerance"))
+      tolerance = input->get<double>("moc_exp_tolerance");
+  }
+  SP_exponential p(new Exponential(type, tolerance));
+  return p;
+}
+
+} // end namespace detran
+
+//----------------------------------------------------------------------------//
+//              end of file Exponential.cc
+//----------------------------------------------------------------------------//
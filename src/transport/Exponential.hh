@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  Exponential.hh
+ *  @brief Exponential class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_EXPONENTIAL_HH_
+#define detran_EXPONENTIAL_HH_
+
+#include "transport/transport_export.hh"
+#include "utilities/Definitions.hh"
+#include "utilities/InputDB.hh"
+#include "utilities/SP.hh"
+#include <string>
+
+namespace detran
+{
+
+/**
+ *  @class Exponential
+ *  @brief Evaluates the attenuation factor @f$ e^{-\tau} @f$ for MOC
+ *
+ *  Characteristic sweeps spend much of their time evaluating an
+ *  exponential for every segment, polar angle, and sweep.  Since the
+ *  optical path length is nonnegative and the result need only be as
+ *  accurate as the rest of the discretization, cheaper kernels can be
+ *  used in place of std::exp:
+ *    - exact:    std::exp
+ *    - table:    linear interpolation on a uniform table whose spacing
+ *                is chosen so the absolute error is below a tolerance
+ *    - rational: range reduction by powers of two followed by a (3, 3)
+ *                Pade approximant, with relative error below 1e-8
+ *
+ *  Relevant database entries:
+ *    - moc_exp_type      [string] exact (default), table, or rational
+ *    - moc_exp_tolerance [double] maximum absolute error of the table
+ *                                 (default 1e-6)
+ */
+/**
+ *  @example transport/test/test_Exponential.cc
+ *
+ *  Test of Exponential class
+ */
+class TRANSPORT_EXPORT Exponential
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //--------------------------------------------------------------------------//
+
+  enum EXP_TYPES
+  {
+    EXACT, TABLE, RATIONAL, END_EXP_TYPES
+  };
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<Exponential>     SP_exponential;
+  typedef detran_utilities::InputDB::SP_input   SP_input;
+  typedef detran_utilities::vec_dbl             vec_dbl;
+  typedef detran_utilities::size_t              size_t;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //--------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param type       kernel type
+   *  @param tolerance  maximum absolute error for the table
+   */
+  explicit Exponential(const int type = EXACT, const double tolerance = 1e-6);
+
+  /// SP constructor from an input database
+  static SP_exponential Create(SP_input input);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  /// Evaluate @f$ e^{-\tau} @f$ for @f$ \tau \ge 0 @f$.
+  inline double operator()(const double tau) const;
+
+  /// Kernel type
+  int type() const {return d_type;}
+
+  /// Number of table intervals
+  size_t table_size() const {return d_table.size() / 2;}
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Kernel type
+  int d_type;
+  /// Table upper bound; beyond it, the exact exponential is used
+  double d_tau_max;
+  /// Inverse table spacing
+  double d_inv_delta;
+  /// Table intercepts and slopes, interleaved by interval
+  vec_dbl d_table;
+
+  //--------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //--------------------------------------------------------------------------//
+
+  inline double exp_table(const double tau) const;
+  inline double exp_rational(const double tau) const;
+
+};
+
+} // end namespace detran
+
+//----------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//----------------------------------------------------------------------------//
+
+#include "Exponential.i.hh"
+
+#endif /* detran_EXPONENTIAL_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file Exponential.hh
+//----------------------------------------------------------------------------//
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  Exponential.i.hh
+ *  @brief Exponential inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_EXPONENTIAL_I_HH_
+#define detran_EXPONENTIAL_I_HH_
+
+#include "utilities/DBC.hh"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+namespace detran
+{
+
+//----------------------------------------------------------------------------//
+inline double Exponential::operator()(const double tau) const
+{
+  Require(tau >= 0.0);
+  if (d_type == TABLE)
+    return exp_table(tau);
+  else if (d_type == RATIONAL)
+    return exp_rational(tau);
+  return std::exp(-tau);
+}
+
+//----------------------------------------------------------------------------//
+inline double Exponential::exp_table(const double tau) const
+{
+  if (tau >= d_tau_max) return std::exp(-tau);
+  // Rounding can map tau just below d_tau_max to one past the last interval.
+  size_t i = std::min(size_t(tau * d_inv_delta), table_size() - 1);
+  return d_table[2 * i] + d_table[2 * i + 1] * tau;
+}
+
+//----------------------------------------------------------------------------//
+inline double Exponential::exp_rational(const double tau) const
+{
+  // Write tau = k*ln(2) + r with |r| <= ln(2)/2, so exp(-tau) = 2^-k exp(-r).
+  const double ln2     = 0.693147180559945309;
+  const double inv_ln2 = 1.442695040888963407;
+  // The scaling 2^-k is built directly from the exponent bits.
+  if (tau > 700.0) return 0.0;
+  int k = int(tau * inv_ln2 + 0.5);
+  double r = tau - k * ln2;
+  // (3, 3) Pade approximant of exp(-r).
+  double r2 = r * r;
+  double even = 120.0 + 12.0 * r2;
+  double odd  = r * (60.0 + r2);
+  uint64_t bits = uint64_t(1023 - k) << 52;
+  double scale;
+  std::memcpy(&scale, &bits, sizeof(double));
+  return scale * (even - odd) / (even + odd);
+}
+
+} // end namespace detran
+
+#endif /* detran_EXPONENTIAL_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file Exponential.i.hh
+//----------------------------------------------------------------------------//
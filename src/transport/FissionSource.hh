@@ -23,6 +23,11 @@ namespace detran
 /**
  *  @class FissionSource
  *  @brief Defines the isotropic source from fission reactions.
+ *
+ *  The density and group sources are built per cell from the contiguous
+ *  @f$ \nu\Sigma_f @f$ and @f$ \chi @f$ of the cell's material (see
+ *  Material::nu_sigma_f_block), accumulating over groups in one pass,
+ *  and the cell loops are threaded.
  */
 class TRANSPORT_EXPORT FissionSource
 {
@@ -41,6 +46,7 @@ public:
   typedef detran_utilities::size_t                  size_t;
   typedef State::moments_type                       moments_type;
   typedef State::vec_moments_type                   vec_moments_type;
+  typedef std::vector<const double*>                vec_ptr;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -222,6 +228,21 @@ private:
   size_t g_from(const size_t g, const size_t gp) const;
   /// the "to" group
   size_t g_to(const size_t g, const size_t gp) const;
+  /// Contribution of each group to the density (nu*sigma_f, or chi if adjoint)
+  const double* weight(const size_t m) const;
+  /// Group spectrum of the density (chi, or nu*sigma_f if adjoint)
+  const double* spectrum(const size_t m) const;
+  /**
+   *  @brief Add the fission source from a set of fluxes into group g
+   *  @param g        Group of source being constructed
+   *  @param phi      Fluxes of all groups
+   *  @param skip     Flag to exclude group g itself
+   *  @param source   Moment vector of group source to contribute to
+   */
+  void gather(const size_t    g,
+              const vec_ptr  &phi,
+              const bool      skip,
+              moments_type   &source) const;
 
 };
 
@@ -16,31 +16,31 @@ namespace detran
 inline void FissionSource::setup_outer(const double scale)
 {
   d_scale = scale;
-  for (size_t g = 0; g < d_material->number_groups(); ++g)
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      double v = d_adjoint ? d_material->nu_sigma_f(d_mat_map[cell], g)
-                           : d_material->chi(d_mat_map[cell], g);
-      d_source[g][cell] = d_scale * d_density[cell] * v;
-    }
+    const double *v = spectrum(d_mat_map[cell]);
+    for (size_t g = 0; g < d_number_groups; ++g)
+      d_source[g][cell] = d_scale * d_density[cell] * v[g];
   }
 }
 
-
 //----------------------------------------------------------------------------//
 inline void FissionSource::update()
 {
-  d_density.assign(d_density.size(), 0.0);
-  for(size_t g = 0; g < d_number_groups; g++)
+  vec_ptr phi(d_number_groups);
+  for (size_t g = 0; g < d_number_groups; ++g)
+    phi[g] = &d_state->phi(g)[0];
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    State::moments_type phi = d_state->phi(g);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); cell++)
-    {
-      double v = d_adjoint ? d_material->chi(d_mat_map[cell], g)
-                           : d_material->nu_sigma_f(d_mat_map[cell], g);
-      d_density[cell] += phi[cell] * v;
-    }
+    const double *v = weight(d_mat_map[cell]);
+    double fd = 0.0;
+    for (size_t g = 0; g < d_number_groups; ++g)
+      fd += phi[g][cell] * v[g];
+    d_density[cell] = fd;
   }
 }
 
@@ -77,11 +77,14 @@ build_within_group_source(const size_t               g,
   Require(g < d_material->number_groups());
   Require(phi.size() == source.size());
 
-  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
+    int m = d_mat_map[cell];
     source[cell] += phi[cell] * d_scale *
-                    d_material->chi(d_mat_map[cell], g) *
-                    d_material->nu_sigma_f(d_mat_map[cell], g);
+                    d_material->chi_block(m)[g] *
+                    d_material->nu_sigma_f_block(m)[g];
   }
 }
 
@@ -92,19 +95,10 @@ build_in_fission_source(const size_t  g,
 {
   Require(g < d_material->number_groups());
 
-  for (size_t gp = 0; gp < d_material->number_groups(); ++gp)
-  {
-    if (gp == g) continue;
-    const size_t g_f = g_from(g, gp);
-    const size_t g_t = g_to(g, gp);
-    const moments_type &phi = d_state->phi(gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[cell] * d_scale *
-                      d_material->chi(d_mat_map[cell], g_t) *
-                      d_material->nu_sigma_f(d_mat_map[cell], g_f);
-    }
-  }
+  vec_ptr phi(d_number_groups);
+  for (size_t gp = 0; gp < d_number_groups; ++gp)
+    phi[gp] = &d_state->phi(gp)[0];
+  gather(g, phi, true, source);
 }
 
 //----------------------------------------------------------------------------//
@@ -115,16 +109,33 @@ build_total_group_source(const size_t                   g,
 {
   Require(g < d_material->number_groups());
 
-  for (size_t gp = 0; gp < d_material->number_groups(); ++gp)
+  vec_ptr phi_gp(d_number_groups);
+  for (size_t gp = 0; gp < d_number_groups; ++gp)
+    phi_gp[gp] = &phi[gp][0];
+  gather(g, phi_gp, false, source);
+}
+
+//----------------------------------------------------------------------------//
+inline void FissionSource::gather(const size_t    g,
+                                  const vec_ptr  &phi,
+                                  const bool      skip,
+                                  moments_type   &source) const
+{
+  // The terms are added in the order of the group-wise loops they replace.
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    const size_t g_f = g_from(g, gp);
-    const size_t g_t = g_to(g, gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+    int m = d_mat_map[cell];
+    const double *chi = d_material->chi_block(m);
+    const double *nu  = d_material->nu_sigma_f_block(m);
+    double v = source[cell];
+    for (size_t gp = 0; gp < d_number_groups; ++gp)
     {
-      source[cell] += phi[gp][cell] * d_scale *
-                      d_material->chi(d_mat_map[cell], g_t) *
-                      d_material->nu_sigma_f(d_mat_map[cell], g_f);
+      if (skip && gp == g) continue;
+      v += phi[gp][cell] * d_scale * chi[g_to(g, gp)] * nu[g_from(g, gp)];
     }
+    source[cell] = v;
   }
 }
 
@@ -142,6 +153,20 @@ FissionSource::g_to(const size_t g, const size_t gp) const
   return d_adjoint ? gp : g;
 }
 
+//----------------------------------------------------------------------------//
+inline const double* FissionSource::weight(const size_t m) const
+{
+  return d_adjoint ? d_material->chi_block(m)
+                   : d_material->nu_sigma_f_block(m);
+}
+
+//----------------------------------------------------------------------------//
+inline const double* FissionSource::spectrum(const size_t m) const
+{
+  return d_adjoint ? d_material->nu_sigma_f_block(m)
+                   : d_material->chi_block(m);
+}
+
 } // namespace detran
 
 #endif /* detran_FISSIONSOURCE_I_HH_ */
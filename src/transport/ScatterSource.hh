@@ -27,6 +27,10 @@ namespace detran
  *  @brief Methods for constructing various scattering sources.
  *
  *  See the individual methods for detailed information.
+ *
+ *  All sources are gathered per cell from the dense scattering block of
+ *  the cell's material (see Material::sigma_s_block), accumulating over
+ *  the source groups in one pass, and the cell loop is threaded.
  */
 //----------------------------------------------------------------------------//
 
@@ -49,6 +53,7 @@ public:
   typedef detran_utilities::size_t                  size_t;
   typedef vec_size_t                                groups_t;
   typedef groups_t::iterator                        groups_iter;
+  typedef std::vector<const double*>                vec_ptr;
 
   //--------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -103,6 +108,11 @@ public:
    */
   void build_in_scatter_source(const size_t  g,
                                moments_type &s);
+
+  /// Build the in-scatter source as above but from the given group fluxes.
+  void build_in_scatter_source(const size_t                   g,
+                               const State::vec_moments_type &phi,
+                               moments_type                  &s);
   /**
    *  @brief Build the downscatter source.
    *
@@ -166,8 +176,6 @@ protected:
   vec_int d_mat_map;
   /// Adjoint
   bool d_adjoint;
-  /// Vector of group indices for in-scatter, down-scatter, and total-scatter
-  groups_t d_groups;
 
   //--------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -181,8 +189,17 @@ protected:
   size_t g_from(const size_t g, const size_t gp) const;
   /// the "to" group
   size_t g_to(const size_t g, const size_t gp) const;
-  /// Set group index vector
-  groups_iter groups(const size_t g_start, const size_t g_finish, bool inc);
+  /**
+   *  @brief Add the scatter from a set of groups into group g
+   *  @param g      Outgoing group (for forward problems)
+   *  @param gp     Source groups
+   *  @param phi    Moments of each source group
+   *  @param s      Mutable reference to moments source
+   */
+  void gather(const size_t    g,
+              const groups_t &gp,
+              const vec_ptr  &phi,
+              moments_type   &s) const;
 
 };
 
@@ -21,10 +21,8 @@ build_within_group_source(const size_t        g,
   Require(g < d_material->number_groups());
   Require(phi.size() == s.size());
 
-  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-  {
-    s[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g, g);
-  }
+  groups_t gp(1, g);
+  gather(g, gp, vec_ptr(1, &phi[0]), s);
 }
 
 //----------------------------------------------------------------------------//
@@ -34,18 +32,37 @@ build_in_scatter_source(const size_t  g,
 {
   Require(g < d_material->number_groups());
 
-  groups_iter gp = groups(lower(g), upper(g), true);
-  for (; gp != d_groups.end(); ++gp)
+  groups_t gp;
+  vec_ptr  phi;
+  groups_t all = detran_utilities::range<size_t>(lower(g), upper(g), true);
+  for (size_t i = 0; i < all.size(); ++i)
+  {
+    if (all[i] == g) continue;
+    gp.push_back(all[i]);
+    phi.push_back(&d_state->phi(all[i])[0]);
+  }
+  gather(g, gp, phi, s);
+}
+
+//----------------------------------------------------------------------------//
+inline void ScatterSource::
+build_in_scatter_source(const size_t                   g,
+                        const State::vec_moments_type &phi,
+                        moments_type                  &s)
+{
+  Require(g < d_material->number_groups());
+  Require(phi.size() == d_material->number_groups());
+
+  groups_t gp;
+  vec_ptr  phi_gp;
+  groups_t all = detran_utilities::range<size_t>(lower(g), upper(g), true);
+  for (size_t i = 0; i < all.size(); ++i)
   {
-    if (g == *gp) continue;
-    const size_t g_f = g_from(g, *gp);
-    const size_t g_t = g_to(g, *gp);
-    const moments_type &phi = d_state->phi(*gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      s[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g_t, g_f);
-    }
+    if (all[i] == g) continue;
+    gp.push_back(all[i]);
+    phi_gp.push_back(&phi[all[i]][0]);
   }
+  gather(g, gp, phi_gp, s);
 }
 
 //----------------------------------------------------------------------------//
@@ -57,17 +74,11 @@ build_downscatter_source(const size_t  g,
   Require(g < d_material->number_groups());
   Require(g_cutoff <= d_material->number_groups());
 
-  groups_iter gp = groups(lower(g), g_cutoff, false);
-  for (; gp != d_groups.end(); ++gp)
-  {
-    const size_t g_f = g_from(g, *gp);
-    const size_t g_t = g_to(g, *gp);
-    moments_type &phi = d_state->phi(*gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      s[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g_t, g_f);
-    }
-  }
+  groups_t gp = detran_utilities::range<size_t>(lower(g), g_cutoff, false);
+  vec_ptr  phi(gp.size());
+  for (size_t i = 0; i < gp.size(); ++i)
+    phi[i] = &d_state->phi(gp[i])[0];
+  gather(g, gp, phi, s);
 }
 
 //----------------------------------------------------------------------------//
@@ -79,16 +90,38 @@ build_total_group_source(const size_t                   g,
 {
   Require(g < d_material->number_groups());
 
-  groups_iter gp = groups(g_cutoff, upper(g), true);
-  for (; gp != d_groups.end(); ++gp)
+  groups_t gp = detran_utilities::range<size_t>(g_cutoff, upper(g), true);
+  vec_ptr  phi_gp(gp.size());
+  for (size_t i = 0; i < gp.size(); ++i)
+    phi_gp[i] = &phi[gp[i]][0];
+  gather(g, gp, phi_gp, s);
+}
+
+//----------------------------------------------------------------------------//
+inline void ScatterSource::gather(const size_t    g,
+                                  const groups_t &gp,
+                                  const vec_ptr  &phi,
+                                  moments_type   &s) const
+{
+  Require(gp.size() == phi.size());
+  if (gp.empty()) return;
+
+  // Row of each material's block for this group
+  const size_t ng = d_material->number_groups();
+  vec_ptr rows(d_material->number_materials());
+  for (size_t m = 0; m < rows.size(); ++m)
+    rows[m] = d_material->sigma_s_block(m, d_adjoint) + g * ng;
+
+  const int number_cells  = d_mesh->number_cells();
+  const int number_source = gp.size();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    const size_t g_f = g_from(g, *gp);
-    const size_t g_t = g_to(g, *gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      s[cell] += phi[*gp][cell] *
-                 d_material->sigma_s(d_mat_map[cell], g_t, g_f);
-    }
+    const double *row = rows[d_mat_map[cell]];
+    double v = s[cell];
+    for (int i = 0; i < number_source; ++i)
+      v += phi[i][cell] * row[gp[i]];
+    s[cell] = v;
   }
 }
 
@@ -118,14 +151,6 @@ ScatterSource::g_to(const size_t g, const size_t gp) const
   return d_adjoint ? gp : g;
 }
 
-//----------------------------------------------------------------------------//
-inline ScatterSource::groups_iter
-ScatterSource::groups(const size_t g_start, const size_t g_finish, bool inc)
-{
-  d_groups = detran_utilities::range<size_t>(g_start, g_finish, inc);
-  return d_groups.begin();
-}
-
 } // end namespace detran
 
 #endif /* detran_SCATTERSOURCE_I_HH_ */
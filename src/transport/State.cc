@@ -8,8 +8,10 @@
 //---------------------------------------------------------------------------//
 
 #include "State.hh"
+#include <algorithm>
 #include <iostream>
 #include <cstdio>
+#include <cstring>
 
 namespace detran
 {
@@ -23,6 +25,9 @@ State::State(SP_input        input,
   , d_quadrature(quadrature)
   , d_number_groups(0)
   , d_number_moments(1)
+  , d_psi(NULL)
+  , d_psi_size(0)
+  , d_psi_layout(PSI_GROUP_MAJOR)
   , d_eigenvalue(0.0)
   , d_store_angular_flux(false)
   , d_store_current(false)
@@ -70,9 +75,17 @@ State::State(SP_input        input,
   {
     Insist(d_quadrature, "Angular flux requested but no quadrature given.");
     d_store_angular_flux = true;
-    d_angular_flux.resize(d_number_groups,
-                          vec_moments_type(d_quadrature->number_angles(),
-			               moments_type(d_mesh->number_cells(), 0.0)));
+    if (d_input->check("state_psi_layout"))
+    {
+      std::string layout = d_input->get<std::string>("state_psi_layout");
+      if (layout == "group")
+        d_psi_layout = PSI_GROUP_MAJOR;
+      else if (layout == "cell")
+        d_psi_layout = PSI_CELL_MAJOR;
+      else
+        THROW("Unsupported state_psi_layout: " + layout);
+    }
+    allocate_psi();
   }
 
   // Check for adjoint calculation
@@ -81,41 +94,88 @@ State::State(SP_input        input,
 }
 
 //---------------------------------------------------------------------------//
-void State::clear()
+State::State(const State &S)
+  : d_input(S.d_input)
+  , d_mesh(S.d_mesh)
+  , d_quadrature(S.d_quadrature)
+  , d_momentindexer(S.d_momentindexer)
+  , d_number_groups(S.d_number_groups)
+  , d_number_moments(S.d_number_moments)
+  , d_moments(S.d_moments)
+  , d_psi(NULL)
+  , d_psi_size(0)
+  , d_psi_layout(S.d_psi_layout)
+  , d_current(S.d_current)
+  , d_eigenvalue(S.d_eigenvalue)
+  , d_store_angular_flux(S.d_store_angular_flux)
+  , d_store_current(S.d_store_current)
+  , d_adjoint(S.d_adjoint)
 {
-  for (size_t g = 0; g < d_number_groups; ++g)
+  if (d_store_angular_flux)
   {
-    for (size_t i = 0; i < d_mesh->number_cells(); ++i)
-    {
-      d_moments[g][i] = 0.0;
-      if (d_store_angular_flux)
-      {
-        for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-        {
-          d_angular_flux[g][a][i] = 0.0;
-        }
-      }
-    }
+    allocate_psi();
+    std::memcpy(d_psi, S.d_psi, d_psi_size * sizeof(double));
+  }
+}
+
+//---------------------------------------------------------------------------//
+State& State::operator=(const State &S)
+{
+  if (this == &S) return *this;
+
+  // Reallocate the slab only if its shape changes.
+  bool reallocate = S.d_store_angular_flux &&
+                    (!d_store_angular_flux               ||
+                     d_psi_size   != S.d_psi_size        ||
+                     d_psi_layout != S.d_psi_layout      ||
+                     d_number_groups != S.d_number_groups);
+
+  d_input              = S.d_input;
+  d_mesh               = S.d_mesh;
+  d_quadrature         = S.d_quadrature;
+  d_momentindexer      = S.d_momentindexer;
+  d_number_groups      = S.d_number_groups;
+  d_number_moments     = S.d_number_moments;
+  d_moments            = S.d_moments;
+  d_current            = S.d_current;
+  d_eigenvalue         = S.d_eigenvalue;
+  d_store_angular_flux = S.d_store_angular_flux;
+  d_store_current      = S.d_store_current;
+  d_adjoint            = S.d_adjoint;
+  d_psi_layout         = S.d_psi_layout;
+
+  if (!d_store_angular_flux)
+  {
+    d_angular_flux.clear();
+    d_psi_storage.clear();
+    d_psi = NULL;
+    d_psi_size = 0;
   }
+  else
+  {
+    if (reallocate) allocate_psi();
+    std::memcpy(d_psi, S.d_psi, d_psi_size * sizeof(double));
+  }
+  return *this;
+}
+
+//---------------------------------------------------------------------------//
+void State::clear()
+{
+  for (size_t g = 0; g < d_number_groups; ++g)
+    std::fill(d_moments[g].begin(), d_moments[g].end(), 0.0);
+  if (d_store_angular_flux)
+    std::memset(d_psi, 0, d_psi_size * sizeof(double));
 }
 
 //---------------------------------------------------------------------------//
 void State::scale(const double f)
 {
   for (size_t g = 0; g < d_number_groups; ++g)
-  {
-    for (size_t i = 0; i < d_mesh->number_cells(); ++i)
-    {
+    for (size_t i = 0; i < d_moments[g].size(); ++i)
       d_moments[g][i] *= f;
-      if (d_store_angular_flux)
-      {
-        for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-        {
-          d_angular_flux[g][a][i] *= f;
-        }
-      }
-    }
-  }
+  for (size_t i = 0; i < d_psi_size; ++i)
+    d_psi[i] *= f;
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +253,44 @@ void State::display() const
 
 }
 
+//---------------------------------------------------------------------------//
+void State::allocate_psi()
+{
+  Require(d_quadrature);
+  size_t number_angles = d_quadrature->number_angles();
+  size_t number_cells  = d_mesh->number_cells();
+  d_psi_size = d_number_groups * number_angles * number_cells;
+
+  // Pad the storage so that the slab can start on an aligned address.
+  size_t pad = PSI_ALIGNMENT / sizeof(double);
+  d_psi_storage.assign(d_psi_size + pad, 0.0);
+  std::size_t address = reinterpret_cast<std::size_t>(&d_psi_storage[0]);
+  std::size_t offset  = (PSI_ALIGNMENT - address % PSI_ALIGNMENT) % PSI_ALIGNMENT;
+  d_psi = &d_psi_storage[0] + offset / sizeof(double);
+
+  // Build the views for each group and angle.  Copies of a StridedVector
+  // own their data, so each view is bound in place.
+  d_angular_flux.assign(d_number_groups,
+                        std::vector<angular_flux_type>(number_angles));
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    for (size_t a = 0; a < number_angles; ++a)
+    {
+      if (d_psi_layout == PSI_GROUP_MAJOR)
+      {
+        d_angular_flux[g][a].view(
+          d_psi + (g * number_angles + a) * number_cells, number_cells, 1);
+      }
+      else
+      {
+        d_angular_flux[g][a].view(
+          d_psi + g * number_angles + a,
+          number_cells, d_number_groups * number_angles);
+      }
+    }
+  }
+}
+
 } // end namespace detran
 
 //---------------------------------------------------------------------------//
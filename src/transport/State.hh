@@ -17,6 +17,7 @@
 #include "utilities/Definitions.hh"
 #include "utilities/InputDB.hh"
 #include "utilities/SP.hh"
+#include "utilities/StridedVector.hh"
 #include <vector>
 
 namespace detran
@@ -33,9 +34,18 @@ namespace detran
  *  typically what we need (e.g. doses or fission rates).  For eigenvalue
  *  problems, keff is also included.
  *
+ *  When stored, the angular flux for all groups, angles, and cells lives
+ *  in one contiguous slab aligned to a cache line, and psi(g, o, a) is a
+ *  strided view into that slab.  The slab is either group-major, i.e.
+ *  [group][angle][cell], so that each view is contiguous, or cell-major,
+ *  i.e. [cell][group][angle], so that all angles and groups of a cell are
+ *  adjacent.  Either way, clearing, scaling, and copying a state touches
+ *  one block of memory.
+ *
  *  Relevant input entries:
  *  - number_groups (int)
  *  - store_angular_flux (int)
+ *  - state_psi_layout (string) -- "group" (default) or "cell"
  */
 //---------------------------------------------------------------------------//
 class TRANSPORT_EXPORT State
@@ -43,6 +53,15 @@ class TRANSPORT_EXPORT State
 
 public:
 
+  /// Angular flux storage layouts
+  enum PSI_LAYOUTS
+  {
+    PSI_GROUP_MAJOR, PSI_CELL_MAJOR, END_PSI_LAYOUTS
+  };
+
+  /// Alignment in bytes of the angular flux slab
+  enum {PSI_ALIGNMENT = 64};
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -55,7 +74,7 @@ public:
   typedef detran_utilities::vec_dbl                     moments_type;
   typedef std::vector<moments_type>                     vec_moments_type;
   typedef std::vector<moments_type>                     group_moments_type;
-  typedef detran_utilities::vec_dbl                     angular_flux_type;
+  typedef detran_utilities::StridedVector<double>       angular_flux_type;
   typedef std::vector<std::vector<angular_flux_type> >  vec_angular_flux_type;
   typedef detran_utilities::vec_dbl                     vec_dbl;
   typedef detran_utilities::size_t                      size_t;
@@ -75,6 +94,12 @@ public:
         SP_mesh         mesh,
         SP_quadrature   quadrature = SP_quadrature(0));
 
+  /// Copy constructor.  The angular flux views refer to the new slab.
+  State(const State &S);
+
+  /// Copy assignment.  The angular flux is copied as one block.
+  State& operator=(const State &S);
+
   /// SP constructor.
   static SP_state Create(SP_input      input,
                          SP_mesh       mesh,
@@ -134,6 +159,39 @@ public:
    */
   angular_flux_type& psi(const size_t g, const size_t o, const size_t a);
 
+  /**
+   *  @brief Contiguous copy of a group angular flux.
+   *
+   *  The angular flux is a strided view into one slab, so callers that
+   *  need a plain vector (including the Python interface) use this and
+   *  set_psi.
+   */
+  vec_dbl get_psi(const size_t g, const size_t o, const size_t a) const;
+
+  /// Set a group angular flux from a plain vector of cell values.
+  void set_psi(const size_t g,
+               const size_t o,
+               const size_t a,
+               const vec_dbl &f);
+
+  //@{
+  /// Raw access to the angular flux slab
+  const double* psi_data() const;
+  double* psi_data();
+  //@}
+
+  /// Number of values in the angular flux slab
+  size_t psi_size() const
+  {
+    return d_psi_size;
+  }
+
+  /// Angular flux storage layout
+  int psi_layout() const
+  {
+    return d_psi_layout;
+  }
+
   /// Const accessor to a group current field.
   const moments_type& current(const size_t g) const;
 
@@ -224,8 +282,16 @@ private:
   size_t d_number_moments;
   /// Cell-center scalar flux moments, [energy, (space-moment)]
   vec_moments_type d_moments;
-  /// Cell-center angular flux, [energy, angle, (space)]
+  /// Cell-center angular flux views into the slab, [energy, angle]
   vec_angular_flux_type d_angular_flux;
+  /// Angular flux slab storage, padded for alignment
+  vec_dbl d_psi_storage;
+  /// Aligned start of the angular flux slab
+  double* d_psi;
+  /// Number of values in the angular flux slab
+  size_t d_psi_size;
+  /// Angular flux storage layout
+  int d_psi_layout;
   /// Cell-center current magnitude, e.g. sqrt(Jx^2+Jy^2)
   vec_moments_type d_current;
   /// k-eigenvalue
@@ -237,6 +303,13 @@ private:
   /// Adjoint
   bool d_adjoint;
 
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Allocate the aligned angular flux slab and build the views into it.
+  void allocate_psi();
+
 };
 
 TRANSPORT_TEMPLATE_EXPORT(detran_utilities::SP<State>)
@@ -84,6 +84,39 @@ State::psi(const size_t g, const size_t o, const size_t a)
   );
 }
 
+//---------------------------------------------------------------------------//
+inline State::vec_dbl
+State::get_psi(const size_t g, const size_t o, const size_t a) const
+{
+  vec_dbl f;
+  psi(g, o, a).copy_to(f);
+  return f;
+}
+
+//---------------------------------------------------------------------------//
+inline void State::set_psi(const size_t g,
+                           const size_t o,
+                           const size_t a,
+                           const vec_dbl &f)
+{
+  Require(f.size() == psi(g, o, a).size());
+  psi(g, o, a) = f;
+}
+
+//---------------------------------------------------------------------------//
+inline const double* State::psi_data() const
+{
+  Require(d_store_angular_flux);
+  return d_psi;
+}
+
+//---------------------------------------------------------------------------//
+inline double* State::psi_data()
+{
+  Require(d_store_angular_flux);
+  return d_psi;
+}
+
 //---------------------------------------------------------------------------//
 inline const State::moments_type&
 State::current(const size_t g) const
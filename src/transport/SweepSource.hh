@@ -257,6 +257,53 @@ public:
               const size_t a,
               sweep_source_type& s);
 
+  /**
+   *  @brief Fill a source vector from a given moments source.
+   *
+   *  Only q contributes; the sources held here are ignored.  This is
+   *  used by block sweeps, which carry their own sources.
+   */
+  void source(const size_t        o,
+              const size_t        a,
+              const moments_type &q,
+              sweep_source_type  &s);
+
+  /**
+   *  @brief Fill the source vectors of a block of angles in one octant.
+   *
+   *  The moments source is summed once per cell and then expanded to
+   *  all angles of the block, so the cost of the moments-to-discrete
+   *  operator is paid once per cell rather than once per angle.  The
+   *  result is identical to calling \ref source for each angle.  The
+   *  cells are divided among the threads when called outside of a
+   *  parallel region.
+   *
+   *  @param g    group
+   *  @param o    octant
+   *  @param a0   first angle of the block
+   *  @param n    number of angles in the block
+   *  @param s    source vectors, s[l] for angle a0 + l
+   */
+  void source_angles(const size_t       g,
+                     const size_t       o,
+                     const size_t       a0,
+                     const size_t       n,
+                     sweep_source_type *s);
+
+  /**
+   *  @brief Fill the interleaved sources of a block of angles.
+   *
+   *  As above, but the source of angle a0 + l in a cell is stored in
+   *  s[cell * stride + l], which is the layout of the batched sweeps.
+   *  Entries for l >= n are not touched.
+   */
+  void source_angles(const size_t g,
+                     const size_t o,
+                     const size_t a0,
+                     const size_t n,
+                     double      *s,
+                     const size_t stride);
+
   /// Return the fixed source for the current group
   const moments_type& fixed_group_source() const
   {
@@ -158,6 +158,90 @@ source(const size_t g, const size_t o, const size_t a, sweep_source_type &s)
 
 }
 
+//----------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::
+source(const size_t o, const size_t a, const moments_type &q,
+       sweep_source_type &s)
+{
+  const double mtod = (*d_MtoD)(o, a, 0, 0);
+  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+    s[cell] = q[cell] * mtod;
+}
+
+//----------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::
+source_angles(const size_t g, const size_t o, const size_t a0,
+              const size_t n, sweep_source_type *s)
+{
+  Require(a0 + n <= d_quadrature->number_angles_octant());
+
+  // Moments-to-discrete coefficients of the block.
+  detran_utilities::vec_dbl mtod(n, 0.0);
+  for (size_t l = 0; l < n; ++l)
+    mtod[l] = (*d_MtoD)(o, a0 + l, 0, 0);
+
+  const int number_cells = d_mesh->number_cells();
+  const moments_type &fixed   = d_fixed_group_source;
+  const moments_type &scatter = d_scatter_group_source;
+
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
+  {
+    const double q = fixed[cell] + scatter[cell];
+    for (size_t l = 0; l < n; ++l)
+      s[l][cell] = q * mtod[l];
+  }
+
+  // Add discrete contributions if present.
+  if (d_discrete_external_source_flag)
+  {
+    for (size_t l = 0; l < n; ++l)
+    {
+      size_t angle = d_quadrature->index(o, a0 + l);
+      for (size_t i = 0; i < d_discrete_external_sources.size(); ++i)
+        for (int cell = 0; cell < number_cells; ++cell)
+          s[l][cell] += d_discrete_external_sources[i]->source(cell, g, angle);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::
+source_angles(const size_t g, const size_t o, const size_t a0,
+              const size_t n, double *s, const size_t stride)
+{
+  Require(a0 + n <= d_quadrature->number_angles_octant());
+  Require(n <= stride);
+
+  detran_utilities::vec_dbl mtod(n, 0.0);
+  for (size_t l = 0; l < n; ++l)
+    mtod[l] = (*d_MtoD)(o, a0 + l, 0, 0);
+
+  const size_t number_cells = d_mesh->number_cells();
+  for (size_t cell = 0; cell < number_cells; ++cell)
+  {
+    const double q = d_fixed_group_source[cell] + d_scatter_group_source[cell];
+    double *s_cell = &s[cell * stride];
+    for (size_t l = 0; l < n; ++l)
+      s_cell[l] = q * mtod[l];
+  }
+
+  if (d_discrete_external_source_flag)
+  {
+    for (size_t l = 0; l < n; ++l)
+    {
+      size_t angle = d_quadrature->index(o, a0 + l);
+      for (size_t i = 0; i < d_discrete_external_sources.size(); ++i)
+        for (size_t cell = 0; cell < number_cells; ++cell)
+          s[cell * stride + l] +=
+            d_discrete_external_sources[i]->source(cell, g, angle);
+    }
+  }
+}
+
 //----------------------------------------------------------------------------//
 template <class D>
 void SweepSource<D>::reset()
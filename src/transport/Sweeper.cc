@@ -8,6 +8,9 @@
 //---------------------------------------------------------------------------//
 
 #include "Sweeper.t.hh"
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran
 {
@@ -32,6 +35,8 @@ Sweeper<D>::Sweeper(SP_input input,
   , d_number_sweeps(0)
   , d_update_boundary(false)
   , d_ordered_octants(std::pow((float)2, (int)D::dimension), 0)
+  , d_sweep_scheduler(SWEEP_ANGLE)
+  , d_octant_source_flag(false)
 {
   Require(d_input);
   Require(d_mesh);
@@ -49,6 +54,24 @@ Sweeper<D>::Sweeper(SP_input input,
   if (d_input->check("adjoint"))
     d_adjoint = 0 != d_input->get<int>("adjoint");
 
+  // Check for the sweep scheduler.
+  if (d_input->check("sweep_scheduler"))
+  {
+    std::string scheduler = d_input->get<std::string>("sweep_scheduler");
+    if (scheduler == "angle")
+      d_sweep_scheduler = SWEEP_ANGLE;
+    else if (scheduler == "kba")
+      d_sweep_scheduler = SWEEP_KBA;
+    else if (scheduler == "batch")
+      d_sweep_scheduler = SWEEP_BATCH;
+    else
+      THROW("Unsupported sweep_scheduler: " + scheduler);
+  }
+
+  // Check whether all angular sources are built before the sweep.
+  if (d_input->check("sweep_octant_source"))
+    d_octant_source_flag = (0 != d_input->get<int>("sweep_octant_source"));
+
   // Perform templated setup tasks.
   setup();
 
@@ -56,6 +79,9 @@ Sweeper<D>::Sweeper(SP_input input,
   setup_spatial_indices();
   setup_octant_indices(boundary);
 
+  // Setup the wavefronts if needed
+  if (d_sweep_scheduler == SWEEP_KBA) setup_wavefronts();
+
 }
 
 //---------------------------------------------------------------------------//
@@ -117,6 +143,27 @@ void Sweeper<D>::set_tally(SP_tally tally)
   d_tally = tally;
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+int Sweeper<D>::sweep_scheduler() const
+{
+  return d_sweep_scheduler;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::sweep_block(const vec_moments_type &q, vec_moments_type &phi)
+{
+  THROW("Block sweeps are not implemented for this sweeper.");
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+bool Sweeper<D>::has_block_sweep() const
+{
+  return false;
+}
+
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -215,6 +262,191 @@ void Sweeper<D>::setup_octant_indices(SP_boundary boundary)
 
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::setup_wavefronts()
+{
+  // The wavefronts are defined in sweep-order coordinates, i.e. cell
+  // (0, 0, 0) is the first cell swept in any octant.  Wavefront w then
+  // contains all cells for which ii + jj + kk = w.  Within a wavefront,
+  // no cell depends on another, so they can all be swept at once.
+  size_t n[3] = {d_mesh->number_cells_x(),
+                 d_mesh->number_cells_y(),
+                 d_mesh->number_cells_z()};
+  size_t number_wavefronts = n[0] + n[1] + n[2] - 2;
+  d_wavefronts.assign(number_wavefronts, vec2_int(3));
+  for (size_t kk = 0; kk < n[2]; ++kk)
+  {
+    for (size_t jj = 0; jj < n[1]; ++jj)
+    {
+      for (size_t ii = 0; ii < n[0]; ++ii)
+      {
+        size_t w = ii + jj + kk;
+        d_wavefronts[w][0].push_back(ii);
+        d_wavefronts[w][1].push_back(jj);
+        d_wavefronts[w][2].push_back(kk);
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::setup_threads()
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  size_t number_threads = omp_get_max_threads();
+  if (d_phi_thread.size() < number_threads)
+  {
+    d_phi_thread.resize(number_threads,
+                        moments_type(d_mesh->number_cells(), 0.0));
+  }
+#else
+  size_t number_threads = 1;
+#endif
+  if (d_source_thread.size() < number_threads)
+  {
+    d_source_thread.resize(number_threads,
+      typename SweepSource<D>::sweep_source_type(d_mesh->number_cells(), 0.0));
+  }
+  if (d_tally) d_tally->setup_threads();
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::build_octant_sources()
+{
+  const size_t na = d_quadrature->number_angles_octant();
+  const size_t number_oa = d_quadrature->number_octants() * na;
+  if (d_octant_source.size() != number_oa)
+  {
+    d_octant_source.assign(number_oa,
+                           sweep_source_type(d_mesh->number_cells(), 0.0));
+  }
+  for (size_t o = 0; o < d_quadrature->number_octants(); ++o)
+    d_sweepsource->source_angles(d_g, o, 0, na, &d_octant_source[o * na]);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+typename Sweeper<D>::sweep_source_type&
+Sweeper<D>::angle_source(const size_t o, const size_t a, sweep_source_type &s)
+{
+  if (d_octant_source_flag)
+  {
+    Require(!d_octant_source.empty());
+    return d_octant_source[o * d_quadrature->number_angles_octant() + a];
+  }
+  d_sweepsource->source(d_g, o, a, s);
+  return s;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+typename Sweeper<D>::moments_type&
+Sweeper<D>::thread_moments(moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  moments_type &phi_local = d_phi_thread[omp_get_thread_num()];
+  phi_local.assign(phi_local.size(), 0.0);
+  return phi_local;
+#else
+  phi.assign(phi.size(), 0.0);
+  return phi;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+detran_utilities::size_t Sweeper<D>::thread_index() const
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::reduce_thread_moments(moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  // All threads must be done sweeping before any block is summed.
+  #pragma omp barrier
+  int number_threads = omp_get_num_threads();
+  int number_cells   = phi.size();
+  #pragma omp for
+  for (int i = 0; i < number_cells; ++i)
+  {
+    double v = 0.0;
+    for (int t = 0; t < number_threads; ++t)
+      v += d_phi_thread[t][i];
+    phi[i] = v;
+  }
+#endif
+  if (d_tally) d_tally->reduce(d_g);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::setup_block_threads(const size_t number_sources)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  size_t number_threads = omp_get_max_threads();
+#else
+  size_t number_threads = 1;
+#endif
+  vec_moments_type block(number_sources,
+                         moments_type(d_mesh->number_cells(), 0.0));
+  if (d_source_block_thread.size() < number_threads ||
+      d_source_block_thread[0].size() != number_sources)
+  {
+    d_source_block_thread.assign(number_threads, block);
+#ifdef DETRAN_ENABLE_OPENMP
+    d_phi_block_thread.assign(number_threads, block);
+#endif
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+typename Sweeper<D>::vec_moments_type&
+Sweeper<D>::thread_block_moments(vec_moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  vec_moments_type &phi_local = d_phi_block_thread[omp_get_thread_num()];
+#else
+  vec_moments_type &phi_local = phi;
+#endif
+  for (size_t s = 0; s < phi_local.size(); ++s)
+    phi_local[s].assign(d_mesh->number_cells(), 0.0);
+  return phi_local;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::reduce_thread_block_moments(vec_moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  #pragma omp barrier
+  int number_threads = omp_get_num_threads();
+  int number_cells   = d_mesh->number_cells();
+  int number_sources = phi.size();
+  #pragma omp for
+  for (int i = 0; i < number_cells; ++i)
+  {
+    for (int s = 0; s < number_sources; ++s)
+    {
+      double v = 0.0;
+      for (int t = 0; t < number_threads; ++t)
+        v += d_phi_block_thread[t][s][i];
+      phi[s][i] = v;
+    }
+  }
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //---------------------------------------------------------------------------//
@@ -50,6 +50,27 @@ namespace detran
  *  Relevant input database entries:
  *    - store_angular_flux [int]
  *    - equation [string]
+ *    - sweep_scheduler [string]
+ *    - sweep_octant_source [int]
+ *
+ *  The sweep scheduler controls how the Cartesian sweeps are threaded.
+ *  The default, "angle", threads over the angles within an octant.  The
+ *  alternative, "kba", uses a Koch-Baker-Alcouffe wavefront in which all
+ *  cells on a diagonal (2D) or hyperplane (3D) are swept concurrently for
+ *  all angles in flight.  The third, "batch", threads over batches of
+ *  angles within an octant and sweeps each cell for all angles of a batch
+ *  at once, with the face fluxes stored angle-innermost so that the cell
+ *  update vectorizes across angles.  Currently, only Sweeper2D and
+ *  Sweeper3D support "kba" and "batch"; other sweepers ignore the key.
+ *
+ *  By default, the sweep source of each angle is built as the angle is
+ *  swept.  With sweep_octant_source = 1, the sources of all angles are
+ *  built before the sweep into a buffer kept by the sweeper, with the
+ *  moments source read once per cell for all angles of an octant (see
+ *  SweepSource::source_angles).  This trades storage of one source per
+ *  angle for fewer passes over the moments.  The batch scheduler always
+ *  builds its interleaved sources a batch at a time.  Sweeper1D,
+ *  Sweeper2D, and Sweeper3D support the key.
  *
  */
 //---------------------------------------------------------------------------//
@@ -59,6 +80,12 @@ class Sweeper
 
 public:
 
+  /// Available sweep schedulers
+  enum SWEEP_SCHEDULERS
+  {
+    SWEEP_ANGLE, SWEEP_KBA, SWEEP_BATCH, END_SWEEP_SCHEDULERS
+  };
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -74,7 +101,9 @@ public:
   typedef typename Boundary_T::SP_boundary          SP_boundary;
   typedef typename SweepSource<D>::SP_sweepsource   SP_sweepsource;
   typedef State::moments_type                       moments_type;
+  typedef State::vec_moments_type                   vec_moments_type;
   typedef State::angular_flux_type                  angular_flux_type;
+  typedef typename SweepSource<D>::sweep_source_type sweep_source_type;
   typedef CurrentTally<D>                           Tally_T;
   typedef typename Tally_T::SP_tally                SP_tally;
   typedef detran_utilities::vec_int                 vec_int;
@@ -83,6 +112,7 @@ public:
   typedef detran_utilities::vec_size_t              vec_size_t;
   typedef detran_utilities::vec2_size_t             vec2_size_t;
   typedef detran_utilities::vec3_size_t             vec3_size_t;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
   typedef detran_utilities::size_t                  size_t;
 
   //-------------------------------------------------------------------------//
@@ -127,6 +157,27 @@ public:
    */
   virtual void sweep(moments_type &phi) = 0;
 
+  /**
+   *  @brief Sweep a block of moments sources at once.
+   *
+   *  For each source, phi[s] <-- D*inv(L)*M*q[s] with zero incident
+   *  boundary fluxes, which is the action needed to apply the
+   *  within-group operator to a block of Krylov vectors.  Each cell is
+   *  solved for all sources before moving on, so the equation setup for
+   *  each angle and the cell data are shared among the sources.  Only
+   *  the given sources are swept, i.e. those held by the sweep source
+   *  are ignored, and neither the angular flux, the boundary fluxes,
+   *  nor any tally is updated.  The sweep counts as one sweep per
+   *  source.  The default throws; see has_block_sweep.
+   *
+   *  @param q      moments source of each sweep
+   *  @param phi    moments of each sweep
+   */
+  virtual void sweep_block(const vec_moments_type &q, vec_moments_type &phi);
+
+  /// Does this sweeper implement sweep_block?
+  virtual bool has_block_sweep() const;
+
   //-------------------------------------------------------------------------//
   // PUBLIC FUNCTIONS
   //-------------------------------------------------------------------------//
@@ -153,6 +204,9 @@ public:
   /// Set a boundary flux tally.
   void set_tally(SP_tally tally);
 
+  /// Sweep scheduler in use
+  int sweep_scheduler() const;
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -189,6 +243,24 @@ protected:
   vec3_int d_space_ranges;
   /// Ordered octant indices
   vec_int d_ordered_octants;
+  /// Sweep scheduler
+  int d_sweep_scheduler;
+  /// Sweep-order cell indices for each wavefront, [wavefront][dim][cell]
+  vec3_int d_wavefronts;
+  /// Thread-local flux moments, [thread][cell]
+  std::vector<moments_type> d_phi_thread;
+  /// Thread-local sweep sources, [thread][cell]
+  std::vector<typename SweepSource<D>::sweep_source_type> d_source_thread;
+  /// Placeholder for the angular flux when it is not stored
+  angular_flux_type d_psi_dummy;
+  /// Thread-local flux moments of block sweeps, [thread][source][cell]
+  std::vector<vec_moments_type> d_phi_block_thread;
+  /// Thread-local sweep sources of block sweeps, [thread][source][cell]
+  std::vector<vec_moments_type> d_source_block_thread;
+  /// Build the sources of all angles before the sweep?
+  bool d_octant_source_flag;
+  /// Sweep sources of all angles, [octant * angles per octant + angle][cell]
+  std::vector<sweep_source_type> d_octant_source;
 
   //-------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -203,6 +275,66 @@ protected:
   /// Setup octant sweep indices.
   void setup_octant_indices(SP_boundary);
 
+  /// Setup the wavefronts (diagonals or hyperplanes) for KBA sweeps.
+  void setup_wavefronts();
+
+  /**
+   *  @brief Allocate the thread-local sweep buffers.
+   *
+   *  The buffers are sized for the maximum number of threads and are
+   *  kept for the life of the sweeper.  This must be called outside of
+   *  any parallel region.
+   */
+  void setup_threads();
+
+  /**
+   *  @brief Get the thread-local moments buffer, zeroed for a new sweep.
+   *
+   *  Without OpenMP, the moments are accumulated directly into phi.
+   */
+  moments_type& thread_moments(moments_type &phi);
+
+  /**
+   *  @brief Sum the thread-local moments into phi.
+   *
+   *  This must be called by all threads of the parallel region.  Each
+   *  thread sums one contiguous block of cells over all thread buffers,
+   *  so the reduction needs no locks and its cost is divided among the
+   *  threads.  Any boundary tally is reduced in the same way.
+   */
+  void reduce_thread_moments(moments_type &phi);
+
+  /**
+   *  @brief Build the sweep sources of all angles into the octant buffer.
+   *
+   *  Must be called outside of any parallel region, after the group
+   *  sources are set and before the sweep.
+   */
+  void build_octant_sources();
+
+  /**
+   *  @brief Get the sweep source for an angle.
+   *
+   *  The source comes from the octant buffer if it is used.  Otherwise,
+   *  it is built into s.
+   */
+  sweep_source_type& angle_source(const size_t       o,
+                                  const size_t       a,
+                                  sweep_source_type &s);
+
+  /// Allocate the thread-local block sweep buffers for a number of sources.
+  void setup_block_threads(const size_t number_sources);
+
+  /// Get the thread-local block moments, zeroed for a new sweep.
+  vec_moments_type& thread_block_moments(vec_moments_type &phi);
+
+  /// Sum the thread-local block moments into phi.  See
+  /// reduce_thread_moments.
+  void reduce_thread_block_moments(vec_moments_type &phi);
+
+  /// Index of the calling thread (zero without OpenMP)
+  size_t thread_index() const;
+
 };
 
 } // end namespace detran
@@ -40,11 +40,13 @@ public:
   typedef typename Base::SP_quadrature              SP_quadrature;
   typedef typename Base::SP_sweepsource             SP_sweepsource;
   typedef typename Base::moments_type               moments_type;
+  typedef typename Base::vec_moments_type           vec_moments_type;
   typedef typename Base::angular_flux_type          angular_flux_type;
   typedef typename Base::SP_tally                   SP_tally;
   typedef typename Base::vec_int                    vec_int;
   typedef typename Base::vec2_int                   vec2_int;
   typedef typename Base::vec3_int                   vec3_int;
+  typedef typename Base::vec_dbl                    vec_dbl;
   typedef typename Base::size_t                     size_t;
   typedef EQ                                        Equation_T;
   typedef BoundarySN<_1D>                           Boundary_T;
@@ -93,6 +95,12 @@ public:
   /// Sweep.
   inline void sweep(State::moments_type &phi);
 
+  /// Sweep a block of moments sources.  See Sweeper::sweep_block.
+  inline void sweep_block(const vec_moments_type &q, vec_moments_type &phi);
+
+  /// Block sweeps are implemented.
+  bool has_block_sweep() const { return true; }
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -23,16 +23,16 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
 {
   Require(d_g < d_material->number_groups());
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Build the sources of all angles up front if requested.
+  if (d_octant_source_flag) build_octant_sources();
 
-  #pragma omp parallel default(shared) private(phi_local)
+  // Reset the boundary flux tally
+  if (d_tally) d_tally->reset(d_g);
+
+  #pragma omp parallel default(shared)
   {
 
   // Initialize equation and setup for this group.
@@ -40,13 +40,12 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
   equation.setup_group(d_g);
 
   // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
-  // Reset the boundary flux tally
-  if (d_tally) d_tally->reset(d_g);
+  moments_type &phi_local = thread_moments(phi);
 
-  // Initialize discrete sweep source vector.
-  SweepSource<_1D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
+  // Thread-local discrete sweep source vector.
+  const size_t thread = thread_index();
+  SweepSource<_1D>::sweep_source_type &source_buffer =
+    d_source_thread[thread];
 
   // Temporary edge fluxes
   typename Equation_T::face_flux_type psi_in = 0.0;
@@ -69,14 +68,16 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
     {
 
       // Get sweep source for this angle.
-      d_sweepsource->source(d_g, o, a, source);
+      SweepSource<_1D>::sweep_source_type &source =
+        angle_source(o, a, source_buffer);
 
       // Setup equation for this angle.
       equation.setup_angle(a);
 
-      // Get psi if update requested.
-      State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      // Get psi if update requested.  Each angle is swept by one thread,
+      // so the angular flux is updated in place.
+      State::angular_flux_type &psi =
+        d_update_psi ? d_state->psi(d_g, o, a) : d_psi_dummy;
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
@@ -90,7 +91,8 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
 
       // Tally the incident flux.
       if (d_tally)
-        d_tally->tally(i, 0, 0, d_g, o, a, Tally_T::X_DIRECTED, psi_out);
+        d_tally->tally(i, 0, 0, d_g, o, a, Tally_T::X_DIRECTED, psi_out,
+                       thread);
 
       // Sweep over all cells.
       for (size_t ii = 0; ii < d_mesh->number_cells_x(); ++ii, i += di)
@@ -99,43 +101,109 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
         psi_in = psi_out;
 
         // Solve the equation in this cell.
-        equation.solve(i, 0, 0, source, psi_in, psi_out, phi, psi);
+        equation.solve(i, 0, 0, source, psi_in, psi_out, phi_local, psi);
 
         // Tally the outgoing cell flux
         if (d_tally)
-          d_tally->tally(i, 0, 0, d_g, o, a, psi_out);
+          d_tally->tally(i, 0, 0, d_g, o, a, psi_out, thread);
 
       } // end x loop
 
       // Update boundary.
       b(d_face_index[o][Mesh::VERT][Boundary_T::OUT], o, a, d_g) = psi_out;
 
-      // Update the angular flux.
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
-
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
+  reduce_thread_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+  return;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper1D<EQ>::sweep_block(const vec_moments_type &q,
+                                       vec_moments_type       &phi)
+{
+  Require(q.size() == phi.size());
+  const size_t m = q.size();
+
+  // Allocate the thread-local buffers if needed.
+  setup_block_threads(m);
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, false);
+  equation.setup_group(d_g);
+
+  // Reset the flux moments
+  vec_moments_type &phi_local = thread_block_moments(phi);
+
+  // Thread-local sweep sources and the edge flux of each source.
+  vec_moments_type &source = d_source_block_thread[thread_index()];
+  vec_dbl psi(m, 0.0);
+
+  // Temporary edge fluxes
+  typename Equation_T::face_flux_type psi_in = 0.0;
+  typename Equation_T::face_flux_type psi_out = 0.0;
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 2; oo++)
   {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
+    size_t o = d_ordered_octants[oo];
+
+    // Setup equation for this octant.
+    equation.setup_octant(o);
+
+    // Sweep over all angles.
+    #pragma omp for
+    for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
     {
-      phi[i] += phi_local[i];
-    }
-  }
-#endif
+
+      // Get sweep sources for this angle.
+      for (size_t s = 0; s < m; ++s)
+        d_sweepsource->source(o, a, q[s], source[s]);
+
+      // Setup equation for this angle.
+      equation.setup_angle(a);
+
+      // Vacuum incident fluxes.
+      psi.assign(m, 0.0);
+
+      // Sweep over all cells.
+      int i  = d_space_ranges[o][0][0];
+      int di = d_space_ranges[o][0][1];
+      for (size_t ii = 0; ii < d_mesh->number_cells_x(); ++ii, i += di)
+      {
+        // Solve the equation in this cell for each source.
+        for (size_t s = 0; s < m; ++s)
+        {
+          psi_in = psi[s];
+          equation.solve(i, 0, 0, source[s], psi_in, psi_out,
+                         phi_local[s], d_psi_dummy);
+          psi[s] = psi_out;
+        }
+      } // end x loop
+
+    } // end angle loop
+    // end omp do
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_block_moments(phi);
 
   } // end omp parallel
 
-  #pragma omp master
-  {
-    d_number_sweeps++;
-  }
-  return;
+  d_number_sweeps += m;
 }
 
 } // end namespace detran
@@ -40,11 +40,13 @@ public:
   typedef typename Base::SP_quadrature              SP_quadrature;
   typedef typename Base::SP_sweepsource             SP_sweepsource;
   typedef typename Base::moments_type               moments_type;
+  typedef typename Base::vec_moments_type           vec_moments_type;
   typedef typename Base::angular_flux_type          angular_flux_type;
   typedef typename Base::SP_tally                   SP_tally;
   typedef typename Base::vec_int                    vec_int;
   typedef typename Base::vec2_int                   vec2_int;
   typedef typename Base::vec3_int                   vec3_int;
+  typedef typename Base::vec_dbl                    vec_dbl;
   typedef typename Base::size_t                     size_t;
   typedef EQ                                        Equation_T;
   typedef BoundarySN<_2D>                           Boundary_T;
@@ -93,6 +95,12 @@ public:
   /// Sweep.
   inline void sweep(moments_type &phi);
 
+  /// Sweep a block of moments sources.  See Sweeper::sweep_block.
+  inline void sweep_block(const vec_moments_type &q, vec_moments_type &phi);
+
+  /// Block sweeps are implemented.
+  bool has_block_sweep() const { return true; }
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -101,6 +109,40 @@ private:
 
   // SN boundary
   SP_boundary d_boundary;
+  /// Thread-local vertical face fluxes, [thread][j]
+  std::vector<bf_type> d_psi_v_thread;
+  /// Thread-local horizontal face fluxes, [thread][i]
+  std::vector<bf_type> d_psi_h_thread;
+  /// KBA sweep sources, [octant-angle][cell]
+  std::vector<SweepSource<_2D>::sweep_source_type> d_kba_source;
+  /// KBA vertical face fluxes, [octant-angle][j]
+  std::vector<bf_type> d_kba_psi_v;
+  /// KBA horizontal face fluxes, [octant-angle][i]
+  std::vector<bf_type> d_kba_psi_h;
+  /// KBA equations, [octant-angle], kept between sweeps
+  std::vector<Equation_T> d_kba_equation;
+  /// KBA angular fluxes and sweep sources in use, [octant-angle]
+  std::vector<State::angular_flux_type*> d_kba_psi;
+  std::vector<SweepSource<_2D>::sweep_source_type*> d_kba_source_ptr;
+  /// Batched sweep sources, [thread][cell][angle]
+  std::vector<vec_dbl> d_batch_source;
+  /// Batched vertical face fluxes, [thread][j][angle]
+  std::vector<vec_dbl> d_batch_psi_v;
+  /// Batched horizontal face fluxes, [thread][i][angle]
+  std::vector<vec_dbl> d_batch_psi_h;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Sweep using the default angle-parallel scheduler.
+  inline void sweep_angle(moments_type &phi);
+
+  /// Sweep using the KBA wavefront scheduler.
+  inline void sweep_kba(moments_type &phi);
+
+  /// Sweep using the angle-batched scheduler.
+  inline void sweep_batch(moments_type &phi);
 
 };
 
@@ -10,6 +10,7 @@
 #ifndef detran_SWEEPER2D_I_HH_
 #define detran_SWEEPER2D_I_HH_
 
+#include <algorithm>
 #include <iostream>
 #ifdef DETRAN_ENABLE_OPENMP
 #include <omp.h>
@@ -22,17 +23,33 @@ namespace detran
 template <class EQ>
 inline void Sweeper2D<EQ>::sweep(moments_type &phi)
 {
+  if (d_sweep_scheduler == Base::SWEEP_KBA)
+    sweep_kba(phi);
+  else if (d_sweep_scheduler == Base::SWEEP_BATCH)
+    sweep_batch(phi);
+  else
+    sweep_angle(phi);
+}
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_angle(moments_type &phi)
+{
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+  if (d_psi_v_thread.size() < d_source_thread.size())
+  {
+    d_psi_v_thread.resize(d_source_thread.size());
+    d_psi_h_thread.resize(d_source_thread.size());
+  }
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Build the sources of all angles up front if requested.
+  if (d_octant_source_flag) build_octant_sources();
+
+  // Reset the boundary flux tally
+  if (d_tally) d_tally->reset(d_g);
 
-  #pragma omp parallel default(shared) private(phi_local)
+  #pragma omp parallel default(shared)
   {
 
   // Initialize equation and setup for this group.
@@ -40,13 +57,14 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
   equation.setup_group(d_g);
 
   // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
-  // Reset the boundary flux tally
-  if (d_tally) d_tally->reset(d_g);
+  moments_type &phi_local = thread_moments(phi);
 
-  // Initialize discrete sweep source vector.
-  SweepSource<_2D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
+  // Thread-local discrete sweep source and boundary flux vectors.
+  const size_t thread = thread_index();
+  SweepSource<_2D>::sweep_source_type &source_buffer =
+    d_source_thread[thread];
+  bf_type &psi_v = d_psi_v_thread[thread];
+  bf_type &psi_h = d_psi_h_thread[thread];
 
   // Reference to boundary to simplify clutter.
   Boundary_T &b = *d_boundary;
@@ -71,21 +89,23 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
     {
 
       // Get sweep source for this angle.
-      d_sweepsource->source(d_g, o, a, source);
+      SweepSource<_2D>::sweep_source_type &source =
+        angle_source(o, a, source_buffer);
 
       // Setup equation for this angle.
       equation.setup_angle(a);
 
-      // Get psi if needed.
-      State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      // Get psi if needed.  Each angle is swept by one thread, so the
+      // angular flux is updated in place.
+      State::angular_flux_type &psi =
+        d_update_psi ? d_state->psi(d_g, o, a) : d_psi_dummy;
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
 
       // Get boundary fluxes.
-      bf_type psi_v = b(face_V_i, o, a, d_g);
-      bf_type psi_h = b(face_H_i, o, a, d_g);
+      psi_v = b(face_V_i, o, a, d_g);
+      psi_h = b(face_H_i, o, a, d_g);
 
       // Temporary edge fluxes.
       Equation<_2D>::face_flux_type psi_in  = {0.0, 0.0};
@@ -102,7 +122,8 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
         {
           size_t j = jj;
           if (o > 1) j = d_mesh->number_cells_y() - j - 1;
-          d_tally->tally(i, j, 0,  d_g,  o, a,  Tally_T::X_DIRECTED, psi_v[j]);
+          d_tally->tally(i, j, 0,  d_g,  o, a,  Tally_T::X_DIRECTED, psi_v[j],
+                         thread);
         }
       }
       // Tally y-directed face
@@ -114,7 +135,8 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
         {
           size_t i = ii;
           if (o == 1 || o == 2) i = d_mesh->number_cells_x() - i - 1;
-          d_tally->tally(i, j, 0,  d_g,  o, a, Tally_T::Y_DIRECTED, psi_h[i]);
+          d_tally->tally(i, j, 0,  d_g,  o, a, Tally_T::Y_DIRECTED, psi_h[i],
+                         thread);
         }
       }
 
@@ -142,7 +164,8 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
           // Save the horizontal flux.
           psi_h[i] = psi_out[Mesh::HORZ];
 
-          if (d_tally) d_tally->tally(i, j, 0,  d_g,  o, a,  psi_out);
+          if (d_tally)
+            d_tally->tally(i, j, 0,  d_g,  o, a,  psi_out, thread);
 
         } // end x loop
 
@@ -155,31 +178,466 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
       b(face_V_o, o, a, d_g) = psi_v;
       b(face_H_o, o, a, d_g) = psi_h;
 
-      // Update the angular flux.
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
-
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
+  reduce_thread_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_kba(moments_type &phi)
+{
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+
+  // Build the sources of all angles up front if requested.
+  if (d_octant_source_flag) build_octant_sources();
+
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+  const size_t na = d_quadrature->number_angles_octant();
+
+  // When the boundary is updated on the fly, an octant may depend on the
+  // outgoing fluxes of an earlier octant, so the octants are swept one
+  // after the other.  Otherwise, all four octants are independent and
+  // are pipelined through the same wavefronts.
+  const size_t number_blocks = d_update_boundary ? 4 : 1;
+  const size_t octants_per_block = 4 / number_blocks;
+  const size_t number_oa = octants_per_block * na;
+
+  // Per octant-angle working storage.  Each octant-angle in flight keeps
+  // its own source, face fluxes, and equation, since a single thread may
+  // visit several angles within one wavefront.
+  if (d_kba_source.size() != number_oa)
+  {
+    d_kba_source.assign(number_oa,
+      SweepSource<_2D>::sweep_source_type(d_mesh->number_cells(), 0.0));
+    d_kba_psi_v.assign(number_oa, bf_type(ny, 0.0));
+    d_kba_psi_h.assign(number_oa, bf_type(nx, 0.0));
+    d_kba_psi.assign(number_oa, NULL);
+    d_kba_source_ptr.assign(number_oa, NULL);
+  }
+  if (d_kba_equation.size() != number_oa ||
+      d_kba_equation[0].update_psi() != d_update_psi)
+  {
+    d_kba_equation.assign(number_oa,
+      Equation_T(d_mesh, d_material, d_quadrature, d_update_psi));
+  }
+  std::vector<Equation_T> &equation = d_kba_equation;
+  std::vector<State::angular_flux_type*> &psi = d_kba_psi;
+  std::vector<SweepSource<_2D>::sweep_source_type*> &source =
+    d_kba_source_ptr;
+
+  // Reset the boundary flux tally
+  if (d_tally) d_tally->reset(d_g);
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Reset the flux moments
+  moments_type &phi_local = thread_moments(phi);
+  const size_t thread = thread_index();
+
+  // Temporary edge fluxes.
+  Equation<_2D>::face_flux_type psi_in  = {0.0, 0.0};
+  Equation<_2D>::face_flux_type psi_out = {0.0, 0.0};
+
+  for (size_t block = 0; block < number_blocks; ++block)
   {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
+
+    // Setup the sources, equations, and incident fluxes for all
+    // octant-angles in this block.
+    #pragma omp for
+    for (size_t oa = 0; oa < number_oa; ++oa)
+    {
+      size_t o = d_ordered_octants[block * octants_per_block + oa / na];
+      size_t a = oa % na;
+
+      source[oa] = &angle_source(o, a, d_kba_source[oa]);
+
+      equation[oa].setup_group(d_g);
+      equation[oa].setup_octant(o);
+      equation[oa].setup_angle(a);
+
+      psi[oa] = d_update_psi ? &d_state->psi(d_g, o, a) : &d_psi_dummy;
+
+      if (d_update_boundary) b.update(d_g, o, a);
+
+      const int face_V_i = d_face_index[o][Mesh::VERT][Boundary_T::IN];
+      const int face_H_i = d_face_index[o][Mesh::HORZ][Boundary_T::IN];
+      d_kba_psi_v[oa] = b(face_V_i, o, a, d_g);
+      d_kba_psi_h[oa] = b(face_H_i, o, a, d_g);
+
+      // Tally the incident x- and y-directed faces.
+      if (d_tally)
+      {
+        size_t i = 0;
+        if (o == 1 || o == 2) i = nx - 1;
+        for (size_t jj = 0; jj < ny; jj++)
+        {
+          size_t j = jj;
+          if (o > 1) j = ny - j - 1;
+          d_tally->tally(i, j, 0, d_g, o, a, Tally_T::X_DIRECTED,
+                         d_kba_psi_v[oa][j], thread);
+        }
+        size_t j = 0;
+        if (o > 1) j = ny - 1;
+        for (size_t ii = 0; ii < nx; ii++)
+        {
+          i = ii;
+          if (o == 1 || o == 2) i = nx - i - 1;
+          d_tally->tally(i, j, 0, d_g, o, a, Tally_T::Y_DIRECTED,
+                         d_kba_psi_h[oa][i], thread);
+        }
+      }
+    } // end setup loop
+
+    // Sweep the diagonals.  The implied barrier at the end of each
+    // loop guarantees the upstream diagonal is complete.
+    for (size_t w = 0; w < d_wavefronts.size(); ++w)
+    {
+      const vec_int &cell_ii = d_wavefronts[w][0];
+      const vec_int &cell_jj = d_wavefronts[w][1];
+      const int number_cells_w = cell_ii.size();
+
+      #pragma omp for
+      for (int n = 0; n < (int)number_oa * number_cells_w; ++n)
+      {
+        size_t oa = n / number_cells_w;
+        size_t c  = n % number_cells_w;
+        size_t o  = d_ordered_octants[block * octants_per_block + oa / na];
+
+        int i = d_space_ranges[o][0][0] + cell_ii[c] * d_space_ranges[o][0][1];
+        int j = d_space_ranges[o][1][0] + cell_jj[c] * d_space_ranges[o][1][1];
+
+        bf_type &psi_v = d_kba_psi_v[oa];
+        bf_type &psi_h = d_kba_psi_h[oa];
+
+        // Set the incident cell surface fluxes.
+        psi_in[Mesh::HORZ] = psi_h[i];
+        psi_in[Mesh::VERT] = psi_v[j];
+
+        // Solve the equation in this cell.
+        equation[oa].solve(i, j, 0, *source[oa], psi_in, psi_out,
+                           phi_local, *psi[oa]);
+
+        // Save the outgoing fluxes.
+        psi_h[i] = psi_out[Mesh::HORZ];
+        psi_v[j] = psi_out[Mesh::VERT];
+
+        if (d_tally)
+          d_tally->tally(i, j, 0, d_g, o, oa % na, psi_out, thread);
+      } // end wavefront loop
+
+    } // end wavefronts
+
+    // Update the outgoing boundary fluxes.
+    #pragma omp for
+    for (size_t oa = 0; oa < number_oa; ++oa)
     {
-      phi[i] += phi_local[i];
+      size_t o = d_ordered_octants[block * octants_per_block + oa / na];
+      size_t a = oa % na;
+      const int face_V_o = d_face_index[o][Mesh::VERT][Boundary_T::OUT];
+      const int face_H_o = d_face_index[o][Mesh::HORZ][Boundary_T::OUT];
+      b(face_V_o, o, a, d_g) = d_kba_psi_v[oa];
+      b(face_H_o, o, a, d_g) = d_kba_psi_h[oa];
     }
-  }
-#endif
+
+  } // end block loop
+
+  // Sum local thread fluxes.
+  reduce_thread_moments(phi);
 
   } // end omp parallel
 
-  #pragma omp master
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_batch(moments_type &phi)
+{
+  const size_t NB = Equation_T::BATCH_SIZE;
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+  const size_t na = d_quadrature->number_angles_octant();
+  const size_t number_batches = (na + NB - 1) / NB;
+
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+  if (d_batch_source.size() < d_source_thread.size())
   {
-    d_number_sweeps++;
+    size_t nt = d_source_thread.size();
+    d_batch_source.resize(nt, vec_dbl(d_mesh->number_cells() * NB, 0.0));
+    d_batch_psi_v.resize(nt, vec_dbl(ny * NB, 0.0));
+    d_batch_psi_h.resize(nt, vec_dbl(nx * NB, 0.0));
   }
+
+  // Reset the boundary flux tally
+  if (d_tally) d_tally->reset(d_g);
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.setup_group(d_g);
+
+  // Reset the flux moments
+  moments_type &phi_local = thread_moments(phi);
+
+  // Thread-local sources and face fluxes.  The batched arrays are stored
+  // with the angle innermost.
+  const size_t thread = thread_index();
+  vec_dbl &batch_source = d_batch_source[thread];
+  vec_dbl &psi_v = d_batch_psi_v[thread];
+  vec_dbl &psi_h = d_batch_psi_h[thread];
+  double psi_center[NB];
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Setup equation for this octant.
+    equation.setup_octant(o);
+
+    // Get face indices
+    const int face_V_i = d_face_index[o][Mesh::VERT][Boundary_T::IN];
+    const int face_H_i = d_face_index[o][Mesh::HORZ][Boundary_T::IN];
+    const int face_V_o = d_face_index[o][Mesh::VERT][Boundary_T::OUT];
+    const int face_H_o = d_face_index[o][Mesh::HORZ][Boundary_T::OUT];
+
+    // Sweep over all batches of angles.
+    #pragma omp for
+    for (size_t batch = 0; batch < number_batches; ++batch)
+    {
+      const size_t a0 = batch * NB;
+      const size_t n  = std::min(NB, na - a0);
+
+      // Setup equation for this batch.
+      equation.setup_batch(a0, n);
+
+      // Padded lanes carry zeros.
+      if (n < NB)
+      {
+        batch_source.assign(batch_source.size(), 0.0);
+        psi_v.assign(psi_v.size(), 0.0);
+        psi_h.assign(psi_h.size(), 0.0);
+      }
+
+      // Build the interleaved sources of the batch in one pass.
+      d_sweepsource->source_angles(d_g, o, a0, n, &batch_source[0], NB);
+
+      // Gather the incident fluxes of each angle.
+      for (size_t l = 0; l < n; ++l)
+      {
+        size_t a = a0 + l;
+
+        // Update the boundary for this angle.
+        if (d_update_boundary) b.update(d_g, o, a);
+
+        const bf_type &psi_v_in = b(face_V_i, o, a, d_g);
+        const bf_type &psi_h_in = b(face_H_i, o, a, d_g);
+        for (size_t j = 0; j < ny; ++j)
+          psi_v[j * NB + l] = psi_v_in[j];
+        for (size_t i = 0; i < nx; ++i)
+          psi_h[i * NB + l] = psi_h_in[i];
+
+        // Tally the incident x- and y-directed faces.
+        if (d_tally)
+        {
+          size_t i = 0;
+          if (o == 1 || o == 2) i = nx - 1;
+          for (size_t jj = 0; jj < ny; jj++)
+          {
+            size_t j = jj;
+            if (o > 1) j = ny - j - 1;
+            d_tally->tally(i, j, 0, d_g, o, a, Tally_T::X_DIRECTED,
+                           psi_v_in[j], thread);
+          }
+          size_t j = 0;
+          if (o > 1) j = ny - 1;
+          for (size_t ii = 0; ii < nx; ii++)
+          {
+            i = ii;
+            if (o == 1 || o == 2) i = nx - i - 1;
+            d_tally->tally(i, j, 0, d_g, o, a, Tally_T::Y_DIRECTED,
+                           psi_h_in[i], thread);
+          }
+        }
+      }
+
+      // Sweep over all y.
+      int j  = d_space_ranges[o][1][0];
+      int dj = d_space_ranges[o][1][1];
+      for (size_t jj = 0; jj < ny; ++jj, j += dj)
+      {
+        // Sweep over all x.
+        int i  = d_space_ranges[o][0][0];
+        int di = d_space_ranges[o][0][1];
+        for (size_t ii = 0; ii < nx; ++ii, i += di)
+        {
+          size_t cell = d_mesh->index(i, j);
+
+          // Solve the equation in this cell for all angles in the batch.
+          equation.solve_batch(i, j, &batch_source[cell * NB],
+                               &psi_v[j * NB], &psi_h[i * NB],
+                               phi_local, psi_center);
+
+          // Store the angular flux if needed.
+          if (d_update_psi)
+          {
+            for (size_t l = 0; l < n; ++l)
+              d_state->psi(d_g, o, a0 + l)[cell] = psi_center[l];
+          }
+
+          if (d_tally)
+          {
+            for (size_t l = 0; l < n; ++l)
+            {
+              typename Equation_T::face_flux_type psi_out;
+              psi_out[Mesh::VERT] = psi_v[j * NB + l];
+              psi_out[Mesh::HORZ] = psi_h[i * NB + l];
+              d_tally->tally(i, j, 0, d_g, o, a0 + l, psi_out, thread);
+            }
+          }
+
+        } // end x loop
+      } // end y loop
+
+      // Update boundary
+      for (size_t l = 0; l < n; ++l)
+      {
+        size_t a = a0 + l;
+        bf_type &psi_v_out = b(face_V_o, o, a, d_g);
+        bf_type &psi_h_out = b(face_H_o, o, a, d_g);
+        for (size_t j = 0; j < ny; ++j)
+          psi_v_out[j] = psi_v[j * NB + l];
+        for (size_t i = 0; i < nx; ++i)
+          psi_h_out[i] = psi_h[i * NB + l];
+      }
+
+    } // end batch loop
+    // end omp do
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_block(const vec_moments_type &q,
+                                       vec_moments_type       &phi)
+{
+  Require(q.size() == phi.size());
+  const size_t m  = q.size();
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+
+  // Allocate the thread-local buffers if needed.
+  setup_block_threads(m);
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, false);
+  equation.setup_group(d_g);
+
+  // Reset the flux moments
+  vec_moments_type &phi_local = thread_block_moments(phi);
+
+  // Thread-local sweep sources.  The face fluxes are stored with the
+  // source innermost.
+  vec_moments_type &source = d_source_block_thread[thread_index()];
+  vec_dbl psi_v(m, 0.0);
+  vec_dbl psi_h(nx * m, 0.0);
+
+  // Temporary edge fluxes.
+  Equation<_2D>::face_flux_type psi_in  = {0.0, 0.0};
+  Equation<_2D>::face_flux_type psi_out = {0.0, 0.0};
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Setup equation for this octant.
+    equation.setup_octant(o);
+
+    // Sweep over all angles.
+    #pragma omp for
+    for (size_t a = 0; a < d_quadrature->number_angles_octant(); a++)
+    {
+
+      // Get sweep sources for this angle.
+      for (size_t s = 0; s < m; ++s)
+        d_sweepsource->source(o, a, q[s], source[s]);
+
+      // Setup equation for this angle.
+      equation.setup_angle(a);
+
+      // Vacuum incident fluxes.
+      psi_h.assign(nx * m, 0.0);
+
+      // Sweep over all y.
+      int j  = d_space_ranges[o][1][0]; // actual index
+      int dj = d_space_ranges[o][1][1]; // decrement
+      for (size_t jj = 0; jj < ny; ++jj, j += dj)
+      {
+        psi_v.assign(m, 0.0);
+
+        // Sweep over all x.
+        int i  = d_space_ranges[o][0][0]; // actual index
+        int di = d_space_ranges[o][0][1]; // decrement
+        for (size_t ii = 0; ii < nx; ++ii, i += di)
+        {
+          // Solve the equation in this cell for each source.
+          for (size_t s = 0; s < m; ++s)
+          {
+            psi_in[Mesh::HORZ] = psi_h[i * m + s];
+            psi_in[Mesh::VERT] = psi_v[s];
+            equation.solve(i, j, 0, source[s], psi_in, psi_out,
+                           phi_local[s], d_psi_dummy);
+            psi_h[i * m + s] = psi_out[Mesh::HORZ];
+            psi_v[s]         = psi_out[Mesh::VERT];
+          }
+        } // end x loop
+
+      } // end y loop
+
+    } // end angle loop
+    // end omp do
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_block_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps += m;
 }
 
 } // end namespace detran
@@ -24,8 +24,13 @@ Sweeper2DMOC<EQ>::Sweeper2DMOC(SP_input input,
                                SP_sweepsource sweepsource)
   : Base(input, mesh, material, quadrature, state, boundary, sweepsource)
   , d_boundary(boundary)
+  , d_precompute(false)
 {
-    //d_tracks = mesh->tracks();
+  //d_tracks = mesh->tracks();
+  d_exp = Exponential::Create(input);
+  if (input->check("moc_precompute_coefficients"))
+    d_precompute = 0 != input->get<int>("moc_precompute_coefficients");
+  d_coefficients.resize(material->number_groups());
 }
 
 //---------------------------------------------------------------------------//
@@ -44,6 +49,51 @@ Sweeper2DMOC<EQ>::Create(SP_input       input,
   return p;
 }
 
+//---------------------------------------------------------------------------//
+template <class EQ>
+void Sweeper2DMOC<EQ>::set_tracks(SP_trackdb tracks)
+{
+  Require(tracks);
+  d_tracks = tracks;
+  if (!d_tracks->is_flat()) d_tracks->flatten();
+  d_boundary->set_tracks(d_tracks);
+  for (size_t g = 0; g < d_coefficients.size(); ++g)
+    d_coefficients[g].clear();
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+void Sweeper2DMOC<EQ>::setup_coefficients()
+{
+  Require(d_tracks);
+  Require(d_tracks->is_flat());
+
+  Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_exponential(d_exp);
+  equation.setup_group(d_g);
+
+  SP_quadrature q = d_quadrature;
+  size_t np = q->number_polar_octant();
+  size_t ns = d_tracks->number_segments();
+  size_t nc = equation.number_coefficients();
+  vec_dbl &coef = d_coefficients[d_g];
+  coef.resize(np * ns * nc, 0.0);
+
+  // Only the polar angle affects the segment coefficients.
+  equation.setup_octant(0);
+  equation.setup_azimuth(0);
+  for (size_t p = 0; p < np; ++p)
+  {
+    equation.setup_polar(p);
+    for (size_t s = 0; s < ns; ++s)
+    {
+      equation.coefficients(d_tracks->segment_region(s),
+                            d_tracks->segment_length(s),
+                            &coef[(p * ns + s) * nc]);
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #define detran_SWEEPER2DMOC_HH_
 
 #include "transport/Sweeper.hh"
+#include "transport/Exponential.hh"
 #include "angle/ProductQuadrature.hh"
 #include "boundary/BoundaryMOC.hh"
 #include "geometry/Mesh.hh"
@@ -23,6 +24,16 @@ namespace detran
 /**
  *  @class Sweeper2DMOC
  *  @brief Sweeper for 2D MOC problems.
+ *
+ *  Relevant database entries:
+ *    - moc_exp_type                 [string] see Exponential
+ *    - moc_exp_tolerance            [double] see Exponential
+ *    - moc_precompute_coefficients  [int] store the attenuation
+ *                                   coefficients of every segment, polar
+ *                                   angle, and group rather than compute
+ *                                   them every sweep (default 0).  The
+ *                                   cross sections must not change
+ *                                   between sweeps.
  */
 
 template <class EQ>
@@ -54,6 +65,9 @@ public:
   typedef detran_angle::ProductQuadrature::SP_quadrature SP_quadrature;
   typedef detran_geometry::TrackDB::SP_trackdb          SP_trackdb;
   typedef detran_geometry::Track::SP_track              SP_track;
+  typedef Exponential::SP_exponential                   SP_exponential;
+  typedef detran_utilities::vec_dbl                     vec_dbl;
+  typedef detran_utilities::vec2_dbl                    vec2_dbl;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -97,6 +111,18 @@ public:
   /// Sweep.
   inline void sweep(moments_type &phi);
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Set the track database of the mesh.
+   *
+   *  The tracks are flattened if needed, the boundary is sized for
+   *  them, and any stored attenuation coefficients are dropped.
+   */
+  void set_tracks(SP_trackdb tracks);
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -107,6 +133,19 @@ private:
   SP_boundary d_boundary;
   // Track database
   SP_trackdb d_tracks;
+  /// Exponential kernel
+  SP_exponential d_exp;
+  /// Flag to store attenuation coefficients
+  bool d_precompute;
+  /// Attenuation coefficients, [group][(polar * segments + segment) * n]
+  vec2_dbl d_coefficients;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Compute the attenuation coefficients for the current group.
+  void setup_coefficients();
 
 };
 
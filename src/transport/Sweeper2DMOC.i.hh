@@ -26,27 +26,30 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
   using std::cout;
   using std::endl;
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+  Require(d_tracks);
+  Require(d_tracks->is_flat());
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
 
-  #pragma omp parallel default(shared) private(phi_local)
+  // Compute the attenuation coefficients once per group if requested.
+  if (d_precompute && d_coefficients[d_g].empty()) setup_coefficients();
+  size_t number_segments = d_tracks->number_segments();
+
+  #pragma omp parallel default(shared)
   {
 
   // Initialize equation and setup for this group.
   Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_exponential(d_exp);
   equation.setup_group(d_g);
+  size_t nc = equation.number_coefficients();
 
   // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
+  moments_type &phi_local = thread_moments(phi);
 
-  // Initialize discrete sweep source vector.
-  SweepSource<_2D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
+  // Thread-local discrete sweep source vector.
+  SweepSource<_2D>::sweep_source_type &source = d_source_thread[thread_index()];
 
   double psi_in  = 0;
   double psi_out = 0;
@@ -104,108 +107,68 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
       // Get sweep source for this angle.
       d_sweepsource->source(d_g, o, a, source);
 
-      // Get psi if update requested.
-      State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      // Get psi if update requested.  Each angle is swept by one thread,
+      // so the angular flux is updated in place.
+      State::angular_flux_type &psi =
+        d_update_psi ? d_state->psi(d_g, o, a) : d_psi_dummy;
 
       // Update the boundary for this angle.
       if (d_update_boundary) d_boundary->update(d_g, o, a);
 
-      // Sweep over all tracks.
-      for (int t = 0; t < d_tracks->number_tracks(azimuth, 0); t++)
+      // Sweep over all tracks using the flat track layout.
+      const detran_geometry::TrackDB &tracks = *d_tracks;
+      const vec_dbl &coef = d_coefficients[d_g];
+      size_t track_0 = tracks.track_offset(azimuth, 0);
+      for (size_t t = 0; t < tracks.number_tracks(azimuth, 0); ++t)
       {
-//        if (!track_reverse)
-//          cout << "    TRACK: " << t << endl;
-//        else
-//          cout << "    TRACK: " << t << " in REVERSE" << endl;
-        // Get track.
-        SP_track track = d_tracks->track(azimuth, 0, t);
-
-        // *** LOAD THE BOUNDARY FLUX.
-//        if (o == 0)
-//          psi_out = 1.0 + 4*o + t;
-//        else
-        psi_out = (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::IN, t);
-
-//        cout << " OCTANT = " << o << endl;
-//        cout << "   ANGLE = " << a << endl;
-//        cout << "     TRACK = " << t << endl;
-//        cout << "       psi_in = " << psi_out << endl;
+        // Global track index and its range of segments.
+        size_t i = track_0 + t;
+        size_t s_begin = tracks.segment_offset(i);
+        size_t s_end   = tracks.segment_offset(i + 1);
+        double width   = tracks.track_width(i);
 
-        // SN access
-        // boundary_flux_type psi_v = (*d_boundary)
-        //   (d_face_index[o][Mesh::VERT][Boundary_T::IN], o, a, d_g);
-        // MOC access
-        // double psi_v = (*d_boundary)(d_g, o, a, t);
-        // --> the side doesn't matter for this access
-        // --> ergo, the side really needn't be part of the storage
-        // --> create index maps for which track is on a side, etc.
-
-
-        //cout << "      PSI_IN: " << psi_out << endl;
-
-        double width = track->width();
+        // Load the boundary flux.
+        psi_out = (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::IN, t);
 
         // Sweep all segments on the track.
-        int s = 0;
-        for (int ss = 0; ss < track->number_segments(); ss++)
+        for (size_t ss = s_begin; ss < s_end; ++ss)
         {
-          s = ss;
-          if (track_reverse) s = track->number_segments() - ss - 1;
-
-          //cout << "      SEGMENT: " << s << endl;
+          size_t s = track_reverse ? s_end - 1 - (ss - s_begin) : ss;
 
           // Update track angular flux
           psi_in = psi_out;
 
-          // Get segment region.
-          int region = track->segment(s).region();
-
-          // Get segment length.
-          double length = track->segment(s).length();
-
           // Solve.
-          equation.solve(region, length, width, source,
-                         psi_in, psi_out, phi_local, psi);
-
-          //cout << "        PSI_OUT: " << psi_out << endl;
+          if (d_precompute)
+          {
+            equation.solve(tracks.segment_region(s), tracks.segment_length(s),
+                           width, &coef[(polar * number_segments + s) * nc],
+                           source, psi_in, psi_out, phi_local, psi);
+          }
+          else
+          {
+            equation.solve(tracks.segment_region(s), tracks.segment_length(s),
+                           width, source, psi_in, psi_out, phi_local, psi);
+          }
 
         } // end segment
 
-        // *** UPDATE THE BOUNDARY WITH psi_out
+        // Update the boundary with the outgoing flux.
         (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::OUT, t) = psi_out;
 
-
-        //cout << "      psi_out = " << psi_out << endl;
-
       } // end track
 
-      // Update the angular flux.
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
-
-
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
-  {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
-    {
-      phi[i] += phi_local[i];
-    }
-  }
-#endif
+  reduce_thread_moments(phi);
 
   } // end omp parallel
 
-  #pragma omp master
-  {
-    d_number_sweeps++;
-  }
+  d_number_sweeps++;
   return;
 }
 
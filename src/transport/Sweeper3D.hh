@@ -40,11 +40,14 @@ public:
   typedef typename Base::SP_quadrature              SP_quadrature;
   typedef typename Base::SP_sweepsource             SP_sweepsource;
   typedef typename Base::moments_type               moments_type;
+  typedef typename Base::vec_moments_type           vec_moments_type;
   typedef typename Base::angular_flux_type          angular_flux_type;
   typedef typename Base::SP_tally                   SP_tally;
   typedef typename Base::vec_int                    vec_int;
   typedef typename Base::vec2_int                   vec2_int;
   typedef typename Base::vec3_int                   vec3_int;
+  typedef typename Base::vec2_size_t                vec2_size_t;
+  typedef typename Base::vec_dbl                    vec_dbl;
   typedef typename Base::size_t                     size_t;
   typedef EQ                                        Equation_T;
   typedef BoundarySN<_3D>                           Boundary_T;
@@ -93,6 +96,12 @@ public:
   /// Sweep.
   inline void sweep(moments_type &phi);
 
+  /// Sweep a block of moments sources.  See Sweeper::sweep_block.
+  inline void sweep_block(const vec_moments_type &q, vec_moments_type &phi);
+
+  /// Block sweeps are implemented.
+  bool has_block_sweep() const { return true; }
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -100,6 +109,46 @@ private:
   //-------------------------------------------------------------------------//
 
   SP_boundary d_boundary;
+  /// Thread-local yz face fluxes, [thread][k][j]
+  std::vector<bf_type> d_psi_yz_thread;
+  /// Thread-local xz face fluxes, [thread][k][i]
+  std::vector<bf_type> d_psi_xz_thread;
+  /// Thread-local xy face fluxes, [thread][j][i]
+  std::vector<bf_type> d_psi_xy_thread;
+  /// KBA sweep sources, [octant-angle][cell]
+  std::vector<SweepSource<_3D>::sweep_source_type> d_kba_source;
+  /// KBA yz face fluxes, [octant-angle][k][j]
+  std::vector<bf_type> d_kba_psi_yz;
+  /// KBA xz face fluxes, [octant-angle][k][i]
+  std::vector<bf_type> d_kba_psi_xz;
+  /// KBA xy face fluxes, [octant-angle][j][i]
+  std::vector<bf_type> d_kba_psi_xy;
+  /// KBA equations, [octant-angle], kept between sweeps
+  std::vector<Equation_T> d_kba_equation;
+  /// KBA angular fluxes and sweep sources in use, [octant-angle]
+  std::vector<State::angular_flux_type*> d_kba_psi;
+  std::vector<SweepSource<_3D>::sweep_source_type*> d_kba_source_ptr;
+  /// Batched sweep sources, [thread][cell][angle]
+  std::vector<vec_dbl> d_batch_source;
+  /// Batched yz face fluxes, [thread][k][j][angle]
+  std::vector<vec_dbl> d_batch_psi_yz;
+  /// Batched xz face fluxes, [thread][k][i][angle]
+  std::vector<vec_dbl> d_batch_psi_xz;
+  /// Batched xy face fluxes, [thread][j][i][angle]
+  std::vector<vec_dbl> d_batch_psi_xy;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Sweep using the default angle-parallel scheduler.
+  inline void sweep_angle(moments_type &phi);
+
+  /// Sweep using the KBA wavefront scheduler.
+  inline void sweep_kba(moments_type &phi);
+
+  /// Sweep using the angle-batched scheduler.
+  inline void sweep_batch(moments_type &phi);
 
 };
 
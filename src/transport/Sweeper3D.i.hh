@@ -10,6 +10,7 @@
 #ifndef detran_SWEEPER3D_I_HH_
 #define detran_SWEEPER3D_I_HH_
 
+#include <algorithm>
 #include <iostream>
 #ifdef DETRAN_ENABLE_OPENMP
 #include <omp.h>
@@ -22,19 +23,31 @@ namespace detran
 template <class EQ>
 inline void Sweeper3D<EQ>::sweep(moments_type &phi)
 {
-  using std::cout;
-  using std::endl;
+  if (d_sweep_scheduler == Base::SWEEP_KBA)
+    sweep_kba(phi);
+  else if (d_sweep_scheduler == Base::SWEEP_BATCH)
+    sweep_batch(phi);
+  else
+    sweep_angle(phi);
+}
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_angle(moments_type &phi)
+{
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+  if (d_psi_yz_thread.size() < d_source_thread.size())
+  {
+    d_psi_yz_thread.resize(d_source_thread.size());
+    d_psi_xz_thread.resize(d_source_thread.size());
+    d_psi_xy_thread.resize(d_source_thread.size());
+  }
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Build the sources of all angles up front if requested.
+  if (d_octant_source_flag) build_octant_sources();
 
-  #pragma omp parallel default(shared) private(phi_local)
+  #pragma omp parallel default(shared)
   {
 
   // Initialize equation and setup for this group.
@@ -42,13 +55,14 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
   equation.setup_group(d_g);
 
   // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
+  moments_type &phi_local = thread_moments(phi);
 
-  // Reset the boundary flux tally
-  if (d_tally) d_tally->reset(d_g);
-
-  // Initialize discrete sweep source vector.
-  SweepSource<_3D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
+  // Thread-local discrete sweep source and boundary flux vectors.
+  SweepSource<_3D>::sweep_source_type &source_buffer =
+    d_source_thread[thread_index()];
+  bf_type &psi_yz = d_psi_yz_thread[thread_index()];
+  bf_type &psi_xz = d_psi_xz_thread[thread_index()];
+  bf_type &psi_xy = d_psi_xy_thread[thread_index()];
 
   // Reference to boundary to simplify clutter.
   Boundary_T &b = *d_boundary;
@@ -66,22 +80,24 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
     {
 
       // Get sweep source for this angle.
-      d_sweepsource->source(d_g, o, a, source);
+      SweepSource<_3D>::sweep_source_type &source =
+        angle_source(o, a, source_buffer);
 
       // Setup equations for this angle.
       equation.setup_angle(a);
 
-      // Get psi if update requested.
-      State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      // Get psi if update requested.  Each angle is swept by one thread,
+      // so the angular flux is updated in place.
+      State::angular_flux_type &psi =
+        d_update_psi ? d_state->psi(d_g, o, a) : d_psi_dummy;
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
 
       // Get boundary fluxes.
-      bf_type psi_yz = b(d_face_index[o][Mesh::YZ][Boundary_T::IN], o, a, d_g);
-      bf_type psi_xz = b(d_face_index[o][Mesh::XZ][Boundary_T::IN], o, a, d_g);
-      bf_type psi_xy = b(d_face_index[o][Mesh::XY][Boundary_T::IN], o, a, d_g);
+      psi_yz = b(d_face_index[o][Mesh::YZ][Boundary_T::IN], o, a, d_g);
+      psi_xz = b(d_face_index[o][Mesh::XZ][Boundary_T::IN], o, a, d_g);
+      psi_xy = b(d_face_index[o][Mesh::XY][Boundary_T::IN], o, a, d_g);
 
       // Temporary edge fluxes.
       Equation<_3D>::face_flux_type psi_in  = { 0.0, 0.0, 0.0 };
@@ -111,7 +127,7 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
             psi_in[Mesh::XY] = psi_xy[j][i];
 
             // Solve.
-            equation.solve(i, j, k, source, psi_in, psi_out, phi, psi);
+            equation.solve(i, j, k, source, psi_in, psi_out, phi_local, psi);
 
             // Save the horizontal flux.
             psi_xz[k][i] = psi_out[Mesh::XZ];
@@ -132,32 +148,431 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
       b(d_face_index[o][Mesh::XZ][Boundary_T::OUT], o, a, d_g) = psi_xz;
       b(d_face_index[o][Mesh::XY][Boundary_T::OUT], o, a, d_g) = psi_xy;
 
-      // Angular flux update
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
-
     } // end angle loop
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
+  reduce_thread_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+  return;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_kba(moments_type &phi)
+{
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+
+  // Build the sources of all angles up front if requested.
+  if (d_octant_source_flag) build_octant_sources();
+
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+  const size_t nz = d_mesh->number_cells_z();
+  const size_t na = d_quadrature->number_angles_octant();
+
+  // Octants are pipelined together unless the boundary is updated on
+  // the fly.  See Sweeper2D::sweep_kba.
+  const size_t number_blocks = d_update_boundary ? 8 : 1;
+  const size_t octants_per_block = 8 / number_blocks;
+  const size_t number_oa = octants_per_block * na;
+
+  // Per octant-angle working storage.
+  if (d_kba_source.size() != number_oa)
+  {
+    d_kba_source.assign(number_oa,
+      SweepSource<_3D>::sweep_source_type(d_mesh->number_cells(), 0.0));
+    typedef typename bf_type::value_type row_type;
+    d_kba_psi_yz.assign(number_oa, bf_type(nz, row_type(ny, 0.0)));
+    d_kba_psi_xz.assign(number_oa, bf_type(nz, row_type(nx, 0.0)));
+    d_kba_psi_xy.assign(number_oa, bf_type(ny, row_type(nx, 0.0)));
+    d_kba_psi.assign(number_oa, NULL);
+    d_kba_source_ptr.assign(number_oa, NULL);
+  }
+  if (d_kba_equation.size() != number_oa ||
+      d_kba_equation[0].update_psi() != d_update_psi)
+  {
+    d_kba_equation.assign(number_oa,
+      Equation_T(d_mesh, d_material, d_quadrature, d_update_psi));
+  }
+  std::vector<Equation_T> &equation = d_kba_equation;
+  std::vector<State::angular_flux_type*> &psi = d_kba_psi;
+  std::vector<SweepSource<_3D>::sweep_source_type*> &source =
+    d_kba_source_ptr;
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
   {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
+
+  // Reset the flux moments
+  moments_type &phi_local = thread_moments(phi);
+
+  // Temporary face fluxes.
+  Equation<_3D>::face_flux_type psi_in  = { 0.0, 0.0, 0.0 };
+  Equation<_3D>::face_flux_type psi_out = { 0.0, 0.0, 0.0 };
+
+  for (size_t block = 0; block < number_blocks; ++block)
+  {
+
+    // Setup the sources, equations, and incident fluxes.
+    #pragma omp for
+    for (size_t oa = 0; oa < number_oa; ++oa)
+    {
+      size_t o = d_ordered_octants[block * octants_per_block + oa / na];
+      size_t a = oa % na;
+
+      source[oa] = &angle_source(o, a, d_kba_source[oa]);
+
+      equation[oa].setup_group(d_g);
+      equation[oa].setup_octant(o);
+      equation[oa].setup_angle(a);
+
+      psi[oa] = d_update_psi ? &d_state->psi(d_g, o, a) : &d_psi_dummy;
+
+      if (d_update_boundary) b.update(d_g, o, a);
+
+      const vec2_size_t &face = d_face_index[o];
+      d_kba_psi_yz[oa] = b(face[Mesh::YZ][Boundary_T::IN], o, a, d_g);
+      d_kba_psi_xz[oa] = b(face[Mesh::XZ][Boundary_T::IN], o, a, d_g);
+      d_kba_psi_xy[oa] = b(face[Mesh::XY][Boundary_T::IN], o, a, d_g);
+    } // end setup loop
+
+    // Sweep the hyperplanes.
+    for (size_t w = 0; w < d_wavefronts.size(); ++w)
     {
-      phi[i] += phi_local[i];
+      const vec_int &cell_ii = d_wavefronts[w][0];
+      const vec_int &cell_jj = d_wavefronts[w][1];
+      const vec_int &cell_kk = d_wavefronts[w][2];
+      const int number_cells_w = cell_ii.size();
+
+      #pragma omp for
+      for (int n = 0; n < (int)number_oa * number_cells_w; ++n)
+      {
+        size_t oa = n / number_cells_w;
+        size_t c  = n % number_cells_w;
+        size_t o  = d_ordered_octants[block * octants_per_block + oa / na];
+
+        int i = d_space_ranges[o][0][0] + cell_ii[c] * d_space_ranges[o][0][1];
+        int j = d_space_ranges[o][1][0] + cell_jj[c] * d_space_ranges[o][1][1];
+        int k = d_space_ranges[o][2][0] + cell_kk[c] * d_space_ranges[o][2][1];
+
+        bf_type &psi_yz = d_kba_psi_yz[oa];
+        bf_type &psi_xz = d_kba_psi_xz[oa];
+        bf_type &psi_xy = d_kba_psi_xy[oa];
+
+        psi_in[Mesh::YZ] = psi_yz[k][j];
+        psi_in[Mesh::XZ] = psi_xz[k][i];
+        psi_in[Mesh::XY] = psi_xy[j][i];
+
+        // Solve.
+        equation[oa].solve(i, j, k, *source[oa], psi_in, psi_out,
+                           phi_local, *psi[oa]);
+
+        // Save the outgoing fluxes.
+        psi_yz[k][j] = psi_out[Mesh::YZ];
+        psi_xz[k][i] = psi_out[Mesh::XZ];
+        psi_xy[j][i] = psi_out[Mesh::XY];
+      } // end wavefront loop
+
+    } // end wavefronts
+
+    // Update the outgoing boundary fluxes.
+    #pragma omp for
+    for (size_t oa = 0; oa < number_oa; ++oa)
+    {
+      size_t o = d_ordered_octants[block * octants_per_block + oa / na];
+      size_t a = oa % na;
+      const vec2_size_t &face = d_face_index[o];
+      b(face[Mesh::YZ][Boundary_T::OUT], o, a, d_g) = d_kba_psi_yz[oa];
+      b(face[Mesh::XZ][Boundary_T::OUT], o, a, d_g) = d_kba_psi_xz[oa];
+      b(face[Mesh::XY][Boundary_T::OUT], o, a, d_g) = d_kba_psi_xy[oa];
     }
-  }
-#endif
+
+  } // end block loop
+
+  // Sum local thread fluxes.
+  reduce_thread_moments(phi);
 
   } // end omp parallel
 
+  d_number_sweeps++;
+}
 
-  #pragma omp master
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_batch(moments_type &phi)
+{
+  const size_t NB = Equation_T::BATCH_SIZE;
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+  const size_t nz = d_mesh->number_cells_z();
+  const size_t na = d_quadrature->number_angles_octant();
+  const size_t number_batches = (na + NB - 1) / NB;
+
+  // Allocate the thread-local buffers if needed.
+  setup_threads();
+  if (d_batch_source.size() < d_source_thread.size())
   {
-    d_number_sweeps++;
+    size_t nt = d_source_thread.size();
+    d_batch_source.resize(nt, vec_dbl(d_mesh->number_cells() * NB, 0.0));
+    d_batch_psi_yz.resize(nt, vec_dbl(nz * ny * NB, 0.0));
+    d_batch_psi_xz.resize(nt, vec_dbl(nz * nx * NB, 0.0));
+    d_batch_psi_xy.resize(nt, vec_dbl(ny * nx * NB, 0.0));
   }
-  return;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.setup_group(d_g);
+
+  // Reset the flux moments
+  moments_type &phi_local = thread_moments(phi);
+
+  // Thread-local sources and face fluxes.  The batched arrays are stored
+  // with the angle innermost.
+  vec_dbl &batch_source = d_batch_source[thread_index()];
+  vec_dbl &psi_yz = d_batch_psi_yz[thread_index()];
+  vec_dbl &psi_xz = d_batch_psi_xz[thread_index()];
+  vec_dbl &psi_xy = d_batch_psi_xy[thread_index()];
+  double psi_center[NB];
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 8; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    equation.setup_octant(o);
+
+    const vec2_size_t &face = d_face_index[o];
+
+    // Sweep over all batches of angles.
+    #pragma omp for
+    for (size_t batch = 0; batch < number_batches; ++batch)
+    {
+      const size_t a0 = batch * NB;
+      const size_t n  = std::min(NB, na - a0);
+
+      // Setup equation for this batch.
+      equation.setup_batch(a0, n);
+
+      // Padded lanes carry zeros.
+      if (n < NB)
+      {
+        batch_source.assign(batch_source.size(), 0.0);
+        psi_yz.assign(psi_yz.size(), 0.0);
+        psi_xz.assign(psi_xz.size(), 0.0);
+        psi_xy.assign(psi_xy.size(), 0.0);
+      }
+
+      // Build the interleaved sources of the batch in one pass.
+      d_sweepsource->source_angles(d_g, o, a0, n, &batch_source[0], NB);
+
+      // Gather the incident fluxes of each angle.
+      for (size_t l = 0; l < n; ++l)
+      {
+        size_t a = a0 + l;
+
+        // Update the boundary for this angle.
+        if (d_update_boundary) b.update(d_g, o, a);
+
+        const bf_type &in_yz = b(face[Mesh::YZ][Boundary_T::IN], o, a, d_g);
+        const bf_type &in_xz = b(face[Mesh::XZ][Boundary_T::IN], o, a, d_g);
+        const bf_type &in_xy = b(face[Mesh::XY][Boundary_T::IN], o, a, d_g);
+        for (size_t k = 0; k < nz; ++k)
+        {
+          for (size_t j = 0; j < ny; ++j)
+            psi_yz[(k * ny + j) * NB + l] = in_yz[k][j];
+          for (size_t i = 0; i < nx; ++i)
+            psi_xz[(k * nx + i) * NB + l] = in_xz[k][i];
+        }
+        for (size_t j = 0; j < ny; ++j)
+          for (size_t i = 0; i < nx; ++i)
+            psi_xy[(j * nx + i) * NB + l] = in_xy[j][i];
+      }
+
+      // Sweep over all z
+      int k  = d_space_ranges[o][2][0];
+      int dk = d_space_ranges[o][2][1];
+      for (size_t kk = 0; kk < nz; ++kk, k += dk)
+      {
+        // Sweep over all y
+        int j  = d_space_ranges[o][1][0];
+        int dj = d_space_ranges[o][1][1];
+        for (size_t jj = 0; jj < ny; ++jj, j += dj)
+        {
+          // Sweep over all x
+          int i  = d_space_ranges[o][0][0];
+          int di = d_space_ranges[o][0][1];
+          for (size_t ii = 0; ii < nx; ++ii, i += di)
+          {
+            size_t cell = d_mesh->index(i, j, k);
+
+            // Solve the equation in this cell for all angles in the batch.
+            equation.solve_batch(i, j, k, &batch_source[cell * NB],
+                                 &psi_yz[(k * ny + j) * NB],
+                                 &psi_xz[(k * nx + i) * NB],
+                                 &psi_xy[(j * nx + i) * NB],
+                                 phi_local, psi_center);
+
+            // Store the angular flux if needed.
+            if (d_update_psi)
+            {
+              for (size_t l = 0; l < n; ++l)
+                d_state->psi(d_g, o, a0 + l)[cell] = psi_center[l];
+            }
+
+          } // end x loop
+        } // end y loop
+      } // end z loop
+
+      // Update boundary
+      for (size_t l = 0; l < n; ++l)
+      {
+        size_t a = a0 + l;
+        bf_type &out_yz = b(face[Mesh::YZ][Boundary_T::OUT], o, a, d_g);
+        bf_type &out_xz = b(face[Mesh::XZ][Boundary_T::OUT], o, a, d_g);
+        bf_type &out_xy = b(face[Mesh::XY][Boundary_T::OUT], o, a, d_g);
+        for (size_t k = 0; k < nz; ++k)
+        {
+          for (size_t j = 0; j < ny; ++j)
+            out_yz[k][j] = psi_yz[(k * ny + j) * NB + l];
+          for (size_t i = 0; i < nx; ++i)
+            out_xz[k][i] = psi_xz[(k * nx + i) * NB + l];
+        }
+        for (size_t j = 0; j < ny; ++j)
+          for (size_t i = 0; i < nx; ++i)
+            out_xy[j][i] = psi_xy[(j * nx + i) * NB + l];
+      }
+
+    } // end batch loop
+    // end omp do
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_block(const vec_moments_type &q,
+                                       vec_moments_type       &phi)
+{
+  Require(q.size() == phi.size());
+  const size_t m  = q.size();
+  const size_t nx = d_mesh->number_cells_x();
+  const size_t ny = d_mesh->number_cells_y();
+  const size_t nz = d_mesh->number_cells_z();
+
+  // Allocate the thread-local buffers if needed.
+  setup_block_threads(m);
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, false);
+  equation.setup_group(d_g);
+
+  // Reset the flux moments
+  vec_moments_type &phi_local = thread_block_moments(phi);
+
+  // Thread-local sweep sources.  The face fluxes are stored with the
+  // source innermost.
+  vec_moments_type &source = d_source_block_thread[thread_index()];
+  vec_dbl psi_yz(m, 0.0);
+  vec_dbl psi_xz(nx * m, 0.0);
+  vec_dbl psi_xy(ny * nx * m, 0.0);
+
+  // Temporary face fluxes.
+  Equation<_3D>::face_flux_type psi_in  = { 0.0, 0.0, 0.0 };
+  Equation<_3D>::face_flux_type psi_out = { 0.0, 0.0, 0.0 };
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 8; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    equation.setup_octant(o);
+
+    // Sweep over all angles
+    #pragma omp for
+    for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
+    {
+
+      // Get sweep sources for this angle.
+      for (size_t s = 0; s < m; ++s)
+        d_sweepsource->source(o, a, q[s], source[s]);
+
+      // Setup equations for this angle.
+      equation.setup_angle(a);
+
+      // Vacuum incident fluxes.
+      psi_xy.assign(ny * nx * m, 0.0);
+
+      // Sweep over all z
+      int k  = d_space_ranges[o][2][0];
+      int dk = d_space_ranges[o][2][1];
+      for (size_t kk = 0; kk < nz; ++kk, k += dk)
+      {
+        psi_xz.assign(nx * m, 0.0);
+
+        // Sweep over all y
+        int j  = d_space_ranges[o][1][0];
+        int dj = d_space_ranges[o][1][1];
+        for (size_t jj = 0; jj < ny; ++jj, j += dj)
+        {
+          psi_yz.assign(m, 0.0);
+
+          // Sweep over all x
+          int i  = d_space_ranges[o][0][0];
+          int di = d_space_ranges[o][0][1];
+          for (size_t ii = 0; ii < nx; ++ii, i += di)
+          {
+            // Solve the equation in this cell for each source.
+            double *xz = &psi_xz[i * m];
+            double *xy = &psi_xy[(j * nx + i) * m];
+            for (size_t s = 0; s < m; ++s)
+            {
+              psi_in[Mesh::YZ] = psi_yz[s];
+              psi_in[Mesh::XZ] = xz[s];
+              psi_in[Mesh::XY] = xy[s];
+              equation.solve(i, j, k, source[s], psi_in, psi_out,
+                             phi_local[s], d_psi_dummy);
+              psi_yz[s] = psi_out[Mesh::YZ];
+              xz[s]     = psi_out[Mesh::XZ];
+              xy[s]     = psi_out[Mesh::XY];
+            }
+          } // end x loop
+        } // end y loop
+      } // end z loop
+
+    } // end angle loop
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_block_moments(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps += m;
 }
 
 } // end namespace detran
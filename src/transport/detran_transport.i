@@ -34,6 +34,13 @@
 
 %include "DimensionTraits.hh"
 
+// The angular flux of a group and angle is a strided view, which SWIG
+// would wrap as an opaque pointer.  Python gets a vec_dbl copy through
+// psi(g, o, a) and writes one back with set_psi(g, o, a, f).
+%ignore detran::State::psi;
+%ignore detran::State::psi_data;
+%rename(psi) detran::State::get_psi;
+
 %include "State.hh"
 %include "FissionSource.hh"
 %include "ScatterSource.hh"
@@ -10,7 +10,8 @@
 #define TEST_LIST                     \
         FUNC(test_CurrentTally_1D)    \
         FUNC(test_CurrentTally_2D)    \
-        FUNC(test_CurrentTally_3D)
+        FUNC(test_CurrentTally_3D)    \
+        FUNC(test_CurrentTally_thread)
 
 #include "utilities/TestDriver.hh"
 #include "CurrentTally.hh"
@@ -503,6 +504,59 @@ int test_CurrentTally_3D(int argc, char *argv[])
   return 0;
 }
 
+// Tallies into a thread buffer reach the currents only when reduced.
+int test_CurrentTally_thread(int argc, char *argv[])
+{
+  using detran_utilities::size_t;
+  typedef CurrentTally<_2D> CurrentTally_T;
+
+  CurrentTally_T::SP_coarsemesh mesh = coarsemesh_2d();
+  CoarseMesh::SP_mesh finemesh = mesh->get_fine_mesh();
+  CoarseMesh::SP_mesh coarsemesh = mesh->get_coarse_mesh();
+  CurrentTally_T::SP_quadrature quad(new LevelSymmetric(1, 2));
+
+  // Tally the same fluxes directly and through the buffer of thread 0.
+  CurrentTally_T direct(mesh, quad, 1);
+  CurrentTally_T buffered(mesh, quad, 1);
+  buffered.setup_threads();
+  for (size_t o = 0; o < 4; o++)
+  {
+    for (size_t j = 0; j < finemesh->number_cells_y(); j++)
+    {
+      for (size_t i = 0; i < finemesh->number_cells_x(); i++)
+      {
+        CurrentTally_T::face_flux_type psi_out;
+        psi_out[0] = 1.0 + i;
+        psi_out[1] = 1.0 + j + o;
+        direct.tally(i, j, 0, 0, o, 0, psi_out);
+        buffered.tally(i, j, 0, 0, o, 0, psi_out, 0);
+      }
+    }
+  }
+  for (int i = 0; i < coarsemesh->number_cells_x() + 1; i++)
+    TEST(buffered.partial_current(i, 0, 0, 0, CurrentTally_T::X_DIRECTED,
+                                  CurrentTally_T::POSITIVE) == 0.0);
+
+  buffered.reduce(0);
+  for (int d = 0; d < 2; ++d)
+  {
+    int nx = coarsemesh->number_cells_x() + (d == 0);
+    int ny = coarsemesh->number_cells_y() + (d == 1);
+    for (int j = 0; j < ny; j++)
+    {
+      for (int i = 0; i < nx; i++)
+      {
+        for (int s = 0; s < 2; s++)
+        {
+          TEST(soft_equiv(buffered.partial_current(i, j, 0, 0, d, s),
+                          direct.partial_current(i, j, 0, 0, d, s)));
+        }
+      }
+    }
+  }
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_CurrentTally.cc
 //----------------------------------------------------------------------------//
@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_Exponential.cc
+ *  @brief Test of Exponential class
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                           \
+        FUNC(test_Exponential_table)        \
+        FUNC(test_Exponential_rational)     \
+        FUNC(test_Exponential_benchmark)   \
+        FUNC(test_Exponential_table_edge)
+
+#include "utilities/TestDriver.hh"
+#include "Exponential.hh"
+#include "utilities/Timer.hh"
+#include <cmath>
+#include <cstdio>
+
+using namespace detran;
+using namespace detran_utilities;
+using namespace detran_test;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/// Maximum absolute and relative errors over [0, 40].
+void errors(const Exponential &e, double &abs_err, double &rel_err)
+{
+  abs_err = 0.0;
+  rel_err = 0.0;
+  for (int i = 0; i <= 400000; ++i)
+  {
+    double tau = i * 1.0e-4;
+    double ref = std::exp(-tau);
+    double val = e(tau);
+    abs_err = std::max(abs_err, std::abs(val - ref));
+    rel_err = std::max(rel_err, std::abs(val - ref) / ref);
+  }
+}
+
+//----------------------------------------------------------------------------//
+int test_Exponential_table(int argc, char *argv[])
+{
+  double tol[] = {1.0e-4, 1.0e-6, 1.0e-8};
+  for (int i = 0; i < 3; ++i)
+  {
+    Exponential e(Exponential::TABLE, tol[i]);
+    double abs_err, rel_err;
+    errors(e, abs_err, rel_err);
+    printf(" tol = %8.2e  intervals = %8i  error = %8.2e \n",
+           tol[i], (int)e.table_size(), abs_err);
+    TEST(abs_err <= tol[i]);
+  }
+  // Selected via the input database.
+  InputDB::SP_input db = InputDB::Create();
+  db->put<std::string>("moc_exp_type", "table");
+  db->put<double>("moc_exp_tolerance", 1.0e-5);
+  Exponential::SP_exponential e = Exponential::Create(db);
+  TEST(e->type() == Exponential::TABLE);
+  TEST(soft_equiv((*e)(0.0), 1.0));
+  TEST(soft_equiv((*e)(50.0), std::exp(-50.0)));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_Exponential_rational(int argc, char *argv[])
+{
+  Exponential e(Exponential::RATIONAL);
+  double abs_err, rel_err;
+  errors(e, abs_err, rel_err);
+  printf(" rational error = %8.2e  relative = %8.2e \n", abs_err, rel_err);
+  TEST(rel_err < 1.0e-8);
+  TEST(soft_equiv(e(0.0), 1.0));
+  TEST(e(2000.0) == 0.0);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_Exponential_benchmark(int argc, char *argv[])
+{
+  // Optical path lengths typical of fine MOC segments.
+  int n = 1000000;
+  vec_dbl tau(n, 0.0);
+  for (int i = 0; i < n; ++i)
+    tau[i] = 10.0 * std::pow(double(i) / n, 3);
+
+  const char* names[] = {"exact", "table", "rational"};
+  double sum[3];
+  for (int t = 0; t < Exponential::END_EXP_TYPES; ++t)
+  {
+    Exponential e(t);
+    Timer timer;
+    timer.tic();
+    sum[t] = 0.0;
+    for (int k = 0; k < 20; ++k)
+      for (int i = 0; i < n; ++i)
+        sum[t] += e(tau[i]);
+    double time = timer.toc();
+    double abs_err, rel_err;
+    errors(e, abs_err, rel_err);
+    printf(" %10s  time = %8.4f s  error = %8.2e \n", names[t], time, abs_err);
+  }
+  TEST(soft_equiv(sum[1], sum[0], 1.0e-5));
+  TEST(soft_equiv(sum[2], sum[0], 1.0e-8));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_Exponential_table_edge(int argc, char *argv[])
+{
+  // For many tolerances, tau * (1/delta) rounds up to the number of
+  // intervals for some tau just below the table bound.
+  for (int k = 0; k < 2000; ++k)
+  {
+    double tol = std::pow(10.0, -4.0 - 0.002 * k);
+    Exponential e(Exponential::TABLE, tol);
+    double tau = std::max(-std::log(tol), 1.0);
+    for (int j = 0; j < 4; ++j)
+    {
+      tau = std::nextafter(tau, 0.0);
+      TEST(std::abs(e(tau) - std::exp(-tau)) <= tol);
+    }
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_Exponential.cc
+//----------------------------------------------------------------------------//
@@ -8,13 +8,15 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
-        FUNC(test_State_basic)
+        FUNC(test_State_basic)        \
+        FUNC(test_State_psi)
 
 #include "utilities/TestDriver.hh"
 #include "State.hh"
 
 #include "geometry/test/mesh_fixture.hh"
 #include "angle/QuadratureFactory.hh"
+#include <cstddef>
 
 using namespace detran;
 using namespace detran_angle;
@@ -71,6 +73,86 @@ int test_State_basic(int argc, char *argv[])
   return 0;
 }
 
+//----------------------------------------------------------------------------//
+int test_State_psi(int argc, char *argv[])
+{
+  SP_mesh mesh = mesh_2d_fixture();
+  const char *layouts[] = {"group", "cell"};
+  for (int l = 0; l < 2; ++l)
+  {
+    State::SP_input input(new InputDB());
+    input->put<int>("number_groups", 2);
+    input->put<int>("store_angular_flux", 1);
+    input->put<std::string>("state_psi_layout", layouts[l]);
+    QuadratureFactory::SP_quadrature quad = QuadratureFactory::build(input, 2);
+    State::SP_state state(new State(input, mesh, quad));
+    TEST(state->psi_layout() == l);
+
+    // The slab is aligned and holds every group, angle, and cell.
+    int nc = mesh->number_cells();
+    int na = quad->number_angles_octant();
+    int no = quad->number_octants();
+    TEST(state->psi_size() == 2 * no * na * nc);
+    std::size_t address = reinterpret_cast<std::size_t>(state->psi_data());
+    TEST(address % State::PSI_ALIGNMENT == 0);
+
+    // Fill each view with a unique value per entry.
+    for (int g = 0; g < 2; ++g)
+      for (int o = 0; o < no; ++o)
+        for (int a = 0; a < na; ++a)
+          for (int i = 0; i < nc; ++i)
+            state->psi(g, o, a)[i] = 1000 * g + 100 * o + 10 * a + i;
+
+    // Every slab entry is written exactly once, and in cell-major order
+    // the angles of a cell are adjacent.
+    double sum = 0.0;
+    for (int i = 0; i < state->psi_size(); ++i)
+      sum += state->psi_data()[i];
+    double ref = 0.0;
+    for (int g = 0; g < 2; ++g)
+      for (int o = 0; o < no; ++o)
+        for (int a = 0; a < na; ++a)
+          for (int i = 0; i < nc; ++i)
+            ref += 1000 * g + 100 * o + 10 * a + i;
+    TEST(soft_equiv(sum, ref));
+    if (l == 0)
+    {
+      TEST(state->psi(0, 0, 0).is_contiguous());
+    }
+    else
+    {
+      TEST(&state->psi(0, 0, 0)[1] - &state->psi(0, 0, 0)[0] == 2 * no * na);
+    }
+
+    // Plain vector access copies in and out of the views.
+    vec_dbl f = state->get_psi(1, 1, 0);
+    TEST(f.size() == nc);
+    TEST(f[2] == 1102.0);
+    f[2] = 5.0;
+    TEST(state->psi(1, 1, 0)[2] == 1102.0);
+    state->set_psi(1, 1, 0, f);
+    TEST(state->psi(1, 1, 0)[2] == 5.0);
+    TEST(state->psi(1, 1, 0)[1] == 1101.0);
+
+    // Copies refer to their own slab.
+    State copy(*state);
+    TEST(copy.psi_data() != state->psi_data());
+    TEST(copy.psi(1, 0, 0)[1] == state->psi(1, 0, 0)[1]);
+    copy.psi(1, 0, 0)[1] = -1.0;
+    TEST(state->psi(1, 0, 0)[1] == 1001.0);
+    *state = copy;
+    TEST(state->psi(1, 0, 0)[1] == -1.0);
+
+    // Scale and clear act on the whole slab.
+    state->scale(2.0);
+    TEST(state->psi(1, 0, 0)[1] == -2.0);
+    state->clear();
+    for (int i = 0; i < state->psi_size(); ++i)
+      TEST(state->psi_data()[i] == 0.0);
+  }
+  return 0;
+}
+
 //----------------------------------------------------------------------------//
 //              end of test_State.cc
 //----------------------------------------------------------------------------//
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_Sweeper2DMOC.cc
+ *  @brief Test of Sweeper2DMOC
+ *  @note  Copyright (C) 2012-2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                             \
+        FUNC(test_Sweeper2DMOC_precompute)
+
+#include "utilities/TestDriver.hh"
+#include "Sweeper2DMOC.hh"
+#include "Equation_SC_MOC.hh"
+#include "angle/QuadratureFactory.hh"
+#include "angle/MomentToDiscrete.hh"
+#include "geometry/Mesh2D.hh"
+#include "geometry/Tracker.hh"
+
+using namespace detran;
+using namespace detran_angle;
+using namespace detran_geometry;
+using namespace detran_utilities;
+using namespace detran_test;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+int test_Sweeper2DMOC_precompute(int argc, char *argv[])
+{
+  typedef Sweeper2DMOC<Equation_SC_MOC> Sweeper_T;
+
+  // Two regions of different total cross section.
+  vec_dbl cm(3, 0.0);
+  cm[1] = 1.0;
+  cm[2] = 2.0;
+  vec_int fm(2, 3);
+  vec_int mt(4, 0);
+  mt[1] = mt[2] = 1;
+  Mesh::SP_mesh mesh(new Mesh2D(fm, fm, cm, cm, mt));
+  Sweeper_T::SP_material mat = detran_material::Material::Create(2, 1);
+  mat->set_sigma_t(0, 0, 1.0);
+  mat->set_sigma_t(1, 0, 4.0);
+  mat->finalize();
+
+  InputDB::SP_input db = InputDB::Create();
+  db->put<int>("number_groups", 1);
+  db->put<std::string>("equation", "scmoc");
+  db->put<std::string>("quad_type", "u-dgl");
+  db->put<int>("quad_number_azimuth_octant", 3);
+  db->put<int>("quad_number_polar_octant", 1);
+  db->put<double>("tracker_maximum_spacing", 0.1);
+  db->put<std::string>("tracker_spatial_quad_type", "uniform");
+  QuadratureFactory::SP_quadrature q = QuadratureFactory::build(db, 2);
+  Sweeper_T::SP_quadrature quad = q;
+
+  Tracker tracker(db, quad);
+  tracker.trackit(mesh);
+  tracker.normalize();
+
+  // Sweep a unit source with the coefficients computed on the fly and
+  // with them stored up front.
+  State::moments_type phi[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    db->put<int>("moc_precompute_coefficients", k);
+    State::SP_state state(new State(db, mesh, q));
+    Sweeper_T::SP_boundary boundary(new BoundaryMOC<_2D>(db, mesh, quad));
+    MomentToDiscrete::SP_MtoD MtoD =
+      MomentToDiscrete::Create(MomentIndexer::Create(2, 0), q);
+    Sweeper_T::SP_sweepsource source(
+      new SweepSource<_2D>(state, mesh, q, mat, MtoD));
+    source->fixed_group_source().assign(mesh->number_cells(), 1.0);
+    Sweeper_T sweeper(db, mesh, mat, quad, state, boundary, source);
+    sweeper.set_tracks(tracker.trackdb());
+    sweeper.setup_group(0);
+    phi[k].assign(mesh->number_cells(), 0.0);
+    sweeper.sweep(phi[k]);
+  }
+
+  for (int i = 0; i < mesh->number_cells(); ++i)
+  {
+    TEST(phi[0][i] > 0.0);
+    TEST(soft_equiv(phi[0][i], phi[1][i], 1.0e-12));
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_Sweeper2DMOC.cc
+//----------------------------------------------------------------------------//
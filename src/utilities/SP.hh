@@ -32,7 +32,9 @@ namespace detran_utilities
  *  \brief Reference counter for SP class.
  *
  *  This reference counter is thread safe, and allows SP's to be used
- *  as pointers to <i>unmutable</i> objects.
+ *  as pointers to <i>unmutable</i> objects.  The count is updated with
+ *  atomic instructions rather than a lock, so threads copying unrelated
+ *  (or even the same) SP's never serialize on a shared critical section.
  */
 //---------------------------------------------------------------------------//
 
@@ -53,19 +55,25 @@ public:
   /// Increment the reference count
   inline void increment()
   {
-    #pragma omp critical(referencecount)
-    {
-      b_refs++;
-    }
+#if defined(__GNUC__)
+    __sync_add_and_fetch(&b_refs, 1);
+#else
+    #pragma omp atomic
+    b_refs++;
+#endif
   }
 
-  /// Decrement the reference count
-  inline void decrement()
+  /// Decrement the reference count and return the new count
+  inline int decrement()
   {
-    #pragma omp critical(referencecount)
-    {
-      b_refs--;
-    }
+#if defined(__GNUC__)
+    return __sync_sub_and_fetch(&b_refs, 1);
+#else
+    int r;
+    #pragma omp atomic capture
+    r = --b_refs;
+    return r;
+#endif
   }
 
 private:
@@ -137,6 +145,10 @@ private:
  * to which these SP's point are <b>not</b> thread safe, but there are
  * few, if any, cases where that behavior would be required.
  *
+ * With C++11, SP's can also be moved.  Moving transfers the pointer
+ * without touching the count, and leaves the source empty: it holds no
+ * pointer and no counter, and may only be destroyed or assigned to.
+ *
  */
 /*!
  *  \example utilities/test/test_SP.cc
@@ -168,6 +180,11 @@ public:
   template<class X>
   inline SP(const SP<X> &spx_in);
 
+#if __cplusplus >= 201103L
+  // Move constructor for SP<T>.
+  inline SP(SP<T> &&sp_in);
+#endif
+
   /// Destructor, memory is released when count goes to zero.
   ~SP() { free(); }
 
@@ -179,12 +196,17 @@ public:
   inline SP<T>& operator=(X *px_in);
 
   // Assignment operator for type SP<T>.
-  inline SP<T>& operator=(const SP<T> sp_in);
+  inline SP<T>& operator=(const SP<T> &sp_in);
 
   // Assignment operator for type SP<X>.
   template<class X>
   inline SP<T>& operator=(const SP<X> spx_in);
 
+#if __cplusplus >= 201103L
+  // Move assignment operator for type SP<T>.
+  inline SP<T>& operator=(SP<T> &&sp_in);
+#endif
+
   /// Access operator.
   T* operator->() const
   {
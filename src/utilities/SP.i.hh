@@ -239,7 +239,7 @@ SP<T>& SP<T>::operator=(X *px_in)
  * \param sp_in smart pointer of type SP<T>
  */
 template<class T>
-SP<T>& SP<T>::operator=(const SP<T> sp_in)
+SP<T>& SP<T>::operator=(const SP<T> &sp_in)
 {
   Require (sp_in.r);
 
@@ -247,15 +247,18 @@ SP<T>& SP<T>::operator=(const SP<T> sp_in)
   if (this == &sp_in || p == sp_in.p)
     return *this;
 
+  // add the reference count first, since freeing the existing pointer
+  // might destroy the object that holds sp_in
+  sp_in.r->increment();
+  T     *np = sp_in.p;
+  SPref *nr = sp_in.r;
+
   // free the existing pointer
   free();
 
   // assign p and r to sp_in
-  p = sp_in.p;
-  r = sp_in.r;
-
-  // add the reference count and return
-  r->increment();
+  p = np;
+  r = nr;
   return *this;
 }
 
@@ -309,6 +312,60 @@ SP<T>& SP<T>::operator=(const SP<X> spx_in)
   return *this;
 }
 
+#if __cplusplus >= 201103L
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move constructor for SP<T>.
+ *
+ * The pointer and counter are taken from sp_in without changing the
+ * count.  Afterwards, sp_in is a null SP with a counter of its own, so it
+ * can be copied, assigned, or destroyed like any other null SP.
+ *
+ * \param sp_in smart pointer of type SP<T>
+ */
+template<class T>
+SP<T>::SP(SP<T> &&sp_in)
+    : p(sp_in.p),
+      r(sp_in.r)
+{
+  Require (r);
+  sp_in.p = 0;
+  sp_in.r = new SPref;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * \brief Move assignment operator for type SP<T>.
+ *
+ * As for the move constructor, sp_in is left a null SP.
+ *
+ * \param sp_in smart pointer of type SP<T>
+ */
+template<class T>
+SP<T>& SP<T>::operator=(SP<T> &&sp_in)
+{
+  Require (sp_in.r);
+
+  if (this == &sp_in)
+    return *this;
+
+  // take sp_in's pointer before freeing our own, since freeing the
+  // existing pointer might destroy the object that holds sp_in
+  T     *np = sp_in.p;
+  SPref *nr = sp_in.r;
+  sp_in.p = 0;
+  sp_in.r = new SPref;
+
+  free();
+
+  p = np;
+  r = nr;
+  return *this;
+}
+
+#endif
+
 //---------------------------------------------------------------------------//
 // PRIVATE IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -316,20 +373,23 @@ SP<T>& SP<T>::operator=(const SP<X> spx_in)
  * \brief Decrement the count and free the pointer if count is zero.
  *
  * Note that it is perfectly acceptable to call delete on a NULL pointer.
+ * Afterwards, this SP holds nothing.
  */
 template<class T>
 void SP<T>::free()
 {
+  // a moved-from SP holds nothing
+  if (!r) return;
 
-  Require (r);
-  r->decrement();
-  // if the count goes to zero then we free the data
-  if (r->refs() == 0)
+  // if the count goes to zero then we free the data; the count must be
+  // read from the decrement itself, since another thread may change it
+  if (r->decrement() == 0)
   {
     delete p;
     delete r;
   }
-
+  p = 0;
+  r = 0;
 }
 
 } // end namespace detran_utilities
@@ -0,0 +1,139 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  StridedVector.hh
+ *  @brief StridedVector class definition
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_utilities_STRIDEDVECTOR_HH_
+#define detran_utilities_STRIDEDVECTOR_HH_
+
+#include <vector>
+#include <cstddef>
+
+namespace detran_utilities
+{
+
+/**
+ *  @class StridedVector
+ *  @brief Vector-like view of equally-spaced elements in a larger array
+ *
+ *  A StridedVector either views memory owned by someone else (e.g. one
+ *  group and angle of a contiguous angular flux slab) or owns its own
+ *  contiguous storage.  Element access is the same in both cases, so
+ *  code written against std::vector indexing works unchanged.
+ *
+ *  Assigning to a view copies values into the viewed memory; assigning
+ *  to an owning vector resizes it.  Copying always yields an owner with
+ *  its own contiguous storage; use view() to rebind an existing vector
+ *  to someone else's memory.
+ */
+template <class T>
+class StridedVector
+{
+
+public:
+
+  //--------------------------------------------------------------------------//
+  // TYPEDEFS
+  //--------------------------------------------------------------------------//
+
+  typedef T                                       value_type;
+  typedef unsigned int                            size_type;
+  typedef value_type&                             reference;
+  typedef const value_type&                       const_reference;
+  typedef value_type*                             pointer;
+  typedef const value_type*                       const_pointer;
+
+  //--------------------------------------------------------------------------//
+  // CONSTRUCTORS
+  //--------------------------------------------------------------------------//
+
+  /// Default constructor; an empty owning vector
+  StridedVector();
+  /// Owning constructor of n elements, each set to v
+  explicit StridedVector(const size_type n, const_reference v = T());
+  /// View of n elements starting at data and separated by stride
+  StridedVector(pointer data, const size_type n, const size_type stride = 1);
+  /// Copy constructor; the copy always owns a contiguous copy of the data
+  StridedVector(const StridedVector &V);
+
+  //--------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //--------------------------------------------------------------------------//
+
+  //@{
+  /// Assign values.  Views require matching size; owners resize.
+  StridedVector& operator=(const StridedVector &V);
+  StridedVector& operator=(const std::vector<T> &V);
+  //@}
+
+  //@{
+  /// Element access
+  const_reference operator[](const size_type i) const;
+  reference operator[](const size_type i);
+  //@}
+
+  /// Number of elements
+  size_type size() const;
+
+  /// Distance between consecutive elements
+  size_type stride() const;
+
+  /// Is the storage contiguous?
+  bool is_contiguous() const;
+
+  /// Does this vector own its storage?
+  bool is_owner() const;
+
+  //@{
+  /// Pointer to the first element
+  pointer data();
+  const_pointer data() const;
+  //@}
+
+  /// Set all elements to v
+  void assign(const_reference v);
+
+  /// Resize an owning vector, setting all elements to v
+  void resize(const size_type n, const_reference v = T());
+
+  /// Copy the elements into a contiguous std::vector
+  void copy_to(std::vector<T> &V) const;
+
+  /// Make this a view of n elements starting at data and separated by stride
+  void view(pointer data, const size_type n, const size_type stride = 1);
+
+private:
+
+  //--------------------------------------------------------------------------//
+  // DATA
+  //--------------------------------------------------------------------------//
+
+  /// Pointer to the first element
+  pointer d_data;
+  /// Number of elements
+  size_type d_size;
+  /// Distance between consecutive elements
+  size_type d_stride;
+  /// Storage if this vector is an owner
+  std::vector<T> d_storage;
+  /// Is this vector an owner?
+  bool d_owner;
+
+};
+
+} // end namespace detran_utilities
+
+//----------------------------------------------------------------------------//
+// INLINE MEMBERS
+//----------------------------------------------------------------------------//
+
+#include "StridedVector.i.hh"
+
+#endif /* detran_utilities_STRIDEDVECTOR_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file StridedVector.hh
+//----------------------------------------------------------------------------//
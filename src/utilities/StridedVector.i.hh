@@ -0,0 +1,216 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  StridedVector.i.hh
+ *  @brief StridedVector inline member definitions
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+#ifndef detran_utilities_STRIDEDVECTOR_I_HH_
+#define detran_utilities_STRIDEDVECTOR_I_HH_
+
+#include "utilities/DBC.hh"
+#include "utilities/StridedVector.hh"
+
+namespace detran_utilities
+{
+
+//----------------------------------------------------------------------------//
+template <class T>
+StridedVector<T>::StridedVector()
+  : d_data(NULL)
+  , d_size(0)
+  , d_stride(1)
+  , d_owner(true)
+{
+  /* ... */
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+StridedVector<T>::StridedVector(const size_type n, const_reference v)
+  : d_data(NULL)
+  , d_size(0)
+  , d_stride(1)
+  , d_owner(true)
+{
+  resize(n, v);
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+StridedVector<T>::StridedVector(pointer         data,
+                                const size_type n,
+                                const size_type stride)
+  : d_data(data)
+  , d_size(n)
+  , d_stride(stride)
+  , d_owner(false)
+{
+  Require(data || n == 0);
+  Require(stride > 0);
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+StridedVector<T>::StridedVector(const StridedVector &V)
+  : d_data(NULL)
+  , d_size(V.d_size)
+  , d_stride(1)
+  , d_owner(true)
+{
+  V.copy_to(d_storage);
+  d_data = d_size ? &d_storage[0] : NULL;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline StridedVector<T>& StridedVector<T>::operator=(const StridedVector &V)
+{
+  if (this == &V) return *this;
+  if (d_owner)
+  {
+    V.copy_to(d_storage);
+    d_size   = V.d_size;
+    d_stride = 1;
+    d_data   = d_size ? &d_storage[0] : NULL;
+  }
+  else
+  {
+    Require(d_size == V.d_size);
+    for (size_type i = 0; i < d_size; ++i)
+      d_data[i * d_stride] = V[i];
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline StridedVector<T>& StridedVector<T>::operator=(const std::vector<T> &V)
+{
+  if (d_owner)
+  {
+    d_storage = V;
+    d_size    = V.size();
+    d_stride  = 1;
+    d_data    = d_size ? &d_storage[0] : NULL;
+  }
+  else
+  {
+    Require(d_size == V.size());
+    for (size_type i = 0; i < d_size; ++i)
+      d_data[i * d_stride] = V[i];
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::const_reference
+StridedVector<T>::operator[](const size_type i) const
+{
+  Require(i < d_size);
+  return d_data[i * d_stride];
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::reference
+StridedVector<T>::operator[](const size_type i)
+{
+  Require(i < d_size);
+  return d_data[i * d_stride];
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::size_type StridedVector<T>::size() const
+{
+  return d_size;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::size_type StridedVector<T>::stride() const
+{
+  return d_stride;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline bool StridedVector<T>::is_contiguous() const
+{
+  return d_stride == 1;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline bool StridedVector<T>::is_owner() const
+{
+  return d_owner;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::pointer StridedVector<T>::data()
+{
+  return d_data;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline typename StridedVector<T>::const_pointer StridedVector<T>::data() const
+{
+  return d_data;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline void StridedVector<T>::assign(const_reference v)
+{
+  for (size_type i = 0; i < d_size; ++i)
+    d_data[i * d_stride] = v;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline void StridedVector<T>::resize(const size_type n, const_reference v)
+{
+  Insist(d_owner, "Cannot resize a StridedVector view.");
+  d_storage.assign(n, v);
+  d_size   = n;
+  d_stride = 1;
+  d_data   = n ? &d_storage[0] : NULL;
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline void StridedVector<T>::copy_to(std::vector<T> &V) const
+{
+  V.resize(d_size);
+  for (size_type i = 0; i < d_size; ++i)
+    V[i] = d_data[i * d_stride];
+}
+
+//----------------------------------------------------------------------------//
+template <class T>
+inline void StridedVector<T>::view(pointer         data,
+                                   const size_type n,
+                                   const size_type stride)
+{
+  Require(data || n == 0);
+  Require(stride > 0);
+  std::vector<T>().swap(d_storage);
+  d_data   = data;
+  d_size   = n;
+  d_stride = stride;
+  d_owner  = false;
+}
+
+} // end namespace detran_utilities
+
+#endif /* detran_utilities_STRIDEDVECTOR_I_HH_ */
+
+//----------------------------------------------------------------------------//
+//              end of file StridedVector.i.hh
+//----------------------------------------------------------------------------//
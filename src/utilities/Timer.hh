@@ -11,12 +11,16 @@
 #define TIMER_HH_
 
 #include "DBC.hh"
+#include "detran_config.hh"
 
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <map>
 #include <string>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran_utilities
 {
@@ -32,7 +36,7 @@ public:
   void tic()
   {
     d_started = true;
-    d_value = (double) std::clock() / (double)CLOCKS_PER_SEC;
+    d_value = wtime();
   }
 
   /// Return the time elapsed around a single code block
@@ -44,17 +48,25 @@ public:
     return etime;
   }
 
-  /// Return the current wall time (only differences are meaningful)
-  double wtime()
+  /**
+   *  Return the current wall time (only differences are meaningful).
+   *  Without OpenMP, this falls back to the processor time, which is
+   *  the same for serial code.
+   */
+  static double wtime()
   {
+#ifdef DETRAN_ENABLE_OPENMP
+    return omp_get_wtime();
+#else
     return (double) std::clock() / (double)CLOCKS_PER_SEC;
+#endif
   }
 
   /// Begin the timer at the beginning of a function call.
   void function_tic()
   {
     d_started = true;
-    d_value = (double) std::clock() / (double)CLOCKS_PER_SEC;
+    d_value = wtime();
   }
 
   /// Log the function time.
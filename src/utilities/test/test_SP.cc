@@ -0,0 +1,221 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_SP.cc
+ *  @brief Test of SP
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST              \
+        FUNC(test_SP_basic)    \
+        FUNC(test_SP_move)     \
+        FUNC(test_SP_threads)  \
+        FUNC(test_SP_benchmark)
+
+#include "TestDriver.hh"
+#include "detran_config.hh"
+#include "utilities/SP.hh"
+#include "utilities/Timer.hh"
+#include <cstdio>
+#include <vector>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+using namespace detran_test;
+using namespace detran_utilities;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+/// Counts live instances so leaks and double deletes are caught.
+struct Foo
+{
+  Foo()  { ++count; }
+  virtual ~Foo() { --count; }
+  static int count;
+};
+int Foo::count = 0;
+
+struct Bar: public Foo
+{
+  int value;
+};
+
+/// Reference counter guarded by one global lock, as SP used to be.
+struct LockedRef
+{
+  LockedRef() : refs(1) {}
+  void increment()
+  {
+    #pragma omp critical(test_referencecount)
+    {
+      refs++;
+    }
+  }
+  int decrement()
+  {
+    int r;
+    #pragma omp critical(test_referencecount)
+    {
+      r = --refs;
+    }
+    return r;
+  }
+  int refs;
+};
+
+//----------------------------------------------------------------------------//
+int test_SP_basic(int argc, char *argv[])
+{
+  {
+    SP<Foo> a(new Foo);
+    TEST(Foo::count == 1);
+    SP<Foo> b(a);
+    SP<Foo> c;
+    TEST(!c);
+    c = b;
+    TEST(a == c);
+    SP<Foo> d(new Bar);
+    TEST(Foo::count == 2);
+    c = d;
+    TEST(Foo::count == 2);
+    a = d;
+    b = d;
+    // The first Foo has no more references.
+    TEST(Foo::count == 1);
+  }
+  TEST(Foo::count == 0);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_SP_move(int argc, char *argv[])
+{
+#if __cplusplus >= 201103L
+  {
+    SP<Foo> a(new Foo);
+    Foo *raw = a.bp();
+    SP<Foo> b(std::move(a));
+    TEST(!a);
+    TEST(b.bp() == raw);
+    SP<Foo> c(new Foo);
+    TEST(Foo::count == 2);
+    // Moving over c releases c's Foo.
+    c = std::move(b);
+    TEST(Foo::count == 1);
+    TEST(c.bp() == raw);
+    TEST(!b);
+    // A moved-from SP is a valid null SP, so it can be copied from.
+    SP<Foo> d(a);
+    TEST(!d);
+    SP<Foo> e(c);
+    e = b;
+    TEST(!e);
+    e = std::move(a);
+    TEST(!e);
+    TEST(!a);
+    SP<Foo> f(a);
+    TEST(!f);
+    TEST(Foo::count == 1);
+    // A moved-from SP can be assigned to again.
+    b = c;
+    TEST(b == c);
+    std::vector<SP<Foo> > v;
+    for (int i = 0; i < 100; ++i)
+      v.push_back(SP<Foo>(new Foo));
+    TEST(Foo::count == 101);
+  }
+  TEST(Foo::count == 0);
+#endif
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_SP_threads(int argc, char *argv[])
+{
+  {
+    SP<Foo> a(new Foo);
+    #pragma omp parallel
+    {
+      for (int i = 0; i < 100000; ++i)
+      {
+        SP<Foo> b(a);
+        SP<Foo> c;
+        c = b;
+      }
+    }
+    TEST(Foo::count == 1);
+    // Only a is left, so releasing it must delete the Foo.
+  }
+  TEST(Foo::count == 0);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_SP_benchmark(int argc, char *argv[])
+{
+  // Each thread repeatedly copies and releases a shared pointer, as when
+  // passing SP's by value inside a parallel sweep.  The locked counter
+  // serializes every thread on one critical section; the atomic counter
+  // does not.
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  int n = 2000000;
+
+  LockedRef locked;
+  double t0 = Timer::wtime();
+  #pragma omp parallel
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      locked.increment();
+      locked.decrement();
+    }
+  }
+  double time_locked = Timer::wtime() - t0;
+  TEST(locked.refs == 1);
+
+  SPref atomic;
+  t0 = Timer::wtime();
+  #pragma omp parallel
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      atomic.increment();
+      atomic.decrement();
+    }
+  }
+  double time_atomic = Timer::wtime() - t0;
+  TEST(atomic.refs() == 1);
+
+  SP<Foo> a(new Foo);
+  t0 = Timer::wtime();
+  #pragma omp parallel
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      SP<Foo> b(a);
+    }
+  }
+  double time_copy = Timer::wtime() - t0;
+
+  printf(" threads = %i  copies per thread = %i \n", number_threads, n);
+  printf("   locked count: %8.4f s \n", time_locked);
+  printf("   atomic count: %8.4f s \n", time_atomic);
+  printf("        SP copy: %8.4f s \n", time_copy);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_SP.cc
+//----------------------------------------------------------------------------//
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*-----------------------------------//
+/**
+ *  @file  test_StridedVector.cc
+ *  @brief Test of StridedVector
+ *  @note  Copyright (C) 2013 Jeremy Roberts
+ */
+//----------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                 \
+        FUNC(test_StridedVector)
+
+#include "TestDriver.hh"
+#include "utilities/StridedVector.hh"
+
+using namespace detran_test;
+using namespace detran_utilities;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------------------------------------//
+
+int test_StridedVector(int argc, char *argv[])
+{
+  // Owning vector
+  StridedVector<double> A(3, 1.0);
+  TEST(A.size() == 3);
+  TEST(A.is_owner());
+  TEST(A.is_contiguous());
+  TEST(A[2] == 1.0);
+
+  // View of every other element of an array
+  double v[] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+  StridedVector<double> B(&v[1], 3, 2);
+  TEST(!B.is_owner());
+  TEST(!B.is_contiguous());
+  TEST(B[0] == 1.0);
+  TEST(B[2] == 5.0);
+
+  // Assigning to a view writes through
+  B = A;
+  TEST(v[0] == 0.0);
+  TEST(v[3] == 1.0);
+  TEST(v[5] == 1.0);
+
+  // Copying a view makes an owner with its own contiguous copy
+  StridedVector<double> C(B);
+  TEST(C.is_owner());
+  TEST(C.is_contiguous());
+  TEST(C[1] == 1.0);
+  C[1] = 6.0;
+  TEST(v[3] == 1.0);
+
+  // Rebinding an owner makes it a view
+  C.view(&v[1], 3, 2);
+  TEST(!C.is_owner());
+  C[1] = 7.0;
+  TEST(v[3] == 7.0);
+
+  // Assigning to an owner makes a contiguous copy
+  StridedVector<double> D;
+  D = B;
+  TEST(D.is_owner());
+  TEST(D.is_contiguous());
+  D[1] = 8.0;
+  TEST(v[3] == 7.0);
+
+  // Gather into a std::vector
+  std::vector<double> E;
+  B.copy_to(E);
+  TEST(E.size() == 3);
+  TEST(E[1] == 7.0);
+
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+//              end of test_StridedVector.cc
+//----------------------------------------------------------------------------//